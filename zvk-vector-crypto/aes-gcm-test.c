@@ -14,6 +14,7 @@
 
 #include <assert.h>
 #include <inttypes.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -202,6 +203,7 @@ static const struct aes_gcm_test tc4Test =
 
 
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
 
 typedef union uint128 {
     uint64_t dwords[2];
@@ -779,6 +781,1068 @@ run_test_zvkg(const struct aes_gcm_test* test, int keylen)
     return rc;
 }
 
+//
+// Multi-Packet (Burst) Implementation
+//
+// Independent messages, each with its own key, IV, and AAD, are laid out
+// across element groups: group 'i' of every vector holds a block of
+// message 'i'. A single vaesem.vv (resp. vghsh.vv) thus advances the
+// encryption (resp. the authentication) of many messages at once.
+//
+// The per-message values are stored in arrays indexed by "lane", with
+// round keys stored round-major (all the lanes' round 0 keys, then all the
+// round 1 keys, etc.) so that the per-group keys are loaded with one vle32.
+//
+// Messages are sorted by decreasing length, such that at block index 'b'
+// the lanes still having data form a prefix of the arrays. Shorter messages
+// are "masked out" by reducing the number of bytes (i.e., vl) passed to
+// the kernels.
+
+// Maximum number of jobs processed in lockstep. Larger bursts are
+// processed as multiple batches.
+#define BURST_MAX_JOBS 64
+
+struct aes_gcm_job {
+    const uint8_t* key;
+    const uint8_t* iv;
+    const uint8_t* aad;
+    // Input text, plain text when sealing, cipher text when opening.
+    const uint8_t* in;
+    // Output text, 'len' bytes.
+    uint8_t* out;
+    // Key length in bits, 128 or 256.
+    size_t keylen;
+    // Lengths are in bytes.
+    size_t ivlen;
+    size_t aadlen;
+    size_t len;
+    size_t taglen;
+    // Output when sealing, expected tag when opening.
+    uint8_t tag[16];
+    // Output when opening: 0 when the tag matches. The output text
+    // is cleared on mismatch. Set to -1 for an unsupported key length,
+    // when sealing or opening.
+    int status;
+};
+
+// Zeroes 'len' bytes of key material. The volatile accesses keep the
+// compiler from eliding the stores to buffers that are not read again.
+static void
+secure_wipe(void* buf, size_t len)
+{
+    volatile uint8_t* p = buf;
+    for (size_t i = 0; i < len; i++) {
+        p[i] = 0;
+    }
+}
+
+// Loads the 'b'-th block of 'len' bytes at 'data' into 'block',
+// padding with zeroes.
+static void
+burst_load_block(uint128* block, const uint8_t* data, size_t len, size_t b) {
+    bzero(block, sizeof(*block));
+    if (16 * b < len) {
+        memcpy(block, &data[16 * b], MIN(16, len - 16 * b));
+    }
+}
+
+// Runs up to BURST_MAX_JOBS jobs that share the same key length. The
+// round keys live on the stack, so that bursts can run concurrently, and
+// are wiped before returning.
+static void
+aes_gcm_burst_batch(struct aes_gcm_job** jobs, size_t njobs, bool encrypt)
+{
+    __attribute__((aligned(16)))
+    uint32_t round_keys[15 * BURST_MAX_JOBS * 4];
+    uint128 H[BURST_MAX_JOBS];
+    uint128 Y[BURST_MAX_JOBS];
+    uint128 EJ0[BURST_MAX_JOBS];
+    uint128 counters[BURST_MAX_JOBS];
+    uint128 in[BURST_MAX_JOBS];
+    uint128 out[BURST_MAX_JOBS];
+
+    assert(njobs > 0 && njobs <= BURST_MAX_JOBS);
+    const size_t keylen = jobs[0]->keylen;
+    const size_t rounds = (keylen == 128) ? 10 : 14;
+    const size_t n = 16 * njobs;
+
+    // Sort by decreasing length (insertion sort, bursts are small).
+    for (size_t i = 1; i < njobs; i++) {
+        struct aes_gcm_job* const job = jobs[i];
+        size_t j = i;
+        for (; j > 0 && jobs[j - 1]->len < job->len; j--) {
+            jobs[j] = jobs[j - 1];
+        }
+        jobs[j] = job;
+    }
+
+    // Expand the keys, and lay them out round-major.
+    for (size_t i = 0; i < njobs; i++) {
+        assert(jobs[i]->keylen == keylen);
+        struct expanded_key key;
+        expand_key(&key, jobs[i]->key, keylen);
+        for (size_t r = 0; r <= rounds; r++) {
+            memcpy(&round_keys[(r * njobs + i) * 4], &key.expanded[4 * r], 16);
+        }
+        secure_wipe(&key, sizeof(key));
+    }
+
+    // H = ENC_K(0), for all keys at once. The counters are zero, their
+    // increments are discarded.
+    bzero(in, n);
+    bzero(counters, n);
+    zvkned_aes_ctr32_multikey_vv_lmul4(
+        H, in, counters, n, round_keys, n, rounds);
+
+    // Initial counter blocks, followed by ENC_K(J0) which is used later
+    // to compute the tags. The kernel leaves the counters at inc32(J0),
+    // i.e., the first counter block used to encrypt the text.
+    for (size_t i = 0; i < njobs; i++) {
+        counters[i] =
+            zvkg_initial_counter_block(H[i], jobs[i]->iv, jobs[i]->ivlen);
+    }
+    zvkned_aes_ctr32_multikey_vv_lmul4(
+        EJ0, in, counters, n, round_keys, n, rounds);
+
+    // Additional Authenticated Data (AAD)
+    //
+    // AADs are right-aligned: a message with fewer AAD blocks is fed
+    // leading zero blocks, which leave its (zero) hash value unchanged.
+    // All the lanes can then be processed until the very last block.
+    bzero(Y, n);
+    size_t max_aad_blocks = 0;
+    for (size_t i = 0; i < njobs; i++) {
+        max_aad_blocks = MAX(max_aad_blocks, (jobs[i]->aadlen + 15) / 16);
+    }
+    for (size_t b = 0; b < max_aad_blocks; b++) {
+        for (size_t i = 0; i < njobs; i++) {
+            const size_t blocks = (jobs[i]->aadlen + 15) / 16;
+            const size_t skip = max_aad_blocks - blocks;
+            if (b < skip) {
+                bzero(&in[i], sizeof(in[i]));
+            } else {
+                burst_load_block(&in[i], jobs[i]->aad, jobs[i]->aadlen, b - skip);
+            }
+        }
+        zvkg_vghsh_multi_vv(Y, in, H, n);
+    }
+
+    // Text, lanes still active at block 'b' form a prefix since
+    // the jobs are sorted by decreasing length.
+    const size_t max_blocks = (jobs[0]->len + 15) / 16;
+    size_t active = njobs;
+    for (size_t b = 0; b < max_blocks; b++) {
+        while (16 * b >= jobs[active - 1]->len) {
+            active--;
+        }
+        for (size_t i = 0; i < active; i++) {
+            burst_load_block(&in[i], jobs[i]->in, jobs[i]->len, b);
+        }
+        zvkned_aes_ctr32_multikey_vv_lmul4(
+            out, in, counters, 16 * active, round_keys, n, rounds);
+
+        for (size_t i = 0; i < active; i++) {
+            const size_t len = MIN(16, jobs[i]->len - 16 * b);
+            memcpy(&jobs[i]->out[16 * b], &out[i], len);
+            // GHASH operates on the zero-padded cipher text.
+            if (len < 16) {
+                bzero(&out[i].bytes[len], 16 - len);
+            }
+        }
+        zvkg_vghsh_multi_vv(Y, encrypt ? out : in, H, 16 * active);
+    }
+
+    // "Lengths block", len(AA)_64 || len(C)_64
+    for (size_t i = 0; i < njobs; i++) {
+        in[i].dwords[0] = __builtin_bswap64(8 * jobs[i]->aadlen);
+        in[i].dwords[1] = __builtin_bswap64(8 * jobs[i]->len);
+    }
+    zvkg_vghsh_multi_vv(Y, in, H, n);
+
+    //  T = MSB(GHASH(H,A,C) xor E(K,Y0))
+    for (size_t i = 0; i < njobs; i++) {
+        struct aes_gcm_job* const job = jobs[i];
+        uint128 tag = EJ0[i];
+        tag.dwords[0] ^= Y[i].dwords[0];
+        tag.dwords[1] ^= Y[i].dwords[1];
+
+        assert(job->taglen <= sizeof(tag));
+        if (encrypt) {
+            memcpy(job->tag, &tag, job->taglen);
+            job->status = 0;
+        } else {
+            // Constant time comparison.
+            uint8_t diff = 0;
+            for (size_t b = 0; b < job->taglen; b++) {
+                diff |= tag.bytes[b] ^ job->tag[b];
+            }
+            job->status = diff == 0 ? 0 : -1;
+            if (job->status != 0) {
+                bzero(job->out, job->len);
+            }
+        }
+    }
+
+    secure_wipe(round_keys, sizeof(round_keys));
+}
+
+// Seals (encrypt == true) or opens (encrypt == false) all the given jobs.
+// Jobs are grouped by key length, and processed in batches of up to
+// BURST_MAX_JOBS jobs. Jobs with other key lengths fail with status -1.
+static void
+aes_gcm_burst(struct aes_gcm_job* jobs, size_t njobs, bool encrypt)
+{
+    static const size_t keylens[] = { 128, 256 };
+
+    for (size_t i = 0; i < njobs; i++) {
+        if (jobs[i].keylen != 128 && jobs[i].keylen != 256) {
+            jobs[i].status = -1;
+            bzero(jobs[i].out, jobs[i].len);
+        }
+    }
+
+    for (size_t k = 0; k < sizeof(keylens) / sizeof(*keylens); k++) {
+        struct aes_gcm_job* batch[BURST_MAX_JOBS];
+        size_t count = 0;
+
+        for (size_t i = 0; i < njobs; i++) {
+            if (jobs[i].keylen != keylens[k]) {
+                continue;
+            }
+            batch[count++] = &jobs[i];
+            if (count == BURST_MAX_JOBS) {
+                aes_gcm_burst_batch(batch, count, encrypt);
+                count = 0;
+            }
+        }
+        if (count > 0) {
+            aes_gcm_burst_batch(batch, count, encrypt);
+        }
+    }
+}
+
+// Runs the given tests, which should all be either encryption or
+// decryption tests, through the burst API, BURST_MAX_JOBS at a time.
+static int
+run_tests_burst(const struct aes_gcm_test* tests, size_t count, size_t keylen)
+{
+    __attribute__((aligned(16)))
+    static uint8_t bufs[BURST_MAX_JOBS][1024];
+    struct aes_gcm_job jobs[BURST_MAX_JOBS];
+
+    for (size_t first = 0; first < count; first += BURST_MAX_JOBS) {
+        const size_t njobs = MIN(BURST_MAX_JOBS, count - first);
+        const bool encrypt = tests[first].encrypt;
+
+        for (size_t i = 0; i < njobs; i++) {
+            const struct aes_gcm_test* const test = &tests[first + i];
+            struct aes_gcm_job* const job = &jobs[i];
+
+            assert(test->encrypt == encrypt);
+            assert(test->ctlen < sizeof(bufs[i]));
+            job->key = test->key;
+            job->keylen = keylen;
+            job->iv = test->iv;
+            job->ivlen = test->ivlen;
+            job->aad = test->aad;
+            job->aadlen = test->aadlen;
+            job->in = encrypt ? test->pt : test->ct;
+            job->out = bufs[i];
+            job->len = test->ctlen;
+            job->taglen = test->taglen;
+            if (!encrypt) {
+                memcpy(job->tag, test->tag, test->taglen);
+            }
+        }
+
+        aes_gcm_burst(jobs, njobs, encrypt);
+
+        for (size_t i = 0; i < njobs; i++) {
+            const struct aes_gcm_test* const test = &tests[first + i];
+            const struct aes_gcm_job* const job = &jobs[i];
+
+            int rc;
+            if (encrypt) {
+                rc = memcmp(job->tag, test->tag, test->taglen);
+            } else {
+                rc = job->status;
+            }
+            if ((!!rc) != test->expect_fail) {
+                printf("\nTag mismatch in burst, test #%zu\n", first + i);
+                return 1;
+            }
+            if (test->pt == NULL || test->expect_fail) {
+                continue;
+            }
+            rc = memcmp(job->out, encrypt ? test->ct : test->pt, test->ctlen);
+            if (rc != 0) {
+                printf("\nText mismatch in burst, test #%zu\n", first + i);
+                return rc;
+            }
+        }
+    }
+    return 0;
+}
+
+//
+// GMAC (Authentication Only) Implementation
+//
+// GMAC is GCM without any text: only the AAD is authenticated. The single
+// block encryption needed is E(K,J0). The AAD is hashed with the aggregated
+// GHASH kernel, which processes one block per element group, given
+// precomputed powers of H.
+//
+
+// Number of powers of H precomputed at key setup. The aggregated GHASH
+// kernel uses min(VLEN/32, GHASH_TABLE_SIZE) lanes.
+#define GHASH_TABLE_SIZE 16
+
+struct aes_gmac_key {
+    struct expanded_key key;
+    uint128 H;
+    // Htable[i] = H^(GHASH_TABLE_SIZE - i), i.e., H^1 is the last entry.
+    uint128 Htable[GHASH_TABLE_SIZE];
+};
+
+static void
+aes_gmac_init(struct aes_gmac_key* ctx, const uint8_t* key, size_t keylen)
+{
+    expand_key(&ctx->key, key, keylen);
+    ctx->H = compute_h(&ctx->key);
+
+    uint128 power = ctx->H;
+    for (size_t i = 1; i <= GHASH_TABLE_SIZE; i++) {
+        ctx->Htable[GHASH_TABLE_SIZE - i] = power;
+        zvkg_vgmul(&power, &ctx->H);
+    }
+}
+
+// Computes the GMAC tag of 'aad' into 'tag', with 1 <= taglen <= 16.
+static void
+aes_gmac(
+    const struct aes_gmac_key* ctx,
+    const uint8_t* iv,
+    size_t ivlen,
+    const uint8_t* aad,
+    size_t aadlen,
+    uint8_t* tag,
+    size_t taglen
+)
+{
+    assert(taglen <= 16);
+    const uint128 ICB = zvkg_initial_counter_block(ctx->H, iv, ivlen);
+
+    // Full blocks, then the trailing partial block padded with 0s if any.
+    uint128 X = {};
+    const size_t full_bytes = aadlen & ~(size_t)15;
+    zvkg_ghash_aggregated_lmul4(&X, aad, full_bytes,
+                                ctx->Htable, GHASH_TABLE_SIZE);
+    if (full_bytes != aadlen) {
+        uint128 block = {};
+        memcpy(&block, aad + full_bytes, aadlen - full_bytes);
+        X = vghsh(X, block, ctx->H);
+    }
+
+    // "Lengths block", len(AA)_64 || 0_64
+    if (aadlen != 0) {
+        uint128 lengths;
+        lengths.dwords[0] = __builtin_bswap64(8 * aadlen);
+        lengths.dwords[1] = 0;
+        X = vghsh(X, lengths, ctx->H);
+    }
+
+    //  T = MSB(GHASH(H,A,{}) xor E(K,Y0))
+    uint128 T;
+    encrypt_block(&T, &ICB, &ctx->key);
+    T.dwords[0] ^= X.dwords[0];
+    T.dwords[1] ^= X.dwords[1];
+    memcpy(tag, &T, taglen);
+}
+
+// Runs the given test through the GMAC API. Only applicable to tests
+// without text.
+static int
+run_test_gmac(const struct aes_gcm_test* test, int keylen)
+{
+    assert(test->ctlen == 0);
+
+    struct aes_gmac_key ctx;
+    aes_gmac_init(&ctx, test->key, keylen);
+
+    uint8_t tag[16];
+    aes_gmac(&ctx, test->iv, test->ivlen, test->aad, test->aadlen,
+             tag, test->taglen);
+
+    const int rc = memcmp(tag, test->tag, test->taglen);
+    return (!!rc) != test->expect_fail;
+}
+
+// Checks the aggregated GHASH against the block by block GHASH on AAD
+// lengths exceeding the ones found in the test vectors, covering multiple
+// chunks for every supported VLEN.
+static int
+run_gmac_long_aad_tests(void)
+{
+    static uint8_t aad[1031];
+    for (size_t i = 0; i < sizeof(aad); i++) {
+        aad[i] = (uint8_t)(i * 131 + 7);
+    }
+
+    struct aes_gmac_key ctx;
+    aes_gmac_init(&ctx, tc4Test.key, 128);
+
+    for (size_t aadlen = 0; aadlen <= sizeof(aad); aadlen += 17) {
+        uint8_t tag[16];
+        aes_gmac(&ctx, tc4Iv, sizeof(tc4Iv), aad, aadlen, tag, sizeof(tag));
+
+        // Reference, using one vghsh per block.
+        uint128 X = {};
+        for (size_t off = 0; off < aadlen; off += 16) {
+            uint128 block = {};
+            memcpy(&block, &aad[off], MIN(16, aadlen - off));
+            X = vghsh(X, block, ctx.H);
+        }
+        if (aadlen != 0) {
+            uint128 lengths;
+            lengths.dwords[0] = __builtin_bswap64(8 * aadlen);
+            lengths.dwords[1] = 0;
+            X = vghsh(X, lengths, ctx.H);
+        }
+        const uint128 ICB =
+            zvkg_initial_counter_block(ctx.H, tc4Iv, sizeof(tc4Iv));
+        uint128 expected;
+        encrypt_block(&expected, &ICB, &ctx.key);
+        expected.dwords[0] ^= X.dwords[0];
+        expected.dwords[1] ^= X.dwords[1];
+
+        if (memcmp(tag, &expected, sizeof(tag)) != 0) {
+            printf("\nGMAC mismatch, aadlen %zu\n", aadlen);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+//
+// Parallel (Multi-Threaded) Single Message Implementation
+//
+// A single large message is split into chunks processed by separate
+// threads. CTR encryption splits trivially: chunk 'c' starting at block
+// 'b' uses the counter blocks inc32^(1+b)(J0) onwards. GHASH is linear,
+// and for chunks C_0, ..., C_{m-1} of n_0, ..., n_{m-1} blocks,
+//   GHASH(A || C_0 || ... || C_{m-1})
+//     = (...((GHASH(A) o H^n_0 + GHASH(C_0)) o H^n_1 + GHASH(C_1))...)
+// where GHASH(C_i) is computed independently by each thread, starting
+// from 0. The tag is thus identical to the one of the serial computation.
+//
+// The key context (expanded key and powers of H) is the one used for GMAC.
+//
+// When threads cannot be created (e.g., under riscv-pk which does not
+// support them), the chunks are processed sequentially by the caller.
+
+// Maximum number of threads (and chunks) used for a single message.
+#define GCM_PARALLEL_MAX_THREADS 16
+
+struct gcm_chunk {
+    const struct aes_gmac_key* ctx;
+    const uint8_t* in;
+    uint8_t* out;
+    // Only the last chunk may have a length that is not a multiple of 16.
+    size_t len;
+    bool encrypt;
+    // First counter block of the chunk.
+    uint128 counter_block;
+    // GHASH of the chunk's cipher text, starting from 0.
+    uint128 X;
+};
+
+// H^e, using square-and-multiply.
+static uint128
+ghash_power(uint128 H, size_t e)
+{
+    // H^0 = 1, which is represented by a 1 in the most significant bit
+    // of the first byte (GCM's bit-reflected representation).
+    uint128 result = {};
+    result.bytes[0] = 0x80;
+    while (e != 0) {
+        if (e & 1) {
+            zvkg_vgmul(&result, &H);
+        }
+        zvkg_vgmul(&H, &H);
+        e >>= 1;
+    }
+    return result;
+}
+
+// Applies GHASH to 'len' bytes of data, updating X. The trailing partial
+// block, if any, is padded with 0s.
+static void
+ghash_update(
+    const struct aes_gmac_key* ctx,
+    uint128* X,
+    const uint8_t* data,
+    size_t len
+)
+{
+    const size_t full_bytes = len & ~(size_t)15;
+    zvkg_ghash_aggregated_lmul4(X, data, full_bytes,
+                                ctx->Htable, GHASH_TABLE_SIZE);
+    if (full_bytes != len) {
+        uint128 block = {};
+        memcpy(&block, data + full_bytes, len - full_bytes);
+        *X = vghsh(*X, block, ctx->H);
+    }
+}
+
+// CTR encryption (or decryption) of 'len' bytes, starting with the given
+// counter block, which is updated to the next unused one.
+static void
+ctr_crypt(
+    const struct aes_gmac_key* ctx,
+    uint128* counter_block,
+    uint8_t* out,
+    const uint8_t* in,
+    size_t len
+)
+{
+    const size_t full_bytes = len & ~(size_t)15;
+    switch (ctx->key.keylen) {
+      case 128:
+        zvkned_aes128_ctr32_vs_lmul4(out, in, full_bytes,
+                                     ctx->key.expanded, counter_block);
+        break;
+      case 256:
+        zvkned_aes256_ctr32_vs_lmul4(out, in, full_bytes,
+                                     ctx->key.expanded, counter_block);
+        break;
+      default:
+        LOG("Invalid keylen %zu", ctx->key.keylen);
+        assert(false);
+    }
+
+    if (full_bytes != len) {
+        uint128 keystream;
+        encrypt_block(&keystream, counter_block, &ctx->key);
+        increment_counter_block(counter_block);
+        for (size_t i = full_bytes; i < len; i++) {
+            out[i] = in[i] ^ keystream.bytes[i - full_bytes];
+        }
+    }
+}
+
+static void*
+gcm_chunk_worker(void* arg)
+{
+    struct gcm_chunk* const chunk = arg;
+    uint128 counter_block = chunk->counter_block;
+    uint128 X = {};
+
+    // The cipher text is the input when decrypting. Hashing it first
+    // allows for in-place operation.
+    if (chunk->encrypt) {
+        ctr_crypt(chunk->ctx, &counter_block, chunk->out, chunk->in,
+                  chunk->len);
+        ghash_update(chunk->ctx, &X, chunk->out, chunk->len);
+    } else {
+        ghash_update(chunk->ctx, &X, chunk->in, chunk->len);
+        ctr_crypt(chunk->ctx, &counter_block, chunk->out, chunk->in,
+                  chunk->len);
+    }
+
+    chunk->X = X;
+    return NULL;
+}
+
+// Computes the full 128b tag, given the GHASH of the AAD and text (X).
+//  T = GHASH(H,A,C) xor E(K,Y0)
+static void
+gcm_final_tag(
+    const struct aes_gmac_key* ctx,
+    const uint128* ICB,
+    uint128 X,
+    size_t aadlen,
+    size_t len,
+    uint128* tag
+)
+{
+    // "Lengths block", len(AA)_64 || len(C)_64
+    if (aadlen != 0 || len != 0) {
+        uint128 lengths;
+        lengths.dwords[0] = __builtin_bswap64(8 * aadlen);
+        lengths.dwords[1] = __builtin_bswap64(8 * len);
+        X = vghsh(X, lengths, ctx->H);
+    }
+
+    encrypt_block(tag, ICB, &ctx->key);
+    tag->dwords[0] ^= X.dwords[0];
+    tag->dwords[1] ^= X.dwords[1];
+}
+
+// Encrypts (resp. decrypts) 'len' bytes from 'in' into 'out' using up to
+// 'nthreads' threads, and computes the full 128b tag.
+static void
+aes_gcm_parallel_crypt(
+    const struct aes_gmac_key* ctx,
+    const uint8_t* iv,
+    size_t ivlen,
+    const uint8_t* aad,
+    size_t aadlen,
+    const uint8_t* in,
+    uint8_t* out,
+    size_t len,
+    bool encrypt,
+    size_t nthreads,
+    uint128* tag
+)
+{
+    struct gcm_chunk chunks[GCM_PARALLEL_MAX_THREADS];
+    pthread_t threads[GCM_PARALLEL_MAX_THREADS];
+    bool spawned[GCM_PARALLEL_MAX_THREADS] = {};
+
+    assert(nthreads >= 1 && nthreads <= GCM_PARALLEL_MAX_THREADS);
+
+    const uint128 ICB = zvkg_initial_counter_block(ctx->H, iv, ivlen);
+
+    // Split the text in chunks of whole blocks.
+    const size_t nblocks = (len + 15) / 16;
+    const size_t chunk_blocks = MAX(1, (nblocks + nthreads - 1) / nthreads);
+    size_t nchunks = 0;
+    for (size_t first = 0; first < nblocks; first += chunk_blocks) {
+        struct gcm_chunk* const chunk = &chunks[nchunks];
+        const size_t offset = 16 * first;
+
+        chunk->ctx = ctx;
+        chunk->in = in + offset;
+        chunk->out = out + offset;
+        chunk->len = MIN(16 * chunk_blocks, len - offset);
+        chunk->encrypt = encrypt;
+        chunk->counter_block = ICB;
+        const uint32_t counter = __builtin_bswap32(ICB.words[3]);
+        chunk->counter_block.words[3] =
+            __builtin_bswap32(counter + 1 + (uint32_t)first);
+
+        spawned[nchunks] = (nchunks != 0) &&
+            pthread_create(&threads[nchunks], NULL, gcm_chunk_worker,
+                           chunk) == 0;
+        nchunks++;
+    }
+    // The calling thread processes the first chunk, and the chunks
+    // for which no thread could be created.
+    for (size_t c = 0; c < nchunks; c++) {
+        if (!spawned[c]) {
+            gcm_chunk_worker(&chunks[c]);
+        }
+    }
+
+    // GHASH(A)
+    uint128 X = {};
+    ghash_update(ctx, &X, aad, aadlen);
+
+    // Combine the chunks' hashes, in order.
+    for (size_t c = 0; c < nchunks; c++) {
+        if (spawned[c]) {
+            pthread_join(threads[c], NULL);
+        }
+        const uint128 Hn = ghash_power(ctx->H, (chunks[c].len + 15) / 16);
+        zvkg_vgmul(&X, &Hn);
+        X.dwords[0] ^= chunks[c].X.dwords[0];
+        X.dwords[1] ^= chunks[c].X.dwords[1];
+    }
+
+    gcm_final_tag(ctx, &ICB, X, aadlen, len, tag);
+}
+
+static void
+aes_gcm_parallel_seal(
+    const struct aes_gmac_key* ctx,
+    const uint8_t* iv,
+    size_t ivlen,
+    const uint8_t* aad,
+    size_t aadlen,
+    const uint8_t* pt,
+    uint8_t* ct,
+    size_t len,
+    uint8_t* tag,
+    size_t taglen,
+    size_t nthreads
+)
+{
+    uint128 T;
+    assert(taglen <= sizeof(T));
+    aes_gcm_parallel_crypt(ctx, iv, ivlen, aad, aadlen, pt, ct, len,
+                           true, nthreads, &T);
+    memcpy(tag, &T, taglen);
+}
+
+// Returns 0 if the tag matches, in which case 'pt' holds the plain text.
+// Otherwise 'pt' is zeroed and -1 is returned.
+static int
+aes_gcm_parallel_open(
+    const struct aes_gmac_key* ctx,
+    const uint8_t* iv,
+    size_t ivlen,
+    const uint8_t* aad,
+    size_t aadlen,
+    const uint8_t* ct,
+    uint8_t* pt,
+    size_t len,
+    const uint8_t* tag,
+    size_t taglen,
+    size_t nthreads
+)
+{
+    uint128 T;
+    assert(taglen <= sizeof(T));
+    aes_gcm_parallel_crypt(ctx, iv, ivlen, aad, aadlen, ct, pt, len,
+                           false, nthreads, &T);
+
+    uint8_t diff = 0;
+    for (size_t i = 0; i < taglen; i++) {
+        diff |= T.bytes[i] ^ tag[i];
+    }
+    if (diff != 0) {
+        memset(pt, 0, len);
+        return -1;
+    }
+    return 0;
+}
+
+// Runs the given test through the parallel API, using 'nthreads' threads.
+static int
+run_test_parallel(const struct aes_gcm_test* test, int keylen, size_t nthreads)
+{
+    __attribute__((aligned(16)))
+    uint8_t buf[1024];
+
+    assert(test->ctlen < sizeof(buf));
+
+    struct aes_gmac_key ctx;
+    aes_gmac_init(&ctx, test->key, keylen);
+
+    int rc;
+    if (test->encrypt) {
+        uint8_t tag[16];
+        aes_gcm_parallel_seal(&ctx, test->iv, test->ivlen,
+                              test->aad, test->aadlen,
+                              test->pt, buf, test->ctlen,
+                              tag, test->taglen, nthreads);
+        rc = memcmp(tag, test->tag, test->taglen);
+    } else {
+        rc = aes_gcm_parallel_open(&ctx, test->iv, test->ivlen,
+                                   test->aad, test->aadlen,
+                                   test->ct, buf, test->ctlen,
+                                   test->tag, test->taglen, nthreads);
+    }
+    if ((!!rc) != test->expect_fail) {
+        printf("\nTag mismatch (parallel, %zu threads)\n", nthreads);
+        return 1;
+    }
+    if (test->pt == NULL || test->expect_fail) {
+        return 0;
+    }
+    rc = memcmp(buf, test->encrypt ? test->ct : test->pt, test->ctlen);
+    if (rc != 0) {
+        printf("\nText mismatch (parallel, %zu threads)\n", nthreads);
+    }
+    return rc;
+}
+
+// Checks that messages larger than the ones in the test vectors produce
+// the same output and tag regardless of the number of threads, and that
+// they can be opened.
+static int
+run_parallel_long_message_tests(void)
+{
+    static uint8_t pt[4099];
+    static uint8_t ct[sizeof(pt)];
+    static uint8_t ct1[sizeof(pt)];
+    static uint8_t out[sizeof(pt)];
+    for (size_t i = 0; i < sizeof(pt); i++) {
+        pt[i] = (uint8_t)(i * 151 + 3);
+    }
+
+    struct aes_gmac_key ctx;
+    aes_gmac_init(&ctx, tc4Test.key, 128);
+
+    const size_t lens[] = { 0, 15, 16, 1000, 4096, sizeof(pt) };
+    for (size_t l = 0; l < sizeof(lens) / sizeof(*lens); l++) {
+        const size_t len = lens[l];
+        uint8_t tag1[16];
+        aes_gcm_parallel_seal(&ctx, tc4Iv, sizeof(tc4Iv),
+                              tc4Aad, sizeof(tc4Aad), pt, ct1, len,
+                              tag1, sizeof(tag1), 1);
+
+        for (size_t nthreads = 2; nthreads <= 7; nthreads++) {
+            uint8_t tag[16];
+            aes_gcm_parallel_seal(&ctx, tc4Iv, sizeof(tc4Iv),
+                                  tc4Aad, sizeof(tc4Aad), pt, ct, len,
+                                  tag, sizeof(tag), nthreads);
+            if (memcmp(tag, tag1, sizeof(tag)) != 0 ||
+                memcmp(ct, ct1, len) != 0) {
+                printf("\nParallel mismatch, len %zu, %zu threads\n",
+                       len, nthreads);
+                return 1;
+            }
+
+            int rc = aes_gcm_parallel_open(&ctx, tc4Iv, sizeof(tc4Iv),
+                                           tc4Aad, sizeof(tc4Aad), ct, out,
+                                           len, tag, sizeof(tag), nthreads);
+            if (rc != 0 || memcmp(out, pt, len) != 0) {
+                printf("\nParallel open failed, len %zu, %zu threads\n",
+                       len, nthreads);
+                return 1;
+            }
+
+            tag[nthreads % sizeof(tag)] ^= 1;
+            rc = aes_gcm_parallel_open(&ctx, tc4Iv, sizeof(tc4Iv),
+                                       tc4Aad, sizeof(tc4Aad), ct, out,
+                                       len, tag, sizeof(tag), nthreads);
+            if (rc == 0) {
+                printf("\nParallel open accepted a bad tag, len %zu\n", len);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+//
+// Key Rotation (Re-Encryption) Implementation
+//
+// Re-encrypts a message sealed under an old key (and IV, AAD) into a message
+// sealed under a new key, in a single pass over the data. The text is
+// processed in tiles small enough to stay in the L1 cache: each tile is
+// hashed (old GHASH), decrypted into a local buffer, re-encrypted, and
+// hashed again (new GHASH) before moving to the next tile. The data is thus
+// read and written once, instead of twice with a decryption pass followed
+// by an encryption pass. The plain text only ever lives in the tile buffer,
+// which is wiped before returning.
+//
+// The old tag can only be verified once all the tiles have been processed.
+// On verification failure the new tag is zeroed, and so is the output,
+// unless the re-encryption is done in place: the old cipher text is then
+// restored, by applying the new then the old key stream again, so that a
+// corrupted message, or wrong old parameters, never destroy the only copy
+// of the data.
+//
+
+// Tile size, in bytes, a multiple of 16.
+#define REENCRYPT_TILE_BYTES 4096
+
+// Parameters of a GCM message, besides its text and tag.
+struct aes_gcm_message {
+    const struct aes_gmac_key* ctx;
+    const uint8_t* iv;
+    size_t ivlen;
+    const uint8_t* aad;
+    size_t aadlen;
+};
+
+// Returns 0 on success, with the new cipher text in 'out' and the new tag
+// in 'new_tag'. Returns -1 if the old tag does not match. 'out' may be
+// equal to 'in', in which case 'in' is left unchanged on failure.
+static int
+aes_gcm_reencrypt(
+    const struct aes_gcm_message* old_msg,
+    const uint8_t* old_tag,
+    size_t old_taglen,
+    const struct aes_gcm_message* new_msg,
+    uint8_t* new_tag,
+    size_t new_taglen,
+    const uint8_t* in,
+    uint8_t* out,
+    size_t len
+)
+{
+    __attribute__((aligned(16)))
+    uint8_t tile[REENCRYPT_TILE_BYTES];
+
+    const struct aes_gmac_key* const old_ctx = old_msg->ctx;
+    const struct aes_gmac_key* const new_ctx = new_msg->ctx;
+    assert(old_taglen >= 1 && old_taglen <= 16);
+    assert(new_taglen >= 1 && new_taglen <= 16);
+
+    const uint128 old_ICB = zvkg_initial_counter_block(
+        old_ctx->H, old_msg->iv, old_msg->ivlen);
+    const uint128 new_ICB = zvkg_initial_counter_block(
+        new_ctx->H, new_msg->iv, new_msg->ivlen);
+    uint128 old_cb = old_ICB;
+    uint128 new_cb = new_ICB;
+    increment_counter_block(&old_cb);
+    increment_counter_block(&new_cb);
+
+    uint128 old_X = {};
+    uint128 new_X = {};
+    ghash_update(old_ctx, &old_X, old_msg->aad, old_msg->aadlen);
+    ghash_update(new_ctx, &new_X, new_msg->aad, new_msg->aadlen);
+
+    for (size_t offset = 0; offset < len; offset += REENCRYPT_TILE_BYTES) {
+        const size_t n = MIN(REENCRYPT_TILE_BYTES, len - offset);
+        ghash_update(old_ctx, &old_X, in + offset, n);
+        ctr_crypt(old_ctx, &old_cb, tile, in + offset, n);
+        ctr_crypt(new_ctx, &new_cb, out + offset, tile, n);
+        ghash_update(new_ctx, &new_X, out + offset, n);
+    }
+
+    uint128 T;
+    gcm_final_tag(old_ctx, &old_ICB, old_X, old_msg->aadlen, len, &T);
+    uint8_t diff = 0;
+    for (size_t i = 0; i < old_taglen; i++) {
+        diff |= T.bytes[i] ^ old_tag[i];
+    }
+    if (diff != 0) {
+        if (out == in) {
+            old_cb = old_ICB;
+            new_cb = new_ICB;
+            increment_counter_block(&old_cb);
+            increment_counter_block(&new_cb);
+            for (size_t offset = 0; offset < len;
+                 offset += REENCRYPT_TILE_BYTES) {
+                const size_t n = MIN(REENCRYPT_TILE_BYTES, len - offset);
+                ctr_crypt(new_ctx, &new_cb, tile, out + offset, n);
+                ctr_crypt(old_ctx, &old_cb, out + offset, tile, n);
+            }
+        } else {
+            memset(out, 0, len);
+        }
+        secure_wipe(tile, sizeof(tile));
+        memset(new_tag, 0, new_taglen);
+        return -1;
+    }
+    secure_wipe(tile, sizeof(tile));
+
+    gcm_final_tag(new_ctx, &new_ICB, new_X, new_msg->aadlen, len, &T);
+    memcpy(new_tag, &T, new_taglen);
+    return 0;
+}
+
+// Re-encrypts the test's cipher text under a new key and IV, and checks
+// the result against sealing the plain text under those directly.
+static int
+run_test_reencrypt(const struct aes_gcm_test* test, int keylen)
+{
+    __attribute__((aligned(16)))
+    uint8_t buf[1024];
+    __attribute__((aligned(16)))
+    uint8_t expected[1024];
+
+    assert(test->ctlen < sizeof(buf));
+
+    struct aes_gmac_key old_ctx;
+    struct aes_gmac_key new_ctx;
+    uint8_t new_key[32];
+    for (size_t i = 0; i < sizeof(new_key); i++) {
+        new_key[i] = test->key[sizeof(new_key) - 1 - i] ^ 0x5c;
+    }
+    aes_gmac_init(&old_ctx, test->key, keylen);
+    aes_gmac_init(&new_ctx, new_key, keylen);
+
+    const struct aes_gcm_message old_msg = {
+        &old_ctx, test->iv, test->ivlen, test->aad, test->aadlen,
+    };
+    const struct aes_gcm_message new_msg = {
+        &new_ctx, tc4Iv, sizeof(tc4Iv), tc4Aad, sizeof(tc4Aad),
+    };
+
+    uint8_t new_tag[16];
+    const int rc = aes_gcm_reencrypt(&old_msg, test->tag, test->taglen,
+                                     &new_msg, new_tag, sizeof(new_tag),
+                                     test->ct, buf, test->ctlen);
+    if ((rc != 0) != test->expect_fail) {
+        printf("\nTag mismatch (re-encryption)\n");
+        return 1;
+    }
+    if (test->expect_fail || test->pt == NULL) {
+        return 0;
+    }
+
+    uint8_t expected_tag[16];
+    aes_gcm_parallel_seal(&new_ctx, tc4Iv, sizeof(tc4Iv),
+                          tc4Aad, sizeof(tc4Aad), test->pt, expected,
+                          test->ctlen, expected_tag, sizeof(expected_tag), 1);
+    if (memcmp(new_tag, expected_tag, sizeof(new_tag)) != 0 ||
+        memcmp(buf, expected, test->ctlen) != 0) {
+        printf("\nRe-encryption mismatch\n");
+        return 1;
+    }
+    return 0;
+}
+
+// Re-encrypts, in place, messages spanning multiple tiles.
+static int
+run_reencrypt_long_message_tests(void)
+{
+    static uint8_t pt[3 * REENCRYPT_TILE_BYTES + 21];
+    static uint8_t buf[sizeof(pt)];
+    static uint8_t out[sizeof(pt)];
+    for (size_t i = 0; i < sizeof(pt); i++) {
+        pt[i] = (uint8_t)(i * 167 + 11);
+    }
+
+    struct aes_gmac_key old_ctx;
+    struct aes_gmac_key new_ctx;
+    aes_gmac_init(&old_ctx, tc4Test.key, 128);
+    aes_gmac_init(&new_ctx, gcm_suites[0].tests[0].key, 128);
+    const struct aes_gcm_message old_msg = {
+        &old_ctx, tc4Iv, sizeof(tc4Iv), tc4Aad, sizeof(tc4Aad),
+    };
+    const struct aes_gcm_message new_msg = {
+        &new_ctx, tc1Iv, sizeof(tc1Iv), NULL, 0,
+    };
+
+    const size_t lens[] = {
+        REENCRYPT_TILE_BYTES - 1, 2 * REENCRYPT_TILE_BYTES, sizeof(pt),
+    };
+    for (size_t l = 0; l < sizeof(lens) / sizeof(*lens); l++) {
+        const size_t len = lens[l];
+        uint8_t old_tag[16];
+        uint8_t new_tag[16];
+
+        aes_gcm_parallel_seal(&old_ctx, tc4Iv, sizeof(tc4Iv),
+                              tc4Aad, sizeof(tc4Aad), pt, buf, len,
+                              old_tag, sizeof(old_tag), 1);
+        int rc = aes_gcm_reencrypt(&old_msg, old_tag, sizeof(old_tag),
+                                   &new_msg, new_tag, sizeof(new_tag),
+                                   buf, buf, len);
+        if (rc != 0) {
+            printf("\nRe-encryption failed, len %zu\n", len);
+            return 1;
+        }
+        rc = aes_gcm_parallel_open(&new_ctx, tc1Iv, sizeof(tc1Iv),
+                                   NULL, 0, buf, out, len,
+                                   new_tag, sizeof(new_tag), 1);
+        if (rc != 0 || memcmp(out, pt, len) != 0) {
+            printf("\nRe-encrypted message mismatch, len %zu\n", len);
+            return 1;
+        }
+
+        // Tampering with the last tile must be detected.
+        aes_gcm_parallel_seal(&old_ctx, tc4Iv, sizeof(tc4Iv),
+                              tc4Aad, sizeof(tc4Aad), pt, buf, len,
+                              old_tag, sizeof(old_tag), 1);
+        buf[len - 1] ^= 0x80;
+        rc = aes_gcm_reencrypt(&old_msg, old_tag, sizeof(old_tag),
+                               &new_msg, new_tag, sizeof(new_tag),
+                               buf, out, len);
+        if (rc == 0) {
+            printf("\nRe-encryption accepted a bad message, len %zu\n", len);
+            return 1;
+        }
+
+        // In place, a failure must leave the old cipher text intact.
+        memcpy(out, buf, len);
+        rc = aes_gcm_reencrypt(&old_msg, old_tag, sizeof(old_tag),
+                               &new_msg, new_tag, sizeof(new_tag),
+                               buf, buf, len);
+        if (rc == 0 || memcmp(buf, out, len) != 0) {
+            printf("\nIn place re-encryption failure lost the data, len %zu\n",
+                   len);
+            return 1;
+        }
+    }
+    return 0;
+}
+
 // ----------------------------------------------------------------------
 
 static void
@@ -807,6 +1871,38 @@ run_testcase(
         }
         DLOG("Success");
     }
+
+    {
+        LOG("--- Running %s (#%zu) test against parallel GCM... ",
+            name, test_idx);
+        const int rc = run_test_parallel(test, keylen, 4);
+        if (rc != 0) {
+            printf("Test '%s' (#%zu) failed (%d)\n", name, test_idx, rc);
+            exit(1);
+        }
+        DLOG("Success");
+    }
+
+    {
+        LOG("--- Running %s (#%zu) test against re-encryption... ",
+            name, test_idx);
+        const int rc = run_test_reencrypt(test, keylen);
+        if (rc != 0) {
+            printf("Test '%s' (#%zu) failed (%d)\n", name, test_idx, rc);
+            exit(1);
+        }
+        DLOG("Success");
+    }
+
+    if (test->ctlen == 0) {
+        LOG("--- Running %s (#%zu) test against GMAC... ", name, test_idx);
+        const int rc = run_test_gmac(test, keylen);
+        if (rc != 0) {
+            printf("Test '%s' (#%zu) failed (%d)\n", name, test_idx, rc);
+            exit(1);
+        }
+        DLOG("Success");
+    }
 }
 
 int
@@ -822,6 +1918,33 @@ main()
     run_testcase("Test Case 2", 0, &tc2Test, 128);
     run_testcase("Test Case 4", 0, &tc4Test, 128);
 
+    {
+        const struct aes_gcm_test tcs[] = { tc1Test, tc2Test, tc4Test };
+        LOG("--- Running Test Cases 1, 2, 4 through the burst API... ");
+        if (run_tests_burst(tcs, sizeof(tcs) / sizeof(*tcs), 128) != 0) {
+            printf("Test Cases 1, 2, 4 failed in burst\n");
+            exit(1);
+        }
+    }
+
+    LOG("--- Running GMAC long AAD tests... ");
+    if (run_gmac_long_aad_tests() != 0) {
+        printf("GMAC long AAD tests failed\n");
+        exit(1);
+    }
+
+    LOG("--- Running parallel GCM long message tests... ");
+    if (run_parallel_long_message_tests() != 0) {
+        printf("Parallel GCM long message tests failed\n");
+        exit(1);
+    }
+
+    LOG("--- Running re-encryption long message tests... ");
+    if (run_reencrypt_long_message_tests() != 0) {
+        printf("Re-encryption long message tests failed\n");
+        exit(1);
+    }
+
     // Test suites
     const size_t num_suites = sizeof(gcm_suites) / sizeof(*gcm_suites);
     for (size_t suite_idx = 0; suite_idx < num_suites; suite_idx++) {
@@ -838,6 +1961,13 @@ main()
             const struct aes_gcm_test* test = &suite->tests[test_idx];
             run_testcase(suite->name, test_idx, test, suite->keylen);
         }
+
+        LOG("------ Running '%s' test suite through the burst API... ",
+             suite->name);
+        if (run_tests_burst(suite->tests, suite->count, suite->keylen) != 0) {
+            printf("Test suite '%s' failed in burst\n", suite->name);
+            exit(1);
+        }
         LOG("Success, '%s' test suite, %zu tests run.",
             suite->name, suite->count);
     }
@@ -0,0 +1,49 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "chacha20.h"
+
+#include <string.h>
+
+#include "zvkb.h"
+
+void
+chacha20_xor(
+    uint8_t* dest,
+    const uint8_t* src,
+    size_t len,
+    const uint8_t key[CHACHA20_KEY_SIZE],
+    const uint8_t nonce[CHACHA20_NONCE_SIZE],
+    uint32_t counter
+)
+{
+    // Little-endian words, as loaded by the vector routine.
+    uint32_t key_words[8];
+    uint32_t nonce_words[3];
+    memcpy(key_words, key, sizeof(key_words));
+    memcpy(nonce_words, nonce, sizeof(nonce_words));
+
+    const size_t nblocks = len / CHACHA20_BLOCK_SIZE;
+    zvkb_chacha20_xor_blocks(dest, src, nblocks, key_words, nonce_words,
+                             counter);
+
+    const size_t full = nblocks * CHACHA20_BLOCK_SIZE;
+    if (full < len) {
+        uint8_t block[CHACHA20_BLOCK_SIZE] = { 0 };
+        memcpy(block, src + full, len - full);
+        zvkb_chacha20_xor_blocks(block, block, 1, key_words, nonce_words,
+                                 counter + nblocks);
+        memcpy(dest + full, block, len - full);
+    }
+}
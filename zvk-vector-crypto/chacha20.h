@@ -0,0 +1,43 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ChaCha20 (RFC 8439) on top of the Zvkb keystream routine.
+//
+// Full blocks are processed directly from the caller's buffers, VLEN/32
+// blocks at a time. A trailing partial block goes through a block sized
+// buffer.
+
+#ifndef CHACHA20_H_
+#define CHACHA20_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define CHACHA20_KEY_SIZE 32
+#define CHACHA20_NONCE_SIZE 12
+#define CHACHA20_BLOCK_SIZE 64
+
+// Encrypts (or decrypts) the 'len' bytes at 'src' into 'dest', starting
+// with the block counter 'counter'. 'src' and 'dest' may be equal.
+extern void
+chacha20_xor(
+    uint8_t* dest,
+    const uint8_t* src,
+    size_t len,
+    const uint8_t key[CHACHA20_KEY_SIZE],
+    const uint8_t nonce[CHACHA20_NONCE_SIZE],
+    uint32_t counter
+);
+
+#endif  // CHACHA20_H_
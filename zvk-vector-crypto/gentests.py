@@ -23,6 +23,7 @@
 import argparse
 import array
 import binascii
+import hashlib
 import os
 
 from enum import Enum, unique
@@ -40,6 +41,20 @@ class CipherTypes(Enum):
     gcm = 2
     sha256 = 3
     sha512 = 4
+    sha224 = 5
+    sha384 = 6
+    sha512_224 = 7
+    sha512_256 = 8
+
+# The truncated SHA-2 variants reuse the messages of the SHA-256/SHA-512
+# byte test vectors, the expected digests are computed with hashlib.
+# Maps the variant to the (hashlib name, source file prefix, test prefix).
+derivedShaTypes = {
+    CipherTypes.sha224: ('sha224', 'SHA256', 'SHA224'),
+    CipherTypes.sha384: ('sha384', 'SHA512', 'SHA384'),
+    CipherTypes.sha512_224: ('sha512_224', 'SHA512', 'SHA512_224'),
+    CipherTypes.sha512_256: ('sha512_256', 'SHA512', 'SHA512_256'),
+}
 
 class GenTestCase:
     def __init__(self, fname, cipherType):
@@ -74,6 +89,13 @@ class GenTestCase:
             self.dynamicParameters = ['Msg']
             self.testStructName = "sha_test"
             self.testFileNames = [os.path.join(katdir, "shabytetestvectors", "SHA512*.rsp")]
+        elif cipherType in derivedShaTypes:
+            self.columns = ['Len', 'Msg', 'MD']
+            self.staticParameters = ['MD']
+            self.dynamicParameters = ['Msg']
+            self.testStructName = "sha_test"
+            prefix = derivedShaTypes[cipherType][1]
+            self.testFileNames = [os.path.join(katdir, "shabytetestvectors", prefix + "*.rsp")]
         else:
             raise ValueError("Unsupported cipher type: " + cipherType)
 
@@ -112,10 +134,27 @@ class GenTestCase:
             return True
         return False
 
+    def isSha(self):
+        return (self.cipherType == CipherTypes.sha256 or
+                self.cipherType == CipherTypes.sha512 or
+                self.cipherType in derivedShaTypes)
+
+    def testNameOf(self, fname):
+        testName = Path(fname).stem
+        if self.cipherType in derivedShaTypes:
+            _, src, dst = derivedShaTypes[self.cipherType]
+            testName = testName.replace(src, dst, 1)
+        return testName
+
+    def deriveDigest(self, data):
+        name = derivedShaTypes[self.cipherType][0]
+        msg = binascii.unhexlify(data['Msg']) if data['Msg'] else b''
+        data['MD'] = hashlib.new(name, msg).hexdigest()
+
     def genTests(self):
         for path in self.testFileNames:
             for fname in iglob(path):
-                testName = Path(fname).stem
+                testName = self.testNameOf(fname)
                 self.headerFile.write("#include \"" + testName + ".h" + "\"\n")
 
         self.headerFile.write("\nstatic const struct " + self.testStructName + "_suite")
@@ -123,7 +162,7 @@ class GenTestCase:
 
         for path in self.testFileNames:
             for fname in iglob(path):
-                testName = Path(fname).stem
+                testName = self.testNameOf(fname)
 
                 # AES-GCM test vectors have test mode(encrypt/decrypt) encoded in
                 # the file name, instead of storing it in the file itself...
@@ -168,7 +207,7 @@ class GenTestCase:
             self.testStruct.append("    ." + name + "len" + " = " + str(len(data)) + ",\n")
 
     def writeTestParameters(self, mode):
-        if self.cipherType == CipherTypes.sha256 or self.cipherType == CipherTypes.sha512:
+        if self.isSha():
                return
 
         if mode == 'ENCRYPT':
@@ -198,6 +237,8 @@ class GenTestCase:
 
             for data in lines:
                 testCaseName = testName + str(count)
+                if self.cipherType in derivedShaTypes:
+                    self.deriveDigest(data)
                 self.testStruct.append("{\n")
 
                 for parameter in self.staticParameters:
@@ -253,3 +294,19 @@ if __name__ == '__main__':
             print("Generating SHA256 test vectors")
             gen = GenTestCase("sha512-vectors.h", CipherTypes.sha512)
             gen.genTests()
+        if val == 'sha224':
+            print("Generating SHA224 test vectors")
+            gen = GenTestCase("sha224-vectors.h", CipherTypes.sha224)
+            gen.genTests()
+        if val == 'sha384':
+            print("Generating SHA384 test vectors")
+            gen = GenTestCase("sha384-vectors.h", CipherTypes.sha384)
+            gen.genTests()
+        if val == 'sha512_224':
+            print("Generating SHA512/224 test vectors")
+            gen = GenTestCase("sha512_224-vectors.h", CipherTypes.sha512_224)
+            gen.genTests()
+        if val == 'sha512_256':
+            print("Generating SHA512/256 test vectors")
+            gen = GenTestCase("sha512_256-vectors.h", CipherTypes.sha512_256)
+            gen.genTests()
@@ -0,0 +1,277 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hkdf.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TLS13_LABEL_PREFIX "tls13 "
+// Size of a HkdfLabel structure with the longest label and context.
+#define TLS13_MAX_HKDF_LABEL_SIZE (2 + 1 + 255 + 1 + 255)
+
+static const uint8_t kZeros[HKDF_MAX_HASH_SIZE];
+
+// Hash of the empty string, the context of the "derived" labels.
+static const uint8_t kSha256EmptyHash[SHA256_DIGEST_SIZE] = {
+    0xe3, 0xb0, 0xc4, 0x42, 0x98, 0xfc, 0x1c, 0x14,
+    0x9a, 0xfb, 0xf4, 0xc8, 0x99, 0x6f, 0xb9, 0x24,
+    0x27, 0xae, 0x41, 0xe4, 0x64, 0x9b, 0x93, 0x4c,
+    0xa4, 0x95, 0x99, 0x1b, 0x78, 0x52, 0xb8, 0x55,
+};
+
+static const uint8_t kSha384EmptyHash[SHA384_DIGEST_SIZE] = {
+    0x38, 0xb0, 0x60, 0xa7, 0x51, 0xac, 0x96, 0x38,
+    0x4c, 0xd9, 0x32, 0x7e, 0xb1, 0xb1, 0xe3, 0x6a,
+    0x21, 0xfd, 0xb7, 0x11, 0x14, 0xbe, 0x07, 0x43,
+    0x4c, 0x0c, 0xc7, 0xbf, 0x63, 0xf6, 0xe1, 0xda,
+    0x27, 0x4e, 0xde, 0xbf, 0xe7, 0x6f, 0x65, 0xfb,
+    0xd5, 0x1a, 0xd2, 0xf1, 0x48, 0x98, 0xb9, 0x5b,
+};
+
+size_t
+hkdf_hash_size(enum hkdf_hash hash)
+{
+    return hash == HKDF_SHA256 ? SHA256_DIGEST_SIZE : SHA384_DIGEST_SIZE;
+}
+
+static void
+hkdf_hmac(const struct hkdf_key* key, const uint8_t* msg, size_t len,
+          uint8_t* mac)
+{
+    if (key->hash == HKDF_SHA256) {
+        hmac_sha256(&key->hmac.sha256, msg, len, mac);
+    } else {
+        hmac_sha512(&key->hmac.sha384, msg, len, mac);
+    }
+}
+
+void
+hkdf_key_init(
+    struct hkdf_key* key,
+    enum hkdf_hash hash,
+    const uint8_t* prk,
+    size_t prklen
+)
+{
+    key->hash = hash;
+    if (hash == HKDF_SHA256) {
+        hmac_sha256_key_init(&key->hmac.sha256, prk, prklen);
+    } else {
+        hmac_sha384_key_init(&key->hmac.sha384, prk, prklen);
+    }
+}
+
+void
+hkdf_extract(
+    enum hkdf_hash hash,
+    const uint8_t* salt,
+    size_t saltlen,
+    const uint8_t* ikm,
+    size_t ikmlen,
+    uint8_t* prk
+)
+{
+    struct hkdf_key key;
+    if (salt == NULL) {
+        salt = kZeros;
+        saltlen = hkdf_hash_size(hash);
+    }
+    hkdf_key_init(&key, hash, salt, saltlen);
+    hkdf_hmac(&key, ikm, ikmlen, prk);
+}
+
+// HKDF-Expand over 'buf', which holds room for T(i-1) in its first
+// hkdf_hash_size() bytes, then 'infolen' bytes of info and room for the
+// counter byte.
+static void
+hkdf_expand_buffer(
+    const struct hkdf_key* key,
+    uint8_t* buf,
+    size_t infolen,
+    uint8_t* okm,
+    size_t okmlen
+)
+{
+    const size_t hash_size = hkdf_hash_size(key->hash);
+    uint8_t t[HKDF_MAX_HASH_SIZE];
+
+    assert(okmlen <= 255 * hash_size);
+    // T(0) is empty, T(1) = HMAC(PRK, info || 0x01).
+    const uint8_t* msg = &buf[hash_size];
+    size_t len = infolen + 1;
+    for (uint8_t i = 1; okmlen > 0; i++) {
+        buf[hash_size + infolen] = i;
+        hkdf_hmac(key, msg, len, t);
+
+        const size_t n = okmlen < hash_size ? okmlen : hash_size;
+        memcpy(okm, t, n);
+        okm += n;
+        okmlen -= n;
+
+        memcpy(buf, t, hash_size);
+        msg = buf;
+        len = hash_size + infolen + 1;
+    }
+}
+
+void
+hkdf_expand(
+    const struct hkdf_key* key,
+    const uint8_t* info,
+    size_t infolen,
+    uint8_t* okm,
+    size_t okmlen
+)
+{
+    const size_t hash_size = hkdf_hash_size(key->hash);
+    uint8_t* buf = malloc(hash_size + infolen + 1);
+    assert(buf != NULL);
+    memcpy(&buf[hash_size], info, infolen);
+    hkdf_expand_buffer(key, buf, infolen, okm, okmlen);
+    free(buf);
+}
+
+void
+hkdf_expand_label(
+    const struct hkdf_key* key,
+    const char* label,
+    const uint8_t* context,
+    size_t contextlen,
+    uint8_t* out,
+    size_t outlen
+)
+{
+    uint8_t buf[HKDF_MAX_HASH_SIZE + TLS13_MAX_HKDF_LABEL_SIZE + 1];
+    const size_t prefixlen = strlen(TLS13_LABEL_PREFIX);
+    const size_t labellen = strlen(label);
+
+    assert(outlen <= 0xffff);
+    assert(prefixlen + labellen <= 255);
+    assert(contextlen <= 255);
+
+    // struct {
+    //     uint16 length;
+    //     opaque label<7..255> = "tls13 " + Label;
+    //     opaque context<0..255> = Context;
+    // } HkdfLabel;
+    uint8_t* p = &buf[hkdf_hash_size(key->hash)];
+    uint8_t* const info = p;
+    *p++ = (uint8_t)(outlen >> 8);
+    *p++ = (uint8_t)outlen;
+    *p++ = (uint8_t)(prefixlen + labellen);
+    memcpy(p, TLS13_LABEL_PREFIX, prefixlen);
+    p += prefixlen;
+    memcpy(p, label, labellen);
+    p += labellen;
+    *p++ = (uint8_t)contextlen;
+    if (contextlen > 0) {
+        memcpy(p, context, contextlen);
+        p += contextlen;
+    }
+
+    hkdf_expand_buffer(key, buf, p - info, out, outlen);
+}
+
+//
+// TLS 1.3 key schedule
+//
+
+// Derive-Secret(secret, label, hash) for a traffic secret, followed by
+// its write key and IV, and its finished key if 'finished_key' is not
+// NULL. The traffic secret midstates are set up once for all of them.
+static void
+tls13_traffic_secret(
+    const struct hkdf_key* secret,
+    const char* label,
+    const uint8_t* transcript_hash,
+    size_t key_size,
+    struct tls13_traffic* traffic,
+    uint8_t* finished_key
+)
+{
+    const size_t hash_size = hkdf_hash_size(secret->hash);
+    struct hkdf_key traffic_key;
+
+    hkdf_expand_label(secret, label, transcript_hash, hash_size,
+                      traffic->secret, hash_size);
+    hkdf_key_init(&traffic_key, secret->hash, traffic->secret, hash_size);
+    hkdf_expand_label(&traffic_key, "key", NULL, 0, traffic->key, key_size);
+    hkdf_expand_label(&traffic_key, "iv", NULL, 0, traffic->iv,
+                      TLS13_IV_SIZE);
+    if (finished_key != NULL) {
+        hkdf_expand_label(&traffic_key, "finished", NULL, 0, finished_key,
+                          hash_size);
+    }
+}
+
+void
+tls13_key_schedule(
+    const struct tls13_key_schedule_input* input,
+    struct tls13_secrets* secrets
+)
+{
+    const enum hkdf_hash hash = input->hash;
+    const size_t hash_size = hkdf_hash_size(hash);
+    const uint8_t* const empty_hash =
+        hash == HKDF_SHA256 ? kSha256EmptyHash : kSha384EmptyHash;
+    uint8_t derived[HKDF_MAX_HASH_SIZE];
+    struct hkdf_key key;
+
+    assert(input->key_size <= TLS13_MAX_KEY_SIZE);
+
+    // Early Secret = HKDF-Extract(0, PSK)
+    if (input->psk != NULL) {
+        hkdf_extract(hash, NULL, 0, input->psk, input->psklen,
+                     secrets->early_secret);
+    } else {
+        hkdf_extract(hash, NULL, 0, kZeros, hash_size, secrets->early_secret);
+    }
+    hkdf_key_init(&key, hash, secrets->early_secret, hash_size);
+    hkdf_expand_label(&key, "derived", empty_hash, hash_size, derived,
+                      hash_size);
+
+    // Handshake Secret = HKDF-Extract(Derive-Secret(., "derived", ""),
+    //                                 (EC)DHE)
+    if (input->ecdhe != NULL) {
+        hkdf_extract(hash, derived, hash_size, input->ecdhe, input->ecdhelen,
+                     secrets->handshake_secret);
+    } else {
+        hkdf_extract(hash, derived, hash_size, kZeros, hash_size,
+                     secrets->handshake_secret);
+    }
+    hkdf_key_init(&key, hash, secrets->handshake_secret, hash_size);
+    tls13_traffic_secret(&key, "c hs traffic", input->server_hello_hash,
+                         input->key_size, &secrets->client_handshake,
+                         secrets->client_finished_key);
+    tls13_traffic_secret(&key, "s hs traffic", input->server_hello_hash,
+                         input->key_size, &secrets->server_handshake,
+                         secrets->server_finished_key);
+    hkdf_expand_label(&key, "derived", empty_hash, hash_size, derived,
+                      hash_size);
+
+    // Master Secret = HKDF-Extract(Derive-Secret(., "derived", ""), 0)
+    hkdf_extract(hash, derived, hash_size, kZeros, hash_size,
+                 secrets->master_secret);
+    hkdf_key_init(&key, hash, secrets->master_secret, hash_size);
+    tls13_traffic_secret(&key, "c ap traffic", input->server_finished_hash,
+                         input->key_size, &secrets->client_application, NULL);
+    tls13_traffic_secret(&key, "s ap traffic", input->server_finished_hash,
+                         input->key_size, &secrets->server_application, NULL);
+    hkdf_expand_label(&key, "exp master", input->server_finished_hash,
+                      hash_size, secrets->exporter_master_secret, hash_size);
+    hkdf_expand_label(&key, "res master", input->client_finished_hash,
+                      hash_size, secrets->resumption_master_secret, hash_size);
+}
@@ -0,0 +1,152 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// HKDF (RFC 5869) with HMAC-SHA-256 or HMAC-SHA-384, and the TLS 1.3 key
+// schedule (RFC 8446, section 7.1) built on top of it.
+//
+// A pseudorandom key is set up once as an HMAC key, i.e. as its key^ipad
+// and key^opad midstates, and every Expand from it reuses them. In the TLS
+// 1.3 key schedule each secret feeds between two and four labels, so each
+// label only costs the compressions of its (single block) inner and outer
+// messages.
+
+#ifndef HKDF_H_
+#define HKDF_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hmac-sha2.h"
+
+enum hkdf_hash {
+    HKDF_SHA256,
+    HKDF_SHA384,
+};
+
+#define HKDF_MAX_HASH_SIZE SHA384_DIGEST_SIZE
+
+// Pseudorandom key, ready to be used by hkdf_expand().
+struct hkdf_key {
+    enum hkdf_hash hash;
+    union {
+        struct hmac_sha256_key sha256;
+        struct hmac_sha512_key sha384;
+    } hmac;
+};
+
+// Returns the digest size of 'hash', in bytes.
+extern size_t
+hkdf_hash_size(enum hkdf_hash hash);
+
+// HKDF-Extract. Writes the hkdf_hash_size(hash) bytes pseudorandom key
+// to 'prk'. A NULL 'salt' stands for hkdf_hash_size(hash) zero bytes.
+extern void
+hkdf_extract(
+    enum hkdf_hash hash,
+    const uint8_t* salt,
+    size_t saltlen,
+    const uint8_t* ikm,
+    size_t ikmlen,
+    uint8_t* prk
+);
+
+// Sets up the HMAC midstates of 'prk'.
+extern void
+hkdf_key_init(
+    struct hkdf_key* key,
+    enum hkdf_hash hash,
+    const uint8_t* prk,
+    size_t prklen
+);
+
+// HKDF-Expand. 'okmlen' must be at most 255 * hkdf_hash_size().
+extern void
+hkdf_expand(
+    const struct hkdf_key* key,
+    const uint8_t* info,
+    size_t infolen,
+    uint8_t* okm,
+    size_t okmlen
+);
+
+// HKDF-Expand-Label from TLS 1.3. 'label' is a NUL terminated string,
+// without the "tls13 " prefix.
+extern void
+hkdf_expand_label(
+    const struct hkdf_key* key,
+    const char* label,
+    const uint8_t* context,
+    size_t contextlen,
+    uint8_t* out,
+    size_t outlen
+);
+
+//
+// TLS 1.3 key schedule
+//
+
+#define TLS13_MAX_KEY_SIZE 32
+#define TLS13_IV_SIZE 12
+
+struct tls13_key_schedule_input {
+    // HKDF_SHA256 or HKDF_SHA384, as per the cipher suite.
+    enum hkdf_hash hash;
+    // AEAD key size, 16 or 32.
+    size_t key_size;
+    // Pre-shared key, NULL for a full handshake.
+    const uint8_t* psk;
+    size_t psklen;
+    // (EC)DHE shared secret, NULL for psk_ke resumptions.
+    const uint8_t* ecdhe;
+    size_t ecdhelen;
+    // Transcript hashes, hkdf_hash_size(hash) bytes each, of
+    // ClientHello...ServerHello, ClientHello...server Finished and
+    // ClientHello...client Finished.
+    const uint8_t* server_hello_hash;
+    const uint8_t* server_finished_hash;
+    const uint8_t* client_finished_hash;
+};
+
+struct tls13_traffic {
+    uint8_t secret[HKDF_MAX_HASH_SIZE];
+    uint8_t key[TLS13_MAX_KEY_SIZE];
+    uint8_t iv[TLS13_IV_SIZE];
+};
+
+// Secrets are hkdf_hash_size() bytes, keys are 'key_size' bytes.
+struct tls13_secrets {
+    uint8_t early_secret[HKDF_MAX_HASH_SIZE];
+    uint8_t handshake_secret[HKDF_MAX_HASH_SIZE];
+    uint8_t master_secret[HKDF_MAX_HASH_SIZE];
+
+    struct tls13_traffic client_handshake;
+    struct tls13_traffic server_handshake;
+    uint8_t client_finished_key[HKDF_MAX_HASH_SIZE];
+    uint8_t server_finished_key[HKDF_MAX_HASH_SIZE];
+
+    struct tls13_traffic client_application;
+    struct tls13_traffic server_application;
+    uint8_t exporter_master_secret[HKDF_MAX_HASH_SIZE];
+    uint8_t resumption_master_secret[HKDF_MAX_HASH_SIZE];
+};
+
+// Derives the whole secret tree of a handshake, from the early secret to
+// the application traffic keys.
+extern void
+tls13_key_schedule(
+    const struct tls13_key_schedule_input* input,
+    struct tls13_secrets* secrets
+);
+
+#endif  // HKDF_H_
@@ -0,0 +1,308 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hmac-drbg.h"
+
+#include <assert.h>
+#include <string.h>
+
+size_t
+hmac_drbg_hash_size(enum hmac_drbg_hash hash)
+{
+    return hash == HMAC_DRBG_SHA256 ? SHA256_DIGEST_SIZE : SHA512_DIGEST_SIZE;
+}
+
+// Pads both blocks for a hash size bytes message following the key block,
+// i.e., a (block size + hash size) bytes message.
+static void
+hmac_drbg_pad(struct hmac_drbg* drbg)
+{
+    const size_t hash_size = hmac_drbg_hash_size(drbg->hash);
+    const size_t block_size = drbg->hash == HMAC_DRBG_SHA256 ?
+        SHA256_BLOCK_SIZE : SHA512_BLOCK_SIZE;
+    const uint64_t bitlen = __builtin_bswap64((block_size + hash_size) * 8);
+
+    memset(drbg->blocks, 0, sizeof(drbg->blocks));
+    for (size_t i = 0; i < 2; i++) {
+        drbg->blocks[i][hash_size] = 0x80;
+        memcpy(&drbg->blocks[i][block_size - sizeof(bitlen)], &bitlen,
+               sizeof(bitlen));
+    }
+}
+
+static void
+hmac_drbg_set_key(struct hmac_drbg* drbg, const uint8_t* key)
+{
+    if (drbg->hash == HMAC_DRBG_SHA256) {
+        hmac_sha256_key_init(&drbg->key.sha256, key, SHA256_DIGEST_SIZE);
+    } else {
+        hmac_sha512_key_init(&drbg->key.sha512, key, SHA512_DIGEST_SIZE);
+    }
+}
+
+// V = HMAC(K, V), from the pre-padded blocks.
+static void
+hmac_drbg_next_v(struct hmac_drbg* drbg)
+{
+    if (drbg->hash == HMAC_DRBG_SHA256) {
+        uint32_t hash[8];
+        memcpy(hash, drbg->key.sha256.inner, sizeof(hash));
+        sha256_blocks(hash, drbg->blocks[0], 1);
+        sha256_digest(drbg->blocks[1], hash);
+        memcpy(hash, drbg->key.sha256.outer, sizeof(hash));
+        sha256_blocks(hash, drbg->blocks[1], 1);
+        sha256_digest(drbg->blocks[0], hash);
+    } else {
+        uint64_t hash[8];
+        memcpy(hash, drbg->key.sha512.inner, sizeof(hash));
+        sha512_blocks(hash, drbg->blocks[0], 1);
+        sha512_digest(drbg->blocks[1], hash);
+        memcpy(hash, drbg->key.sha512.outer, sizeof(hash));
+        sha512_blocks(hash, drbg->blocks[1], 1);
+        sha512_digest(drbg->blocks[0], hash);
+    }
+}
+
+// Writes HMAC(K, V || 'sep' || data[0] || ... || data[n - 1]) to 'mac'.
+static void
+hmac_drbg_mac(
+    struct hmac_drbg* drbg,
+    uint8_t sep,
+    const uint8_t* const* data,
+    const size_t* lens,
+    size_t n,
+    uint8_t* mac
+)
+{
+    if (drbg->hash == HMAC_DRBG_SHA256) {
+        struct sha256_ctx ctx;
+        uint32_t hash[8];
+        sha256_init(&ctx);
+        memcpy(ctx.hash, drbg->key.sha256.inner, sizeof(ctx.hash));
+        ctx.msglen = SHA256_BLOCK_SIZE;
+        sha256_update(&ctx, drbg->blocks[0], SHA256_DIGEST_SIZE);
+        sha256_update(&ctx, &sep, 1);
+        for (size_t i = 0; i < n; i++) {
+            if (lens[i] > 0) {
+                sha256_update(&ctx, data[i], lens[i]);
+            }
+        }
+        sha256_final(&ctx, drbg->blocks[1]);
+        memcpy(hash, drbg->key.sha256.outer, sizeof(hash));
+        sha256_blocks(hash, drbg->blocks[1], 1);
+        sha256_digest(mac, hash);
+    } else {
+        struct sha512_ctx ctx;
+        uint64_t hash[8];
+        sha512_init(&ctx);
+        memcpy(ctx.hash, drbg->key.sha512.inner, sizeof(ctx.hash));
+        ctx.msglen = SHA512_BLOCK_SIZE;
+        sha512_update(&ctx, drbg->blocks[0], SHA512_DIGEST_SIZE);
+        sha512_update(&ctx, &sep, 1);
+        for (size_t i = 0; i < n; i++) {
+            if (lens[i] > 0) {
+                sha512_update(&ctx, data[i], lens[i]);
+            }
+        }
+        sha512_final(&ctx, drbg->blocks[1]);
+        memcpy(hash, drbg->key.sha512.outer, sizeof(hash));
+        sha512_blocks(hash, drbg->blocks[1], 1);
+        sha512_digest(mac, hash);
+    }
+}
+
+// HMAC_DRBG_Update, the provided data being the concatenation of the 'n'
+// buffers in 'data'.
+static void
+hmac_drbg_update(
+    struct hmac_drbg* drbg,
+    const uint8_t* const* data,
+    const size_t* lens,
+    size_t n
+)
+{
+    uint8_t key[HMAC_DRBG_MAX_HASH_SIZE];
+    size_t total = 0;
+    for (size_t i = 0; i < n; i++) {
+        total += lens[i];
+    }
+
+    hmac_drbg_mac(drbg, 0x00, data, lens, n, key);
+    hmac_drbg_set_key(drbg, key);
+    hmac_drbg_next_v(drbg);
+    if (total == 0) {
+        return;
+    }
+    hmac_drbg_mac(drbg, 0x01, data, lens, n, key);
+    hmac_drbg_set_key(drbg, key);
+    hmac_drbg_next_v(drbg);
+}
+
+void
+hmac_drbg_instantiate(
+    struct hmac_drbg* drbg,
+    enum hmac_drbg_hash hash,
+    const uint8_t* entropy,
+    size_t entropylen,
+    const uint8_t* nonce,
+    size_t noncelen,
+    const uint8_t* pers,
+    size_t perslen
+)
+{
+    static const uint8_t kZeros[HMAC_DRBG_MAX_HASH_SIZE];
+    const uint8_t* const data[] = { entropy, nonce, pers };
+    const size_t lens[] = { entropylen, noncelen, perslen };
+
+    drbg->hash = hash;
+    hmac_drbg_pad(drbg);
+    // K = 0x00 00...00, V = 0x01 01...01
+    hmac_drbg_set_key(drbg, kZeros);
+    memset(drbg->blocks[0], 0x01, hmac_drbg_hash_size(hash));
+    hmac_drbg_update(drbg, data, lens, 3);
+    drbg->reseed_counter = 1;
+}
+
+void
+hmac_drbg_reseed(
+    struct hmac_drbg* drbg,
+    const uint8_t* entropy,
+    size_t entropylen,
+    const uint8_t* additional,
+    size_t additionallen
+)
+{
+    const uint8_t* const data[] = { entropy, additional };
+    const size_t lens[] = { entropylen, additionallen };
+
+    hmac_drbg_update(drbg, data, lens, 2);
+    drbg->reseed_counter = 1;
+}
+
+int
+hmac_drbg_generate(
+    struct hmac_drbg* drbg,
+    uint8_t* out,
+    size_t outlen,
+    const uint8_t* additional,
+    size_t additionallen
+)
+{
+    const size_t hash_size = hmac_drbg_hash_size(drbg->hash);
+
+    if (outlen > HMAC_DRBG_MAX_REQUEST_SIZE ||
+        drbg->reseed_counter > HMAC_DRBG_RESEED_INTERVAL) {
+        return -1;
+    }
+    if (additionallen > 0) {
+        hmac_drbg_update(drbg, &additional, &additionallen, 1);
+    }
+    while (outlen > 0) {
+        hmac_drbg_next_v(drbg);
+        const size_t n = outlen < hash_size ? outlen : hash_size;
+        memcpy(out, drbg->blocks[0], n);
+        out += n;
+        outlen -= n;
+    }
+    hmac_drbg_update(drbg, &additional, &additionallen, 1);
+    drbg->reseed_counter++;
+    return 0;
+}
+
+//
+// RFC 6979 deterministic nonces
+//
+
+// bits2int (RFC 6979 section 2.3.2): the leftmost 'qlen' bits of the
+// 'inlen' bytes at 'in', as a (qlen + 7) / 8 bytes big-endian integer.
+static void
+rfc6979_bits2int(uint8_t* out, const uint8_t* in, size_t inlen, size_t qlen)
+{
+    const size_t rlen = (qlen + 7) / 8;
+    if (inlen < rlen) {
+        memset(out, 0, rlen - inlen);
+        memcpy(&out[rlen - inlen], in, inlen);
+        return;
+    }
+    memcpy(out, in, rlen);
+    const unsigned shift = rlen * 8 - qlen;
+    if (shift == 0) {
+        return;
+    }
+    for (size_t i = rlen; i-- > 0;) {
+        const uint8_t carry = i > 0 ? out[i - 1] << (8 - shift) : 0;
+        out[i] = (out[i] >> shift) | carry;
+    }
+}
+
+// a -= b, for 'len' bytes big-endian integers with a >= b.
+static void
+rfc6979_sub(uint8_t* a, const uint8_t* b, size_t len)
+{
+    unsigned borrow = 0;
+    for (size_t i = len; i-- > 0;) {
+        const int d = (int)a[i] - b[i] - borrow;
+        borrow = d < 0;
+        a[i] = (uint8_t)d;
+    }
+}
+
+static int
+rfc6979_is_zero(const uint8_t* a, size_t len)
+{
+    uint8_t acc = 0;
+    for (size_t i = 0; i < len; i++) {
+        acc |= a[i];
+    }
+    return acc == 0;
+}
+
+void
+rfc6979_nonce(
+    enum hmac_drbg_hash hash,
+    const uint8_t* q,
+    size_t qlen,
+    const uint8_t* x,
+    const uint8_t* h1,
+    size_t h1len,
+    uint8_t* k
+)
+{
+    const size_t rlen = (qlen + 7) / 8;
+    uint8_t h1_octets[RFC6979_MAX_ORDER_SIZE];
+    struct hmac_drbg drbg;
+
+    assert(rlen <= RFC6979_MAX_ORDER_SIZE);
+
+    // bits2octets(h1) = int2octets(bits2int(h1) mod q). bits2int(h1) has
+    // at most qlen bits, one subtraction is enough.
+    rfc6979_bits2int(h1_octets, h1, h1len, qlen);
+    if (memcmp(h1_octets, q, rlen) >= 0) {
+        rfc6979_sub(h1_octets, q, rlen);
+    }
+
+    // Steps b. to g. are the instantiation of HMAC_DRBG with int2octets(x)
+    // as the entropy input and bits2octets(h1) as the nonce. The candidates
+    // of step h., and the K/V update after a rejected one, are those of
+    // successive generate calls of rlen bytes.
+    hmac_drbg_instantiate(&drbg, hash, x, rlen, h1_octets, rlen, NULL, 0);
+    for (;;) {
+        uint8_t t[RFC6979_MAX_ORDER_SIZE];
+        hmac_drbg_generate(&drbg, t, rlen, NULL, 0);
+        rfc6979_bits2int(k, t, rlen, qlen);
+        if (!rfc6979_is_zero(k, rlen) && memcmp(k, q, rlen) < 0) {
+            break;
+        }
+    }
+}
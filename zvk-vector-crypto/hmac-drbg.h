@@ -0,0 +1,120 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// HMAC_DRBG (NIST SP 800-90A Rev. 1, section 10.1.2) with HMAC-SHA-256 or
+// HMAC-SHA-512, and the deterministic (EC)DSA nonces of RFC 6979 built on
+// top of it.
+//
+// The key K is kept as its key^ipad and key^opad midstates, in the native
+// {f,e,b,a,h,g,d,c} layout, and only changes when the state is updated.
+// V is kept at the start of a block already holding the padding of a
+// single block message following the key block. The V = HMAC(K, V) steps
+// of a generate call are thus two block compressions each, from the inner
+// then the outer midstate, with no padding or finalization work.
+
+#ifndef HMAC_DRBG_H_
+#define HMAC_DRBG_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hmac-sha2.h"
+
+enum hmac_drbg_hash {
+    HMAC_DRBG_SHA256,
+    HMAC_DRBG_SHA512,
+};
+
+#define HMAC_DRBG_MAX_HASH_SIZE SHA512_DIGEST_SIZE
+
+// Limits of SP 800-90A, Table 2: 2^19 bits per generate call, and 2^48
+// generate calls between reseeds.
+#define HMAC_DRBG_MAX_REQUEST_SIZE (1 << 16)
+#define HMAC_DRBG_RESEED_INTERVAL (1ull << 48)
+
+struct hmac_drbg {
+    enum hmac_drbg_hash hash;
+    union {
+        struct hmac_sha256_key sha256;
+        struct hmac_sha512_key sha512;
+    } key;
+    // blocks[0] holds V followed by its padding, blocks[1] the same padding
+    // after room for the inner digest of HMAC(K, V).
+    uint8_t blocks[2][SHA512_BLOCK_SIZE];
+    uint64_t reseed_counter;
+};
+
+// Returns the output size of 'hash', in bytes.
+extern size_t
+hmac_drbg_hash_size(enum hmac_drbg_hash hash);
+
+// Instantiates 'drbg' from the concatenation of 'entropy', 'nonce' and
+// 'pers' (the personalization string). 'nonce' and 'pers' may be NULL.
+extern void
+hmac_drbg_instantiate(
+    struct hmac_drbg* drbg,
+    enum hmac_drbg_hash hash,
+    const uint8_t* entropy,
+    size_t entropylen,
+    const uint8_t* nonce,
+    size_t noncelen,
+    const uint8_t* pers,
+    size_t perslen
+);
+
+// 'additional' may be NULL.
+extern void
+hmac_drbg_reseed(
+    struct hmac_drbg* drbg,
+    const uint8_t* entropy,
+    size_t entropylen,
+    const uint8_t* additional,
+    size_t additionallen
+);
+
+// Writes 'outlen' pseudorandom bytes to 'out'. 'additional' may be NULL.
+// Returns 0 on success, -1 if 'outlen' exceeds HMAC_DRBG_MAX_REQUEST_SIZE
+// or a reseed is required, in which case nothing is written.
+extern int
+hmac_drbg_generate(
+    struct hmac_drbg* drbg,
+    uint8_t* out,
+    size_t outlen,
+    const uint8_t* additional,
+    size_t additionallen
+);
+
+//
+// RFC 6979 deterministic nonces
+//
+
+// Largest supported group order, 521 bits (P-521).
+#define RFC6979_MAX_ORDER_SIZE 66
+
+// Computes the nonce k, 1 <= k < q, for the private key 'x' and the message
+// hash 'h1' (as computed with 'hash', or a different hash function, see RFC
+// 6979 section 3.6). 'q' is the 'qlen' bits group order, and 'q', 'x' and
+// 'k' are big-endian integers of (qlen + 7) / 8 bytes.
+extern void
+rfc6979_nonce(
+    enum hmac_drbg_hash hash,
+    const uint8_t* q,
+    size_t qlen,
+    const uint8_t* x,
+    const uint8_t* h1,
+    size_t h1len,
+    uint8_t* k
+);
+
+#endif  // HMAC_DRBG_H_
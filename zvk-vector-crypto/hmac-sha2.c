@@ -0,0 +1,329 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hmac-sha2.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "vlen-bits.h"
+
+#define HMAC_IPAD 0x36
+#define HMAC_OPAD 0x5c
+
+// Constant time comparison of 'len' bytes, returns 0 if they match.
+static int
+hmac_compare(const uint8_t* a, const uint8_t* b, size_t len)
+{
+    uint8_t diff = 0;
+    for (size_t i = 0; i < len; i++) {
+        diff |= a[i] ^ b[i];
+    }
+    return diff == 0 ? 0 : -1;
+}
+
+//
+// HMAC-SHA-256
+//
+
+void
+hmac_sha256_key_init(
+    struct hmac_sha256_key* hkey,
+    const uint8_t* key,
+    size_t keylen
+)
+{
+    uint8_t block[SHA256_BLOCK_SIZE] = { 0 };
+    struct sha256_ctx ctx;
+
+    if (keylen > SHA256_BLOCK_SIZE) {
+        sha256_init(&ctx);
+        sha256_update(&ctx, key, keylen);
+        sha256_final(&ctx, block);
+    } else {
+        memcpy(block, key, keylen);
+    }
+
+    for (size_t i = 0; i < SHA256_BLOCK_SIZE; i++) {
+        block[i] ^= HMAC_IPAD;
+    }
+    sha256_init(&ctx);
+    sha256_update(&ctx, block, SHA256_BLOCK_SIZE);
+    memcpy(hkey->inner, ctx.hash, sizeof(hkey->inner));
+
+    for (size_t i = 0; i < SHA256_BLOCK_SIZE; i++) {
+        block[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+    }
+    sha256_init(&ctx);
+    sha256_update(&ctx, block, SHA256_BLOCK_SIZE);
+    memcpy(hkey->outer, ctx.hash, sizeof(hkey->outer));
+}
+
+// Sets up 'ctx' as if the key pad block leading to 'midstate' had been
+// hashed.
+static void
+sha256_resume(struct sha256_ctx* ctx, const uint32_t* midstate)
+{
+    sha256_init(ctx);
+    memcpy(ctx->hash, midstate, sizeof(ctx->hash));
+    ctx->msglen = SHA256_BLOCK_SIZE;
+}
+
+void
+hmac_sha256(
+    const struct hmac_sha256_key* hkey,
+    const uint8_t* msg,
+    size_t len,
+    uint8_t* mac
+)
+{
+    uint8_t inner[SHA256_DIGEST_SIZE];
+    struct sha256_ctx ctx;
+
+    sha256_resume(&ctx, hkey->inner);
+    sha256_update(&ctx, msg, len);
+    sha256_final(&ctx, inner);
+
+    sha256_resume(&ctx, hkey->outer);
+    sha256_update(&ctx, inner, sizeof(inner));
+    sha256_final(&ctx, mac);
+}
+
+int
+hmac_sha256_verify(
+    const struct hmac_sha256_key* hkey,
+    const uint8_t* msg,
+    size_t len,
+    const uint8_t* mac,
+    size_t maclen
+)
+{
+    uint8_t expected[HMAC_SHA256_MAC_SIZE];
+    assert(maclen <= HMAC_SHA256_MAC_SIZE);
+    hmac_sha256(hkey, msg, len, expected);
+    return hmac_compare(expected, mac, maclen);
+}
+
+void
+hmac_sha256_verify_batch(struct hmac_sha256_verify_job* jobs, size_t njobs)
+{
+    if (vlen_bits() < 128) {
+        for (size_t i = 0; i < njobs; i++) {
+            jobs[i].result = hmac_sha256_verify(jobs[i].hkey, jobs[i].msg,
+                                                jobs[i].len, jobs[i].mac,
+                                                jobs[i].maclen);
+        }
+        return;
+    }
+
+    const size_t lanes = sha256_multi_lanes();
+    uint32_t states[SHA2_MB_MAX_LANES][8];
+    const uint8_t* msgs[SHA2_MB_MAX_LANES];
+    size_t lens[SHA2_MB_MAX_LANES];
+    uint8_t macs[SHA2_MB_MAX_LANES][SHA256_DIGEST_SIZE];
+    uint8_t* digests[SHA2_MB_MAX_LANES];
+
+    for (size_t i = 0; i < SHA2_MB_MAX_LANES; i++) {
+        digests[i] = macs[i];
+    }
+
+    for (size_t base = 0; base < njobs; base += lanes) {
+        const size_t n = njobs - base < lanes ? njobs - base : lanes;
+        struct hmac_sha256_verify_job* const batch = &jobs[base];
+
+        // Inner hashes, from the key^ipad midstates.
+        for (size_t i = 0; i < n; i++) {
+            memcpy(states[i], batch[i].hkey->inner, sizeof(states[i]));
+            msgs[i] = batch[i].msg;
+            lens[i] = batch[i].len;
+        }
+        sha256_multi_hash(states, msgs, lens, SHA256_BLOCK_SIZE, digests, n);
+
+        // Outer hashes of the inner digests, a single block each.
+        for (size_t i = 0; i < n; i++) {
+            memcpy(states[i], batch[i].hkey->outer, sizeof(states[i]));
+            msgs[i] = macs[i];
+            lens[i] = SHA256_DIGEST_SIZE;
+        }
+        sha256_multi_hash(states, msgs, lens, SHA256_BLOCK_SIZE, digests, n);
+
+        for (size_t i = 0; i < n; i++) {
+            assert(batch[i].maclen <= HMAC_SHA256_MAC_SIZE);
+            batch[i].result =
+                hmac_compare(macs[i], batch[i].mac, batch[i].maclen);
+        }
+    }
+}
+
+//
+// HMAC-SHA-384/512
+//
+
+static void
+hmac_sha512_key_setup(
+    struct hmac_sha512_key* hkey,
+    void (*init_fn)(struct sha512_ctx*),
+    void (*final_fn)(struct sha512_ctx*, uint8_t*),
+    size_t mac_size,
+    const uint8_t* key,
+    size_t keylen
+)
+{
+    uint8_t block[SHA512_BLOCK_SIZE] = { 0 };
+    struct sha512_ctx ctx;
+
+    if (keylen > SHA512_BLOCK_SIZE) {
+        init_fn(&ctx);
+        sha512_update(&ctx, key, keylen);
+        final_fn(&ctx, block);
+    } else {
+        memcpy(block, key, keylen);
+    }
+
+    for (size_t i = 0; i < SHA512_BLOCK_SIZE; i++) {
+        block[i] ^= HMAC_IPAD;
+    }
+    init_fn(&ctx);
+    sha512_update(&ctx, block, SHA512_BLOCK_SIZE);
+    memcpy(hkey->inner, ctx.hash, sizeof(hkey->inner));
+
+    for (size_t i = 0; i < SHA512_BLOCK_SIZE; i++) {
+        block[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+    }
+    init_fn(&ctx);
+    sha512_update(&ctx, block, SHA512_BLOCK_SIZE);
+    memcpy(hkey->outer, ctx.hash, sizeof(hkey->outer));
+
+    hkey->mac_size = mac_size;
+}
+
+void
+hmac_sha384_key_init(
+    struct hmac_sha512_key* hkey,
+    const uint8_t* key,
+    size_t keylen
+)
+{
+    hmac_sha512_key_setup(hkey, sha384_init, sha384_final,
+                          HMAC_SHA384_MAC_SIZE, key, keylen);
+}
+
+void
+hmac_sha512_key_init(
+    struct hmac_sha512_key* hkey,
+    const uint8_t* key,
+    size_t keylen
+)
+{
+    hmac_sha512_key_setup(hkey, sha512_init, sha512_final,
+                          HMAC_SHA512_MAC_SIZE, key, keylen);
+}
+
+static void
+sha512_resume(struct sha512_ctx* ctx, const uint64_t* midstate)
+{
+    sha512_init(ctx);
+    memcpy(ctx->hash, midstate, sizeof(ctx->hash));
+    ctx->msglen = SHA512_BLOCK_SIZE;
+}
+
+void
+hmac_sha512(
+    const struct hmac_sha512_key* hkey,
+    const uint8_t* msg,
+    size_t len,
+    uint8_t* mac
+)
+{
+    // The midstates already account for the SHA-384 initial hash value,
+    // only the digests need to be truncated.
+    uint8_t inner[SHA512_DIGEST_SIZE];
+    uint8_t outer[SHA512_DIGEST_SIZE];
+    struct sha512_ctx ctx;
+
+    sha512_resume(&ctx, hkey->inner);
+    sha512_update(&ctx, msg, len);
+    sha512_final(&ctx, inner);
+
+    sha512_resume(&ctx, hkey->outer);
+    sha512_update(&ctx, inner, hkey->mac_size);
+    sha512_final(&ctx, outer);
+    memcpy(mac, outer, hkey->mac_size);
+}
+
+int
+hmac_sha512_verify(
+    const struct hmac_sha512_key* hkey,
+    const uint8_t* msg,
+    size_t len,
+    const uint8_t* mac,
+    size_t maclen
+)
+{
+    uint8_t expected[HMAC_SHA512_MAC_SIZE];
+    assert(maclen <= hkey->mac_size);
+    hmac_sha512(hkey, msg, len, expected);
+    return hmac_compare(expected, mac, maclen);
+}
+
+void
+hmac_sha512_verify_batch(struct hmac_sha512_verify_job* jobs, size_t njobs)
+{
+    if (vlen_bits() < 256) {
+        for (size_t i = 0; i < njobs; i++) {
+            jobs[i].result = hmac_sha512_verify(jobs[i].hkey, jobs[i].msg,
+                                                jobs[i].len, jobs[i].mac,
+                                                jobs[i].maclen);
+        }
+        return;
+    }
+
+    const size_t lanes = sha512_multi_lanes();
+    uint64_t states[SHA2_MB_MAX_LANES][8];
+    const uint8_t* msgs[SHA2_MB_MAX_LANES];
+    size_t lens[SHA2_MB_MAX_LANES];
+    uint8_t macs[SHA2_MB_MAX_LANES][SHA512_DIGEST_SIZE];
+    uint8_t* digests[SHA2_MB_MAX_LANES];
+
+    for (size_t i = 0; i < SHA2_MB_MAX_LANES; i++) {
+        digests[i] = macs[i];
+    }
+
+    for (size_t base = 0; base < njobs; base += lanes) {
+        const size_t n = njobs - base < lanes ? njobs - base : lanes;
+        struct hmac_sha512_verify_job* const batch = &jobs[base];
+
+        // Inner hashes, from the key^ipad midstates.
+        for (size_t i = 0; i < n; i++) {
+            memcpy(states[i], batch[i].hkey->inner, sizeof(states[i]));
+            msgs[i] = batch[i].msg;
+            lens[i] = batch[i].len;
+        }
+        sha512_multi_hash(states, msgs, lens, SHA512_BLOCK_SIZE, digests, n);
+
+        // Outer hashes of the (truncated) inner digests, a single block each.
+        for (size_t i = 0; i < n; i++) {
+            memcpy(states[i], batch[i].hkey->outer, sizeof(states[i]));
+            msgs[i] = macs[i];
+            lens[i] = batch[i].hkey->mac_size;
+        }
+        sha512_multi_hash(states, msgs, lens, SHA512_BLOCK_SIZE, digests, n);
+
+        for (size_t i = 0; i < n; i++) {
+            assert(batch[i].maclen <= batch[i].hkey->mac_size);
+            batch[i].result =
+                hmac_compare(macs[i], batch[i].mac, batch[i].maclen);
+        }
+    }
+}
@@ -0,0 +1,146 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// HMAC-SHA-256/384/512 (RFC 2104) on top of the Zvknh routines.
+//
+// The compressions of the key^ipad and key^opad blocks only depend on the
+// key. They are done once, when the key is set up, and their results are
+// stored as "midstates" in the native {f,e,b,a,h,g,d,c} layout. Computing
+// a MAC then only costs the message (and padding) blocks from the inner
+// midstate, plus a single block from the outer midstate.
+
+#ifndef HMAC_SHA2_H_
+#define HMAC_SHA2_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha2.h"
+
+#define HMAC_SHA256_MAC_SIZE SHA256_DIGEST_SIZE
+#define HMAC_SHA384_MAC_SIZE SHA384_DIGEST_SIZE
+#define HMAC_SHA512_MAC_SIZE SHA512_DIGEST_SIZE
+
+struct hmac_sha256_key {
+    // Hash values after compressing key^ipad (resp. key^opad).
+    uint32_t inner[8];
+    uint32_t outer[8];
+};
+
+// Used for both HMAC-SHA-384 and HMAC-SHA-512.
+struct hmac_sha512_key {
+    // Hash values after compressing key^ipad (resp. key^opad).
+    uint64_t inner[8];
+    uint64_t outer[8];
+    // HMAC_SHA384_MAC_SIZE or HMAC_SHA512_MAC_SIZE.
+    size_t mac_size;
+};
+
+// Sets up the midstates for 'key'. Keys longer than the block size are
+// hashed first, as per RFC 2104.
+extern void
+hmac_sha256_key_init(
+    struct hmac_sha256_key* hkey,
+    const uint8_t* key,
+    size_t keylen
+);
+
+extern void
+hmac_sha384_key_init(
+    struct hmac_sha512_key* hkey,
+    const uint8_t* key,
+    size_t keylen
+);
+
+extern void
+hmac_sha512_key_init(
+    struct hmac_sha512_key* hkey,
+    const uint8_t* key,
+    size_t keylen
+);
+
+// Writes the HMAC_SHA256_MAC_SIZE bytes MAC of 'msg'.
+extern void
+hmac_sha256(
+    const struct hmac_sha256_key* hkey,
+    const uint8_t* msg,
+    size_t len,
+    uint8_t* mac
+);
+
+// Writes the hkey->mac_size bytes MAC of 'msg'.
+extern void
+hmac_sha512(
+    const struct hmac_sha512_key* hkey,
+    const uint8_t* msg,
+    size_t len,
+    uint8_t* mac
+);
+
+// Returns 0 if the first 'maclen' bytes of the MAC of 'msg' match 'mac',
+// -1 otherwise. The comparison is done in constant time.
+extern int
+hmac_sha256_verify(
+    const struct hmac_sha256_key* hkey,
+    const uint8_t* msg,
+    size_t len,
+    const uint8_t* mac,
+    size_t maclen
+);
+
+extern int
+hmac_sha512_verify(
+    const struct hmac_sha512_key* hkey,
+    const uint8_t* msg,
+    size_t len,
+    const uint8_t* mac,
+    size_t maclen
+);
+
+// Batch verification.
+//
+// Independent (key, message, MAC) triples are verified in lockstep, one per
+// element group, by the multi-buffer routines: the inner hashes of a batch
+// are computed together, then the outer ones. 'result' is set to 0 if the
+// MAC matches, -1 otherwise.
+
+struct hmac_sha256_verify_job {
+    const struct hmac_sha256_key* hkey;
+    const uint8_t* msg;
+    size_t len;
+    const uint8_t* mac;
+    size_t maclen;
+    int result;
+};
+
+struct hmac_sha512_verify_job {
+    const struct hmac_sha512_key* hkey;
+    const uint8_t* msg;
+    size_t len;
+    const uint8_t* mac;
+    size_t maclen;
+    int result;
+};
+
+// Uses the multi-buffer routines when VLEN >= 128, verifies the jobs one
+// by one otherwise.
+extern void
+hmac_sha256_verify_batch(struct hmac_sha256_verify_job* jobs, size_t njobs);
+
+// Uses the multi-buffer routines when VLEN >= 256, verifies the jobs one
+// by one otherwise.
+extern void
+hmac_sha512_verify_batch(struct hmac_sha512_verify_job* jobs, size_t njobs);
+
+#endif  // HMAC_SHA2_H_
@@ -0,0 +1,190 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hmac-sm3.h"
+
+#include <assert.h>
+#include <string.h>
+
+#define HMAC_IPAD 0x36
+#define HMAC_OPAD 0x5c
+
+// Constant time comparison of 'len' bytes, returns 0 if they match.
+static int
+hmac_compare(const uint8_t* a, const uint8_t* b, size_t len)
+{
+    uint8_t diff = 0;
+    for (size_t i = 0; i < len; i++) {
+        diff |= a[i] ^ b[i];
+    }
+    return diff == 0 ? 0 : -1;
+}
+
+//
+// HMAC-SM3
+//
+
+void
+hmac_sm3_key_init(
+    struct hmac_sm3_key* hkey,
+    const uint8_t* key,
+    size_t keylen
+)
+{
+    uint8_t block[SM3_BLOCK_SIZE] = { 0 };
+    struct sm3_ctx ctx;
+
+    if (keylen > SM3_BLOCK_SIZE) {
+        sm3_init(&ctx);
+        sm3_update(&ctx, key, keylen);
+        sm3_final(&ctx, block);
+    } else {
+        memcpy(block, key, keylen);
+    }
+
+    for (size_t i = 0; i < SM3_BLOCK_SIZE; i++) {
+        block[i] ^= HMAC_IPAD;
+    }
+    sm3_init(&ctx);
+    sm3_update(&ctx, block, SM3_BLOCK_SIZE);
+    memcpy(hkey->inner, ctx.hash, sizeof(hkey->inner));
+
+    for (size_t i = 0; i < SM3_BLOCK_SIZE; i++) {
+        block[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+    }
+    sm3_init(&ctx);
+    sm3_update(&ctx, block, SM3_BLOCK_SIZE);
+    memcpy(hkey->outer, ctx.hash, sizeof(hkey->outer));
+}
+
+// Sets up 'ctx' as if the key pad block leading to 'midstate' had been
+// hashed.
+static void
+sm3_resume(struct sm3_ctx* ctx, const uint8_t* midstate)
+{
+    sm3_init(ctx);
+    memcpy(ctx->hash, midstate, sizeof(ctx->hash));
+    ctx->msglen = SM3_BLOCK_SIZE;
+}
+
+void
+hmac_sm3(
+    const struct hmac_sm3_key* hkey,
+    const uint8_t* msg,
+    size_t len,
+    uint8_t* mac
+)
+{
+    uint8_t inner[SM3_DIGEST_SIZE];
+    struct sm3_ctx ctx;
+
+    sm3_resume(&ctx, hkey->inner);
+    sm3_update(&ctx, msg, len);
+    sm3_final(&ctx, inner);
+
+    sm3_resume(&ctx, hkey->outer);
+    sm3_update(&ctx, inner, sizeof(inner));
+    sm3_final(&ctx, mac);
+}
+
+int
+hmac_sm3_verify(
+    const struct hmac_sm3_key* hkey,
+    const uint8_t* msg,
+    size_t len,
+    const uint8_t* mac,
+    size_t maclen
+)
+{
+    uint8_t expected[HMAC_SM3_MAC_SIZE];
+    assert(maclen <= HMAC_SM3_MAC_SIZE);
+    hmac_sm3(hkey, msg, len, expected);
+    return hmac_compare(expected, mac, maclen);
+}
+
+//
+// SM2 key derivation function
+//
+
+static void
+store_be32(uint8_t* dst, uint32_t x)
+{
+    dst[0] = x >> 24;
+    dst[1] = x >> 16;
+    dst[2] = x >> 8;
+    dst[3] = x;
+}
+
+void
+sm2_kdf(uint8_t* out, size_t outlen, const uint8_t* z, size_t zlen)
+{
+    const size_t lanes = sm3_multi_lanes();
+    uint32_t ct = 1;
+    struct sm3_ctx zctx;
+
+    // Compresses the full blocks of Z, the remaining bytes are left in
+    // zctx.buf and hashed with each counter.
+    sm3_init(&zctx);
+    sm3_update(&zctx, z, zlen);
+
+    if (lanes == 0) {
+        while (outlen > 0) {
+            struct sm3_ctx ctx = zctx;
+            uint8_t digest[SM3_DIGEST_SIZE];
+            uint8_t ctbytes[4];
+            store_be32(ctbytes, ct++);
+            sm3_update(&ctx, ctbytes, sizeof(ctbytes));
+            sm3_final(&ctx, digest);
+            const size_t n = outlen < SM3_DIGEST_SIZE ? outlen : SM3_DIGEST_SIZE;
+            memcpy(out, digest, n);
+            out += n;
+            outlen -= n;
+        }
+        return;
+    }
+
+    uint8_t states[SM3_MB_MAX_LANES][SM3_DIGEST_SIZE];
+    uint8_t tails[SM3_MB_MAX_LANES][SM3_BLOCK_SIZE + 4];
+    uint8_t outs[SM3_MB_MAX_LANES][SM3_DIGEST_SIZE];
+    const uint8_t* msgs[SM3_MB_MAX_LANES];
+    size_t lens[SM3_MB_MAX_LANES];
+    uint8_t* digests[SM3_MB_MAX_LANES];
+    const uint64_t prefix_len = zctx.msglen - zctx.buflen;
+
+    // The lanes only differ by their counter.
+    for (size_t i = 0; i < lanes; i++) {
+        memcpy(tails[i], zctx.buf, zctx.buflen);
+        msgs[i] = tails[i];
+        lens[i] = zctx.buflen + 4;
+        digests[i] = outs[i];
+    }
+
+    while (outlen > 0) {
+        const size_t nblocks = (outlen + SM3_DIGEST_SIZE - 1) / SM3_DIGEST_SIZE;
+        const size_t n = nblocks < lanes ? nblocks : lanes;
+        for (size_t i = 0; i < n; i++) {
+            memcpy(states[i], zctx.hash, SM3_DIGEST_SIZE);
+            store_be32(&tails[i][zctx.buflen], ct + i);
+        }
+        sm3_multi_hash(states, msgs, lens, prefix_len, digests, n);
+        ct += n;
+
+        for (size_t i = 0; i < n; i++) {
+            const size_t len = outlen < SM3_DIGEST_SIZE ? outlen : SM3_DIGEST_SIZE;
+            memcpy(out, outs[i], len);
+            out += len;
+            outlen -= len;
+        }
+    }
+}
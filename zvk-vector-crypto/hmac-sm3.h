@@ -0,0 +1,76 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// HMAC-SM3 (RFC 2104) and the SM2 key derivation function on top of the
+// Zvksh routines.
+//
+// As for HMAC-SHA-2, the key^ipad and key^opad blocks are compressed once,
+// when the key is set up, and stored as midstates. The SM2 KDF hashes
+// Z || ct for successive 32-bit counters ct: the full blocks of Z are
+// compressed once, then the counter blocks are hashed from that midstate
+// by the multi-buffer routine, one counter per element group.
+
+#ifndef HMAC_SM3_H_
+#define HMAC_SM3_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sm3.h"
+
+#define HMAC_SM3_MAC_SIZE SM3_DIGEST_SIZE
+
+struct hmac_sm3_key {
+    // Hash values after compressing key^ipad (resp. key^opad).
+    uint8_t inner[SM3_DIGEST_SIZE];
+    uint8_t outer[SM3_DIGEST_SIZE];
+};
+
+// Sets up the midstates for 'key'. Keys longer than the block size are
+// hashed first, as per RFC 2104.
+extern void
+hmac_sm3_key_init(
+    struct hmac_sm3_key* hkey,
+    const uint8_t* key,
+    size_t keylen
+);
+
+// Writes the HMAC_SM3_MAC_SIZE bytes MAC of 'msg'.
+extern void
+hmac_sm3(
+    const struct hmac_sm3_key* hkey,
+    const uint8_t* msg,
+    size_t len,
+    uint8_t* mac
+);
+
+// Returns 0 if the first 'maclen' bytes of the MAC of 'msg' match 'mac',
+// -1 otherwise. The comparison is done in constant time.
+extern int
+hmac_sm3_verify(
+    const struct hmac_sm3_key* hkey,
+    const uint8_t* msg,
+    size_t len,
+    const uint8_t* mac,
+    size_t maclen
+);
+
+// SM2 key derivation function (GB/T 32918.4-2016, 5.4.3): writes the
+// first 'outlen' bytes of SM3(Z || 1) || SM3(Z || 2) || ..., the counter
+// being big-endian. Uses the multi-buffer routine when VLEN >= 256,
+// hashes the counters one by one otherwise.
+extern void
+sm2_kdf(uint8_t* out, size_t outlen, const uint8_t* z, size_t zlen);
+
+#endif  // HMAC_SM3_H_
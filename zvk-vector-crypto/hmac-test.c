@@ -0,0 +1,499 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hkdf.h"
+#include "hmac-drbg.h"
+#include "hmac-sha2.h"
+#include "log.h"
+#include "pbkdf2.h"
+#include "vlen-bits.h"
+
+// 'hmac-test.h' needs to be included before the test vectors.
+#include "hmac-test.h"
+#include "test-vectors/hkdf-test-vectors.h"
+#include "test-vectors/hmac-drbg-test-vectors.h"
+#include "test-vectors/hmac-sha2-test-vectors.h"
+#include "test-vectors/pbkdf2-test-vectors.h"
+
+#define NUM_RFC4231_TESTS (sizeof(rfc4231_tests) / sizeof(*rfc4231_tests))
+
+// Runs a test vector through the one-shot and verify APIs of the three
+// HMAC variants.
+static int
+run_test(const struct hmac_test* test)
+{
+    struct hmac_sha256_key key256;
+    struct hmac_sha512_key key512;
+    uint8_t mac[HMAC_SHA512_MAC_SIZE];
+
+    hmac_sha256_key_init(&key256, test->key, test->keylen);
+    hmac_sha256(&key256, test->data, test->datalen, mac);
+    size_t len = test->maclen ? test->maclen : HMAC_SHA256_MAC_SIZE;
+    if (memcmp(mac, test->sha256, len) != 0) {
+        LOG("*** HMAC-SHA-256 mismatch");
+        return 1;
+    }
+    if (hmac_sha256_verify(&key256, test->data, test->datalen,
+                           test->sha256, len) != 0) {
+        LOG("*** HMAC-SHA-256 verification failed");
+        return 1;
+    }
+
+    const struct {
+        const char* name;
+        void (*init_fn)(struct hmac_sha512_key*, const uint8_t*, size_t);
+        const uint8_t* expected;
+        size_t mac_size;
+    } variants[] = {
+        { "HMAC-SHA-384", hmac_sha384_key_init, test->sha384,
+          HMAC_SHA384_MAC_SIZE },
+        { "HMAC-SHA-512", hmac_sha512_key_init, test->sha512,
+          HMAC_SHA512_MAC_SIZE },
+    };
+    for (size_t i = 0; i < sizeof(variants) / sizeof(*variants); i++) {
+        variants[i].init_fn(&key512, test->key, test->keylen);
+        hmac_sha512(&key512, test->data, test->datalen, mac);
+        len = test->maclen ? test->maclen : variants[i].mac_size;
+        if (memcmp(mac, variants[i].expected, len) != 0) {
+            LOG("*** %s mismatch", variants[i].name);
+            return 1;
+        }
+        if (hmac_sha512_verify(&key512, test->data, test->datalen,
+                               variants[i].expected, len) != 0) {
+            LOG("*** %s verification failed", variants[i].name);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Number of tokens in the batch verification tests, enough for several
+// batches at any VLEN.
+#define NUM_BATCH_TOKENS 40
+// Tokens are 0 to 300 bytes long, covering 1 to 3 blocks (plus padding)
+// for SHA-256.
+#define MAX_TOKEN_LEN 300
+
+// Verifies a mix of RFC 4231 vectors and tokens of various lengths under
+// a few keys with the batch APIs. Every third token has a corrupted MAC.
+static int
+run_batch_tests(void)
+{
+    static uint8_t tokens[NUM_BATCH_TOKENS][MAX_TOKEN_LEN];
+    static uint8_t macs[NUM_BATCH_TOKENS][HMAC_SHA512_MAC_SIZE];
+    struct hmac_sha256_key keys256[NUM_RFC4231_TESTS];
+    struct hmac_sha512_key keys512[NUM_RFC4231_TESTS];
+    struct hmac_sha256_verify_job jobs256[NUM_RFC4231_TESTS + NUM_BATCH_TOKENS];
+    struct hmac_sha512_verify_job jobs512[NUM_RFC4231_TESTS + NUM_BATCH_TOKENS];
+    uint8_t mac[HMAC_SHA512_MAC_SIZE];
+
+    for (size_t i = 0; i < NUM_RFC4231_TESTS; i++) {
+        const struct hmac_test* const test = &rfc4231_tests[i];
+        hmac_sha256_key_init(&keys256[i], test->key, test->keylen);
+        // Alternate SHA-384 and SHA-512 keys in the same batch.
+        if (i % 2) {
+            hmac_sha384_key_init(&keys512[i], test->key, test->keylen);
+        } else {
+            hmac_sha512_key_init(&keys512[i], test->key, test->keylen);
+        }
+        jobs256[i] = (struct hmac_sha256_verify_job) {
+            .hkey = &keys256[i],
+            .msg = test->data,
+            .len = test->datalen,
+            .mac = test->sha256,
+            .maclen = test->maclen ? test->maclen : HMAC_SHA256_MAC_SIZE,
+        };
+        jobs512[i] = (struct hmac_sha512_verify_job) {
+            .hkey = &keys512[i],
+            .msg = test->data,
+            .len = test->datalen,
+            .mac = i % 2 ? test->sha384 : test->sha512,
+            .maclen = test->maclen ? test->maclen : keys512[i].mac_size,
+        };
+    }
+
+    for (size_t t = 0; t < 2; t++) {
+        const bool sha512 = t == 1;
+        for (size_t i = 0; i < NUM_BATCH_TOKENS; i++) {
+            const size_t len = (i * 73) % (MAX_TOKEN_LEN + 1);
+            const size_t k = i % NUM_RFC4231_TESTS;
+            for (size_t j = 0; j < len; j++) {
+                tokens[i][j] = (uint8_t)(i * 31 + j * 7 + t);
+            }
+            size_t maclen;
+            if (sha512) {
+                hmac_sha512(&keys512[k], tokens[i], len, macs[i]);
+                maclen = keys512[k].mac_size;
+            } else {
+                hmac_sha256(&keys256[k], tokens[i], len, macs[i]);
+                maclen = HMAC_SHA256_MAC_SIZE;
+            }
+            if (i % 3 == 0) {
+                macs[i][i % maclen] ^= 0x01;
+            }
+
+            const size_t n = NUM_RFC4231_TESTS + i;
+            if (sha512) {
+                jobs512[n] = (struct hmac_sha512_verify_job) {
+                    .hkey = &keys512[k], .msg = tokens[i], .len = len,
+                    .mac = macs[i], .maclen = maclen, .result = 1,
+                };
+            } else {
+                jobs256[n] = (struct hmac_sha256_verify_job) {
+                    .hkey = &keys256[k], .msg = tokens[i], .len = len,
+                    .mac = macs[i], .maclen = maclen, .result = 1,
+                };
+            }
+        }
+
+        const size_t njobs = NUM_RFC4231_TESTS + NUM_BATCH_TOKENS;
+        if (sha512) {
+            hmac_sha512_verify_batch(jobs512, njobs);
+        } else {
+            hmac_sha256_verify_batch(jobs256, njobs);
+        }
+        for (size_t n = 0; n < njobs; n++) {
+            const int result = sha512 ? jobs512[n].result : jobs256[n].result;
+            const bool corrupted =
+                n >= NUM_RFC4231_TESTS && (n - NUM_RFC4231_TESTS) % 3 == 0;
+            if (result != (corrupted ? -1 : 0)) {
+                LOG("*** Batch verification (%s) failed for job %zu",
+                    sha512 ? "SHA-384/512" : "SHA-256", n);
+                return 1;
+            }
+        }
+    }
+
+    // A corrupted MAC must be rejected by the one-shot API.
+    hmac_sha256(&keys256[0], tokens[0], 0, mac);
+    mac[0] ^= 0x80;
+    if (hmac_sha256_verify(&keys256[0], tokens[0], 0, mac,
+                           HMAC_SHA256_MAC_SIZE) == 0) {
+        LOG("*** Corrupted HMAC-SHA-256 accepted");
+        return 1;
+    }
+    return 0;
+}
+
+#define NUM_PBKDF2_TESTS (sizeof(pbkdf2_tests) / sizeof(*pbkdf2_tests))
+
+static int
+run_pbkdf2_test(const struct pbkdf2_test* test)
+{
+    uint8_t dk[128];
+    assert(test->dklen <= sizeof(dk));
+    if (test->sha512) {
+        pbkdf2_hmac_sha512(test->password, test->passwordlen, test->salt,
+                           test->saltlen, test->iterations, dk, test->dklen);
+    } else {
+        pbkdf2_hmac_sha256(test->password, test->passwordlen, test->salt,
+                           test->saltlen, test->iterations, dk, test->dklen);
+    }
+    return memcmp(dk, test->dk, test->dklen) == 0 ? 0 : 1;
+}
+
+// Number of candidate passwords in the PBKDF2 batch tests, enough for
+// several batches at any VLEN.
+#define NUM_PBKDF2_PASSWORDS 20
+#define PBKDF2_BATCH_DKLEN 80
+
+// Derives keys for passwords of various lengths in a single batch, and
+// checks them against one call per password.
+static int
+run_pbkdf2_batch_tests(void)
+{
+    static uint8_t passwords[NUM_PBKDF2_PASSWORDS][200];
+    static uint8_t dks[NUM_PBKDF2_PASSWORDS][PBKDF2_BATCH_DKLEN];
+    struct pbkdf2_job jobs[NUM_PBKDF2_PASSWORDS];
+    const uint8_t salt[] = "batch salt";
+    const uint64_t iterations = 17;
+    uint8_t dk[PBKDF2_BATCH_DKLEN];
+
+    for (size_t t = 0; t < 2; t++) {
+        const bool sha512 = t == 1;
+        for (size_t i = 0; i < NUM_PBKDF2_PASSWORDS; i++) {
+            const size_t len = (i * 41) % sizeof(passwords[i]);
+            for (size_t j = 0; j < len; j++) {
+                passwords[i][j] = (uint8_t)(i * 13 + j * 5 + t);
+            }
+            jobs[i] = (struct pbkdf2_job) {
+                .password = passwords[i],
+                .passwordlen = len,
+                .dk = dks[i],
+            };
+        }
+
+        if (sha512) {
+            pbkdf2_hmac_sha512_batch(jobs, NUM_PBKDF2_PASSWORDS, salt,
+                                     sizeof(salt), iterations,
+                                     PBKDF2_BATCH_DKLEN);
+        } else {
+            pbkdf2_hmac_sha256_batch(jobs, NUM_PBKDF2_PASSWORDS, salt,
+                                     sizeof(salt), iterations,
+                                     PBKDF2_BATCH_DKLEN);
+        }
+
+        for (size_t i = 0; i < NUM_PBKDF2_PASSWORDS; i++) {
+            if (sha512) {
+                pbkdf2_hmac_sha512(jobs[i].password, jobs[i].passwordlen,
+                                   salt, sizeof(salt), iterations, dk,
+                                   sizeof(dk));
+            } else {
+                pbkdf2_hmac_sha256(jobs[i].password, jobs[i].passwordlen,
+                                   salt, sizeof(salt), iterations, dk,
+                                   sizeof(dk));
+            }
+            if (memcmp(dk, dks[i], sizeof(dk)) != 0) {
+                LOG("*** PBKDF2 batch (%s) mismatch for password %zu",
+                    sha512 ? "SHA-512" : "SHA-256", i);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+#define NUM_HKDF_TESTS (sizeof(hkdf_tests) / sizeof(*hkdf_tests))
+
+static int
+run_hkdf_test(const struct hkdf_test* test)
+{
+    const enum hkdf_hash hash = test->sha384 ? HKDF_SHA384 : HKDF_SHA256;
+    const size_t hash_size = hkdf_hash_size(hash);
+    uint8_t prk[HKDF_MAX_HASH_SIZE];
+    uint8_t okm[512];
+    struct hkdf_key key;
+
+    assert(test->okmlen <= sizeof(okm));
+    hkdf_extract(hash, test->salt, test->saltlen, test->ikm, test->ikmlen,
+                 prk);
+    if (memcmp(prk, test->prk, hash_size) != 0) {
+        LOG("*** HKDF-Extract mismatch");
+        return 1;
+    }
+    hkdf_key_init(&key, hash, prk, hash_size);
+    hkdf_expand(&key, test->info, test->infolen, okm, test->okmlen);
+    if (memcmp(okm, test->okm, test->okmlen) != 0) {
+        LOG("*** HKDF-Expand mismatch");
+        return 1;
+    }
+    return 0;
+}
+
+#define NUM_TLS13_TESTS (sizeof(tls13_tests) / sizeof(*tls13_tests))
+
+#define CHECK_TLS13_OUTPUT(actual, expected, len)           \
+    do {                                                    \
+        if (memcmp((actual), (expected), (len)) != 0) {     \
+            LOG("*** %s mismatch", #actual);                \
+            return 1;                                       \
+        }                                                   \
+    } while (0)
+
+static int
+run_tls13_test(const struct tls13_test* test)
+{
+    const struct tls13_key_schedule_input input = {
+        .hash = test->sha384 ? HKDF_SHA384 : HKDF_SHA256,
+        .key_size = test->key_size,
+        .psk = test->psk,
+        .psklen = test->psklen,
+        .ecdhe = test->ecdhe,
+        .ecdhelen = test->ecdhelen,
+        .server_hello_hash = test->server_hello_hash,
+        .server_finished_hash = test->server_finished_hash,
+        .client_finished_hash = test->client_finished_hash,
+    };
+    const size_t n = hkdf_hash_size(input.hash);
+    const size_t k = test->key_size;
+    struct tls13_secrets s;
+
+    tls13_key_schedule(&input, &s);
+
+    CHECK_TLS13_OUTPUT(s.early_secret, test->early_secret, n);
+    CHECK_TLS13_OUTPUT(s.handshake_secret, test->handshake_secret, n);
+    CHECK_TLS13_OUTPUT(s.master_secret, test->master_secret, n);
+    CHECK_TLS13_OUTPUT(s.client_handshake.secret,
+                       test->client_handshake_secret, n);
+    CHECK_TLS13_OUTPUT(s.client_handshake.key, test->client_handshake_key, k);
+    CHECK_TLS13_OUTPUT(s.client_handshake.iv, test->client_handshake_iv,
+                       TLS13_IV_SIZE);
+    CHECK_TLS13_OUTPUT(s.server_handshake.secret,
+                       test->server_handshake_secret, n);
+    CHECK_TLS13_OUTPUT(s.server_handshake.key, test->server_handshake_key, k);
+    CHECK_TLS13_OUTPUT(s.server_handshake.iv, test->server_handshake_iv,
+                       TLS13_IV_SIZE);
+    CHECK_TLS13_OUTPUT(s.client_finished_key, test->client_finished_key, n);
+    CHECK_TLS13_OUTPUT(s.server_finished_key, test->server_finished_key, n);
+    CHECK_TLS13_OUTPUT(s.client_application.secret,
+                       test->client_application_secret, n);
+    CHECK_TLS13_OUTPUT(s.client_application.key,
+                       test->client_application_key, k);
+    CHECK_TLS13_OUTPUT(s.client_application.iv, test->client_application_iv,
+                       TLS13_IV_SIZE);
+    CHECK_TLS13_OUTPUT(s.server_application.secret,
+                       test->server_application_secret, n);
+    CHECK_TLS13_OUTPUT(s.server_application.key,
+                       test->server_application_key, k);
+    CHECK_TLS13_OUTPUT(s.server_application.iv, test->server_application_iv,
+                       TLS13_IV_SIZE);
+    CHECK_TLS13_OUTPUT(s.exporter_master_secret,
+                       test->exporter_master_secret, n);
+    CHECK_TLS13_OUTPUT(s.resumption_master_secret,
+                       test->resumption_master_secret, n);
+    return 0;
+}
+
+#define NUM_HMAC_DRBG_TESTS (sizeof(hmac_drbg_tests) / sizeof(*hmac_drbg_tests))
+
+static int
+run_hmac_drbg_test(const struct hmac_drbg_test* test)
+{
+    uint8_t output[1024];
+    struct hmac_drbg drbg;
+
+    assert(test->outputlen <= sizeof(output));
+    hmac_drbg_instantiate(&drbg,
+                          test->sha512 ? HMAC_DRBG_SHA512 : HMAC_DRBG_SHA256,
+                          test->entropy, test->entropylen,
+                          test->nonce, test->noncelen,
+                          test->pers, test->perslen);
+    if (test->reseed_entropy != NULL) {
+        hmac_drbg_reseed(&drbg, test->reseed_entropy, test->reseed_entropylen,
+                         test->reseed_additional, test->reseed_additionallen);
+    }
+    if (hmac_drbg_generate(&drbg, output, test->outputlen,
+                           test->additional1, test->additional1len) != 0 ||
+        hmac_drbg_generate(&drbg, output, test->outputlen,
+                           test->additional2, test->additional2len) != 0) {
+        LOG("*** Generate failed");
+        return 1;
+    }
+    if (memcmp(output, test->output, test->outputlen) != 0) {
+        LOG("*** Output mismatch");
+        return 1;
+    }
+    // Requests larger than 2^19 bits are rejected.
+    if (hmac_drbg_generate(&drbg, output, HMAC_DRBG_MAX_REQUEST_SIZE + 1,
+                           NULL, 0) == 0) {
+        LOG("*** Oversized request accepted");
+        return 1;
+    }
+    return 0;
+}
+
+#define NUM_RFC6979_TESTS (sizeof(rfc6979_tests) / sizeof(*rfc6979_tests))
+
+static int
+run_rfc6979_test(const struct rfc6979_test* test)
+{
+    uint8_t k[RFC6979_MAX_ORDER_SIZE];
+
+    rfc6979_nonce(test->sha512 ? HMAC_DRBG_SHA512 : HMAC_DRBG_SHA256,
+                  test->q, test->qlen, test->x, test->h1, test->h1len, k);
+    if (memcmp(k, test->k, (test->qlen + 7) / 8) != 0) {
+        LOG("*** Nonce mismatch");
+        return 1;
+    }
+    return 0;
+}
+
+int
+main()
+{
+    const uint64_t vlen = vlen_bits();
+    LOG("VLEN = %" PRIu64, vlen);
+
+    LOG("--- Running RFC 4231 test suite...");
+    for (size_t i = 0; i < NUM_RFC4231_TESTS; ++i) {
+        LOG("- Testing '%s'", rfc4231_tests[i].name);
+        if (run_test(&rfc4231_tests[i]) != 0) {
+            LOG("** Test vector #%zu failed", i);
+            exit(1);
+        }
+    }
+    LOG("--- Success, %zu tests were run.", NUM_RFC4231_TESTS);
+
+    LOG("--- Running batch verification tests...");
+    if (run_batch_tests() != 0) {
+        exit(1);
+    }
+    LOG("--- Success.");
+
+    LOG("--- Running PBKDF2 test suite...");
+    for (size_t i = 0; i < NUM_PBKDF2_TESTS; ++i) {
+        LOG("- Testing '%s'", pbkdf2_tests[i].name);
+        if (run_pbkdf2_test(&pbkdf2_tests[i]) != 0) {
+            LOG("** Test vector #%zu failed", i);
+            exit(1);
+        }
+    }
+    LOG("--- Success, %zu tests were run.", NUM_PBKDF2_TESTS);
+
+    LOG("--- Running PBKDF2 batch tests...");
+    if (run_pbkdf2_batch_tests() != 0) {
+        exit(1);
+    }
+    LOG("--- Success.");
+
+    LOG("--- Running HKDF test suite...");
+    for (size_t i = 0; i < NUM_HKDF_TESTS; ++i) {
+        LOG("- Testing '%s'", hkdf_tests[i].name);
+        if (run_hkdf_test(&hkdf_tests[i]) != 0) {
+            LOG("** Test vector #%zu failed", i);
+            exit(1);
+        }
+    }
+    LOG("--- Success, %zu tests were run.", NUM_HKDF_TESTS);
+
+    LOG("--- Running TLS 1.3 key schedule test suite...");
+    for (size_t i = 0; i < NUM_TLS13_TESTS; ++i) {
+        LOG("- Testing '%s'", tls13_tests[i].name);
+        if (run_tls13_test(&tls13_tests[i]) != 0) {
+            LOG("** Test vector #%zu failed", i);
+            exit(1);
+        }
+    }
+    LOG("--- Success, %zu tests were run.", NUM_TLS13_TESTS);
+
+    LOG("--- Running HMAC_DRBG test suite...");
+    for (size_t i = 0; i < NUM_HMAC_DRBG_TESTS; ++i) {
+        LOG("- Testing '%s'", hmac_drbg_tests[i].name);
+        if (run_hmac_drbg_test(&hmac_drbg_tests[i]) != 0) {
+            LOG("** Test vector #%zu failed", i);
+            exit(1);
+        }
+    }
+    LOG("--- Success, %zu tests were run.", NUM_HMAC_DRBG_TESTS);
+
+    LOG("--- Running RFC 6979 test suite...");
+    for (size_t i = 0; i < NUM_RFC6979_TESTS; ++i) {
+        LOG("- Testing '%s'", rfc6979_tests[i].name);
+        if (run_rfc6979_test(&rfc6979_tests[i]) != 0) {
+            LOG("** Test vector #%zu failed", i);
+            exit(1);
+        }
+    }
+    LOG("--- Success, %zu tests were run.", NUM_RFC6979_TESTS);
+    return 0;
+}
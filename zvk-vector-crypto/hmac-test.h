@@ -0,0 +1,141 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HMAC_TEST_H_
+#define HMAC_TEST_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// One message authenticated with HMAC-SHA-256, HMAC-SHA-384 and
+// HMAC-SHA-512 under the same key.
+struct hmac_test {
+    const char* name;
+    const uint8_t* key;
+    size_t keylen;
+    const uint8_t* data;
+    size_t datalen;
+    uint8_t sha256[32];
+    uint8_t sha384[48];
+    uint8_t sha512[64];
+    // Number of MAC bytes to compare, 0 for the full MAC.
+    size_t maclen;
+};
+
+struct pbkdf2_test {
+    const char* name;
+    // PBKDF2-HMAC-SHA-512 if true, PBKDF2-HMAC-SHA-256 otherwise.
+    bool sha512;
+    const uint8_t* password;
+    size_t passwordlen;
+    const uint8_t* salt;
+    size_t saltlen;
+    uint64_t iterations;
+    const uint8_t* dk;
+    size_t dklen;
+};
+
+struct hkdf_test {
+    const char* name;
+    // HKDF-SHA-384 if true, HKDF-SHA-256 otherwise.
+    bool sha384;
+    const uint8_t* ikm;
+    size_t ikmlen;
+    // NULL (and 0) for the default salt.
+    const uint8_t* salt;
+    size_t saltlen;
+    const uint8_t* info;
+    size_t infolen;
+    // Hash size bytes.
+    uint8_t prk[48];
+    const uint8_t* okm;
+    size_t okmlen;
+};
+
+// Inputs and outputs of a TLS 1.3 key schedule. Secrets and transcript
+// hashes are hash size bytes, keys are 'key_size' bytes.
+struct tls13_test {
+    const char* name;
+    // SHA-384 if true, SHA-256 otherwise.
+    bool sha384;
+    size_t key_size;
+    const uint8_t* psk;
+    size_t psklen;
+    const uint8_t* ecdhe;
+    size_t ecdhelen;
+    uint8_t server_hello_hash[48];
+    uint8_t server_finished_hash[48];
+    uint8_t client_finished_hash[48];
+
+    uint8_t early_secret[48];
+    uint8_t handshake_secret[48];
+    uint8_t master_secret[48];
+    uint8_t client_handshake_secret[48];
+    uint8_t client_handshake_key[32];
+    uint8_t client_handshake_iv[12];
+    uint8_t server_handshake_secret[48];
+    uint8_t server_handshake_key[32];
+    uint8_t server_handshake_iv[12];
+    uint8_t client_finished_key[48];
+    uint8_t server_finished_key[48];
+    uint8_t client_application_secret[48];
+    uint8_t client_application_key[32];
+    uint8_t client_application_iv[12];
+    uint8_t server_application_secret[48];
+    uint8_t server_application_key[32];
+    uint8_t server_application_iv[12];
+    uint8_t exporter_master_secret[48];
+    uint8_t resumption_master_secret[48];
+};
+
+// HMAC_DRBG instantiation, optional reseed, then two generate calls of
+// 'outputlen' bytes, 'output' being the result of the second one. Optional
+// inputs are NULL (and 0) when absent.
+struct hmac_drbg_test {
+    const char* name;
+    // HMAC_DRBG with SHA-512 if true, with SHA-256 otherwise.
+    bool sha512;
+    const uint8_t* entropy;
+    size_t entropylen;
+    const uint8_t* nonce;
+    size_t noncelen;
+    const uint8_t* pers;
+    size_t perslen;
+    const uint8_t* reseed_entropy;
+    size_t reseed_entropylen;
+    const uint8_t* reseed_additional;
+    size_t reseed_additionallen;
+    const uint8_t* additional1;
+    size_t additional1len;
+    const uint8_t* additional2;
+    size_t additional2len;
+    const uint8_t* output;
+    size_t outputlen;
+};
+
+// RFC 6979 nonce, 'q', 'x' and 'k' are (qlen + 7) / 8 bytes.
+struct rfc6979_test {
+    const char* name;
+    // SHA-512 if true, SHA-256 otherwise.
+    bool sha512;
+    size_t qlen;
+    uint8_t q[66];
+    uint8_t x[66];
+    const uint8_t* h1;
+    size_t h1len;
+    uint8_t k[66];
+};
+
+#endif  // HMAC_TEST_H_
@@ -0,0 +1,202 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "merkle.h"
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Smallest number of nodes worth handing to a separate thread.
+#define MERKLE_MIN_CHUNK_NODES 64
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+// Range [first, first + count) of the nodes of a level. Leaves are hashed
+// from 'data', inner nodes from the 'children' hash values. The native
+// hash values are written to 'hashes', the digests to 'digests', both
+// indexed from the start of the level.
+struct merkle_chunk {
+    const uint8_t* data;
+    size_t len;
+    size_t leaf_size;
+    const uint32_t (*children)[8];
+    uint32_t (*hashes)[8];
+    uint8_t (*digests)[SHA256_DIGEST_SIZE];
+    size_t first;
+    size_t count;
+};
+
+static void*
+merkle_leaf_worker(void* arg)
+{
+    const struct merkle_chunk* const chunk = arg;
+    const size_t lanes = sha256_multi_lanes();
+    uint32_t states[SHA2_MB_MAX_LANES][8];
+    const uint8_t* msgs[SHA2_MB_MAX_LANES];
+    size_t lens[SHA2_MB_MAX_LANES];
+    uint8_t* digests[SHA2_MB_MAX_LANES];
+
+    const size_t end = chunk->first + chunk->count;
+    for (size_t base = chunk->first; base < end; base += lanes) {
+        const size_t n = MIN(lanes, end - base);
+        for (size_t i = 0; i < n; i++) {
+            const size_t offset = (base + i) * chunk->leaf_size;
+            memcpy(states[i], kSha256InitialHash, sizeof(states[i]));
+            msgs[i] = chunk->data + offset;
+            lens[i] = MIN(chunk->leaf_size, chunk->len - offset);
+            digests[i] = chunk->digests[base + i];
+        }
+        sha256_multi_hash(states, msgs, lens, 0, digests, n);
+        memcpy(chunk->hashes[base], states, n * sizeof(states[0]));
+    }
+    return NULL;
+}
+
+static void*
+merkle_node_worker(void* arg)
+{
+    const struct merkle_chunk* const chunk = arg;
+
+    sha256_merkle_nodes_lmul1(&chunk->hashes[chunk->first][0],
+                              &chunk->children[2 * chunk->first][0],
+                              chunk->count);
+    for (size_t i = chunk->first; i < chunk->first + chunk->count; i++) {
+        sha256_digest(chunk->digests[i], chunk->hashes[i]);
+    }
+    return NULL;
+}
+
+// Splits the 'count' nodes described by 'proto' in ranges processed by
+// up to 'nthreads' threads, and waits for all of them.
+static void
+merkle_run_level(
+    const struct merkle_chunk* proto,
+    size_t count,
+    size_t nthreads,
+    void* (*worker)(void*)
+)
+{
+    struct merkle_chunk chunks[MERKLE_MAX_THREADS];
+    pthread_t threads[MERKLE_MAX_THREADS];
+    bool spawned[MERKLE_MAX_THREADS] = {};
+
+    // Ranges are a multiple of the number of lanes, so that only the last
+    // one may leave lanes unused.
+    const size_t lanes = sha256_multi_lanes();
+    size_t chunk_nodes =
+        MAX(MERKLE_MIN_CHUNK_NODES, (count + nthreads - 1) / nthreads);
+    chunk_nodes = (chunk_nodes + lanes - 1) / lanes * lanes;
+
+    size_t nchunks = 0;
+    for (size_t first = 0; first < count; first += chunk_nodes) {
+        struct merkle_chunk* const chunk = &chunks[nchunks];
+        *chunk = *proto;
+        chunk->first = first;
+        chunk->count = MIN(chunk_nodes, count - first);
+
+        spawned[nchunks] = (nchunks != 0) &&
+            pthread_create(&threads[nchunks], NULL, worker, chunk) == 0;
+        nchunks++;
+    }
+    // The calling thread processes the first range, and the ranges for
+    // which no thread could be created.
+    for (size_t c = 0; c < nchunks; c++) {
+        if (!spawned[c]) {
+            worker(&chunks[c]);
+        }
+    }
+    for (size_t c = 0; c < nchunks; c++) {
+        if (spawned[c]) {
+            pthread_join(threads[c], NULL);
+        }
+    }
+}
+
+size_t
+merkle_tree_nodes(size_t nleaves)
+{
+    size_t total = nleaves;
+    while (nleaves > 1) {
+        nleaves = (nleaves + 1) / 2;
+        total += nleaves;
+    }
+    return total;
+}
+
+void
+merkle_tree_build(
+    const uint8_t* data,
+    size_t len,
+    size_t leaf_size,
+    size_t nthreads,
+    uint8_t (*nodes)[SHA256_DIGEST_SIZE]
+)
+{
+    assert(len > 0 && leaf_size > 0);
+    assert(nthreads >= 1 && nthreads <= MERKLE_MAX_THREADS);
+
+    size_t count = (len + leaf_size - 1) / leaf_size;
+    uint32_t (*hashes)[8] = malloc(merkle_tree_nodes(count) * sizeof(*hashes));
+    assert(hashes != NULL);
+
+    struct merkle_chunk level = {
+        .data = data,
+        .len = len,
+        .leaf_size = leaf_size,
+        .hashes = hashes,
+        .digests = nodes,
+    };
+    merkle_run_level(&level, count, nthreads, merkle_leaf_worker);
+
+    while (count > 1) {
+        const size_t parents = count / 2;
+        level.children = (const uint32_t (*)[8])level.hashes;
+        level.hashes += count;
+        level.digests += count;
+        merkle_run_level(&level, parents, nthreads, merkle_node_worker);
+
+        // The last node of an odd level is promoted.
+        if (count & 1) {
+            memcpy(level.hashes[parents], level.children[count - 1],
+                   sizeof(level.hashes[parents]));
+            memcpy(level.digests[parents], level.digests[-1],
+                   sizeof(level.digests[parents]));
+        }
+        count = (count + 1) / 2;
+    }
+    free(hashes);
+}
+
+void
+merkle_root(
+    const uint8_t* data,
+    size_t len,
+    size_t leaf_size,
+    size_t nthreads,
+    uint8_t* root
+)
+{
+    const size_t nleaves = (len + leaf_size - 1) / leaf_size;
+    const size_t total = merkle_tree_nodes(nleaves);
+    uint8_t (*nodes)[SHA256_DIGEST_SIZE] = malloc(total * sizeof(*nodes));
+    assert(nodes != NULL);
+
+    merkle_tree_build(data, len, leaf_size, nthreads, nodes);
+    memcpy(root, nodes[total - 1], SHA256_DIGEST_SIZE);
+    free(nodes);
+}
@@ -0,0 +1,77 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// SHA-256 Merkle trees over fixed size leaves (e.g., 4 KiB data blocks).
+//
+// Leaf i is the SHA-256 of bytes [i * leaf_size, (i + 1) * leaf_size) of
+// the data, the last leaf covering the remaining bytes. Inner nodes are the
+// SHA-256 of the concatenation of their two children digests. When a level
+// has an odd number of nodes, its last node is promoted as is to the next
+// level.
+//
+// The tree is built level by level. Within a level, the nodes are split in
+// ranges hashed by separate threads:
+//  - leaves are hashed in lockstep, one per element group, by the
+//    multi-buffer routines,
+//  - inner nodes are computed by sha256_merkle_nodes_lmul1, which only
+//    needs the rounds of one block per node besides the children digests:
+//    the padding block of a 64 bytes message has a precomputed message
+//    schedule.
+// The hash values of a level are kept in native representation to be
+// passed as is to the next level.
+//
+// When threads cannot be created (e.g., under riscv-pk which does not
+// support them), the ranges are processed sequentially by the caller.
+
+#ifndef MERKLE_H_
+#define MERKLE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha2.h"
+
+// Maximum number of threads used to hash a level.
+#define MERKLE_MAX_THREADS 16
+
+// Returns the number of nodes, leaves included, of the tree with 'nleaves'
+// leaves.
+extern size_t
+merkle_tree_nodes(size_t nleaves);
+
+// Builds the tree over the 'len' bytes at 'data' (with len > 0), using up
+// to 'nthreads' threads. 'nodes' receives the merkle_tree_nodes() digests,
+// level by level from the leaves up to the root, which comes last.
+// Requires VLEN >= 128.
+extern void
+merkle_tree_build(
+    const uint8_t* data,
+    size_t len,
+    size_t leaf_size,
+    size_t nthreads,
+    uint8_t (*nodes)[SHA256_DIGEST_SIZE]
+);
+
+// Writes the SHA256_DIGEST_SIZE bytes root of the tree over 'data'.
+// Requires VLEN >= 128.
+extern void
+merkle_root(
+    const uint8_t* data,
+    size_t len,
+    size_t leaf_size,
+    size_t nthreads,
+    uint8_t* root
+);
+
+#endif  // MERKLE_H_
@@ -0,0 +1,283 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pbkdf2.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hmac-sha2.h"
+#include "vlen-bits.h"
+
+// Number of passwords set up at once, the vector routines process them
+// in batches of VLEN/128 (resp. VLEN/256).
+#define PBKDF2_CHUNK_LANES SHA2_MB_MAX_LANES
+
+// Lane layout expected by sha256_pbkdf2_lmul1/sha512_pbkdf2_lmul1, all in
+// native representation.
+struct sha256_pbkdf2_lane {
+    uint32_t inner[8];
+    uint32_t outer[8];
+    uint32_t u[8];
+    uint32_t t[8];
+};
+
+struct sha512_pbkdf2_lane {
+    uint64_t inner[8];
+    uint64_t outer[8];
+    uint64_t u[8];
+    uint64_t t[8];
+};
+
+// Returns a buffer holding 'salt' followed by room for the 4 bytes
+// block index.
+static uint8_t*
+pbkdf2_salt_buffer(const uint8_t* salt, size_t saltlen)
+{
+    uint8_t* msg = malloc(saltlen + 4);
+    assert(msg != NULL);
+    memcpy(msg, salt, saltlen);
+    return msg;
+}
+
+static void
+pbkdf2_set_index(uint8_t* msg, size_t saltlen, uint32_t index)
+{
+    const uint32_t be = __builtin_bswap32(index);
+    memcpy(&msg[saltlen], &be, 4);
+}
+
+//
+// PBKDF2-HMAC-SHA-256
+//
+
+// Iterations one HMAC call at a time, for VLEN < 128.
+static void
+sha256_pbkdf2_scalar(
+    struct sha256_pbkdf2_lane* lane,
+    const struct hmac_sha256_key* key,
+    uint64_t iterations
+)
+{
+    uint8_t u[SHA256_DIGEST_SIZE];
+
+    sha256_digest(u, lane->u);
+    for (uint64_t j = 0; j < iterations; j++) {
+        hmac_sha256(key, u, sizeof(u), u);
+        sha256_native(lane->u, u);
+        for (size_t k = 0; k < 8; k++) {
+            lane->t[k] ^= lane->u[k];
+        }
+    }
+}
+
+static void
+pbkdf2_sha256_chunk(
+    const struct pbkdf2_job* jobs,
+    size_t njobs,
+    uint8_t* msg,
+    size_t saltlen,
+    uint64_t iterations,
+    size_t dklen
+)
+{
+    struct sha256_pbkdf2_lane lanes[PBKDF2_CHUNK_LANES];
+    struct hmac_sha256_key keys[PBKDF2_CHUNK_LANES];
+    uint8_t block[SHA256_DIGEST_SIZE];
+    const bool vector_loop = vlen_bits() >= 128;
+
+    for (size_t i = 0; i < njobs; i++) {
+        hmac_sha256_key_init(&keys[i], jobs[i].password, jobs[i].passwordlen);
+        memcpy(lanes[i].inner, keys[i].inner, sizeof(lanes[i].inner));
+        memcpy(lanes[i].outer, keys[i].outer, sizeof(lanes[i].outer));
+    }
+
+    uint32_t index = 1;
+    for (size_t off = 0; off < dklen; off += SHA256_DIGEST_SIZE, index++) {
+        // U_1 = HMAC(P, S || INT(index)), T = U_1
+        pbkdf2_set_index(msg, saltlen, index);
+        for (size_t i = 0; i < njobs; i++) {
+            hmac_sha256(&keys[i], msg, saltlen + 4, block);
+            sha256_native(lanes[i].u, block);
+            memcpy(lanes[i].t, lanes[i].u, sizeof(lanes[i].t));
+        }
+
+        if (vector_loop) {
+            sha256_pbkdf2_lmul1((uint32_t*)lanes, iterations - 1, njobs);
+        } else {
+            for (size_t i = 0; i < njobs; i++) {
+                sha256_pbkdf2_scalar(&lanes[i], &keys[i], iterations - 1);
+            }
+        }
+
+        const size_t n = dklen - off < SHA256_DIGEST_SIZE ?
+            dklen - off : SHA256_DIGEST_SIZE;
+        for (size_t i = 0; i < njobs; i++) {
+            sha256_digest(block, lanes[i].t);
+            memcpy(&jobs[i].dk[off], block, n);
+        }
+    }
+}
+
+void
+pbkdf2_hmac_sha256_batch(
+    const struct pbkdf2_job* jobs,
+    size_t njobs,
+    const uint8_t* salt,
+    size_t saltlen,
+    uint64_t iterations,
+    size_t dklen
+)
+{
+    assert(iterations >= 1);
+    uint8_t* msg = pbkdf2_salt_buffer(salt, saltlen);
+    for (size_t i = 0; i < njobs; i += PBKDF2_CHUNK_LANES) {
+        const size_t n = njobs - i < PBKDF2_CHUNK_LANES ?
+            njobs - i : PBKDF2_CHUNK_LANES;
+        pbkdf2_sha256_chunk(&jobs[i], n, msg, saltlen, iterations, dklen);
+    }
+    free(msg);
+}
+
+void
+pbkdf2_hmac_sha256(
+    const uint8_t* password,
+    size_t passwordlen,
+    const uint8_t* salt,
+    size_t saltlen,
+    uint64_t iterations,
+    uint8_t* dk,
+    size_t dklen
+)
+{
+    const struct pbkdf2_job job = {
+        .password = password,
+        .passwordlen = passwordlen,
+        .dk = dk,
+    };
+    pbkdf2_hmac_sha256_batch(&job, 1, salt, saltlen, iterations, dklen);
+}
+
+//
+// PBKDF2-HMAC-SHA-512
+//
+
+// Iterations one HMAC call at a time, for VLEN < 256.
+static void
+sha512_pbkdf2_scalar(
+    struct sha512_pbkdf2_lane* lane,
+    const struct hmac_sha512_key* key,
+    uint64_t iterations
+)
+{
+    uint8_t u[SHA512_DIGEST_SIZE];
+
+    sha512_digest(u, lane->u);
+    for (uint64_t j = 0; j < iterations; j++) {
+        hmac_sha512(key, u, sizeof(u), u);
+        sha512_native(lane->u, u);
+        for (size_t k = 0; k < 8; k++) {
+            lane->t[k] ^= lane->u[k];
+        }
+    }
+}
+
+static void
+pbkdf2_sha512_chunk(
+    const struct pbkdf2_job* jobs,
+    size_t njobs,
+    uint8_t* msg,
+    size_t saltlen,
+    uint64_t iterations,
+    size_t dklen
+)
+{
+    struct sha512_pbkdf2_lane lanes[PBKDF2_CHUNK_LANES];
+    struct hmac_sha512_key keys[PBKDF2_CHUNK_LANES];
+    uint8_t block[SHA512_DIGEST_SIZE];
+    const bool vector_loop = vlen_bits() >= 256;
+
+    for (size_t i = 0; i < njobs; i++) {
+        hmac_sha512_key_init(&keys[i], jobs[i].password, jobs[i].passwordlen);
+        memcpy(lanes[i].inner, keys[i].inner, sizeof(lanes[i].inner));
+        memcpy(lanes[i].outer, keys[i].outer, sizeof(lanes[i].outer));
+    }
+
+    uint32_t index = 1;
+    for (size_t off = 0; off < dklen; off += SHA512_DIGEST_SIZE, index++) {
+        // U_1 = HMAC(P, S || INT(index)), T = U_1
+        pbkdf2_set_index(msg, saltlen, index);
+        for (size_t i = 0; i < njobs; i++) {
+            hmac_sha512(&keys[i], msg, saltlen + 4, block);
+            sha512_native(lanes[i].u, block);
+            memcpy(lanes[i].t, lanes[i].u, sizeof(lanes[i].t));
+        }
+
+        if (vector_loop) {
+            sha512_pbkdf2_lmul1((uint64_t*)lanes, iterations - 1, njobs);
+        } else {
+            for (size_t i = 0; i < njobs; i++) {
+                sha512_pbkdf2_scalar(&lanes[i], &keys[i], iterations - 1);
+            }
+        }
+
+        const size_t n = dklen - off < SHA512_DIGEST_SIZE ?
+            dklen - off : SHA512_DIGEST_SIZE;
+        for (size_t i = 0; i < njobs; i++) {
+            sha512_digest(block, lanes[i].t);
+            memcpy(&jobs[i].dk[off], block, n);
+        }
+    }
+}
+
+void
+pbkdf2_hmac_sha512_batch(
+    const struct pbkdf2_job* jobs,
+    size_t njobs,
+    const uint8_t* salt,
+    size_t saltlen,
+    uint64_t iterations,
+    size_t dklen
+)
+{
+    assert(iterations >= 1);
+    uint8_t* msg = pbkdf2_salt_buffer(salt, saltlen);
+    for (size_t i = 0; i < njobs; i += PBKDF2_CHUNK_LANES) {
+        const size_t n = njobs - i < PBKDF2_CHUNK_LANES ?
+            njobs - i : PBKDF2_CHUNK_LANES;
+        pbkdf2_sha512_chunk(&jobs[i], n, msg, saltlen, iterations, dklen);
+    }
+    free(msg);
+}
+
+void
+pbkdf2_hmac_sha512(
+    const uint8_t* password,
+    size_t passwordlen,
+    const uint8_t* salt,
+    size_t saltlen,
+    uint64_t iterations,
+    uint8_t* dk,
+    size_t dklen
+)
+{
+    const struct pbkdf2_job job = {
+        .password = password,
+        .passwordlen = passwordlen,
+        .dk = dk,
+    };
+    pbkdf2_hmac_sha512_batch(&job, 1, salt, saltlen, iterations, dklen);
+}
@@ -0,0 +1,85 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// PBKDF2-HMAC-SHA-256/512 (RFC 8018).
+//
+// The first HMAC of each output block is computed with the HMAC API. The
+// remaining iterations run in sha256_pbkdf2_lmul1/sha512_pbkdf2_lmul1,
+// which keep the midstates, U and T in vector registers and build the
+// fixed format HMAC blocks in registers. Several passwords (with the same
+// salt and iteration count) are derived in lockstep, one per element
+// group. When VLEN is too small for an element group (VLEN < 128 for
+// SHA-256, VLEN < 256 for SHA-512), the iterations are computed with one
+// HMAC call each instead.
+
+#ifndef PBKDF2_H_
+#define PBKDF2_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct pbkdf2_job {
+    const uint8_t* password;
+    size_t passwordlen;
+    // 'dklen' bytes output.
+    uint8_t* dk;
+};
+
+// Uses the vector iteration loop when VLEN >= 128, one HMAC call per
+// iteration otherwise.
+extern void
+pbkdf2_hmac_sha256(
+    const uint8_t* password,
+    size_t passwordlen,
+    const uint8_t* salt,
+    size_t saltlen,
+    uint64_t iterations,
+    uint8_t* dk,
+    size_t dklen
+);
+
+extern void
+pbkdf2_hmac_sha256_batch(
+    const struct pbkdf2_job* jobs,
+    size_t njobs,
+    const uint8_t* salt,
+    size_t saltlen,
+    uint64_t iterations,
+    size_t dklen
+);
+
+// Uses the vector iteration loop when VLEN >= 256, one HMAC call per
+// iteration otherwise.
+extern void
+pbkdf2_hmac_sha512(
+    const uint8_t* password,
+    size_t passwordlen,
+    const uint8_t* salt,
+    size_t saltlen,
+    uint64_t iterations,
+    uint8_t* dk,
+    size_t dklen
+);
+
+extern void
+pbkdf2_hmac_sha512_batch(
+    const struct pbkdf2_job* jobs,
+    size_t njobs,
+    const uint8_t* salt,
+    size_t saltlen,
+    uint64_t iterations,
+    size_t dklen
+);
+
+#endif  // PBKDF2_H_
@@ -19,6 +19,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "merkle.h"
+#include "sha2.h"
+#include "sha256d.h"
 #include "zvknh.h"
 #include "log.h"
 #include "vlen-bits.h"
@@ -28,8 +31,13 @@
 // The vector headers are auto-generated.
 #include "test-vectors/sha256-vectors.h"
 #include "test-vectors/sha512-vectors.h"
+#include "test-vectors/sha224-vectors.h"
+#include "test-vectors/sha384-vectors.h"
+#include "test-vectors/sha512_224-vectors.h"
+#include "test-vectors/sha512_256-vectors.h"
 
 typedef void (*block_fn_t)(uint8_t* hash, const void* block);
+typedef void (*blocks_fn_t)(uint8_t* hash, const void* data, uint64_t nblocks);
 
 struct sha_routine {
     const char* name;
@@ -37,10 +45,13 @@ struct sha_routine {
     size_t min_vlen;
     // Function pointer to the block hashing routine.
     block_fn_t hash_fn;
+    // Function pointer to the multi-block hashing routine, used instead
+    // of 'hash_fn' when set.
+    blocks_fn_t blocks_fn;
 };
 
 // SHA-256 block hashing routines.
-#define NUM_SHA256_ROUTINES (2)
+#define NUM_SHA256_ROUTINES (5)
 const struct sha_routine sha256_routines[NUM_SHA256_ROUTINES] = {
     {
         .name = "sha256_block_lmul1",
@@ -52,10 +63,25 @@ const struct sha_routine sha256_routines[NUM_SHA256_ROUTINES] = {
         .min_vlen = 128,
         .hash_fn = sha256_block_vslide_lmul1,
     },
+    {
+        .name = "sha256_blocks_lmul1",
+        .min_vlen = 128,
+        .blocks_fn = sha256_blocks_lmul1,
+    },
+    {
+        .name = "sha256_block_lmul2",
+        .min_vlen = 64,
+        .hash_fn = sha256_block_lmul2,
+    },
+    {
+        .name = "sha256_blocks_lmul2",
+        .min_vlen = 64,
+        .blocks_fn = sha256_blocks_lmul2,
+    },
 };
 
 // SHA-512 block hashing routines.
-#define NUM_SHA512_ROUTINES (2)
+#define NUM_SHA512_ROUTINES (6)
 const struct sha_routine sha512_routines[NUM_SHA512_ROUTINES] = {
     {
         .name = "sha512_block_lmul1",
@@ -67,9 +93,101 @@ const struct sha_routine sha512_routines[NUM_SHA512_ROUTINES] = {
         .min_vlen = 128,
         .hash_fn = sha512_block_lmul2,
     },
+    {
+        .name = "sha512_blocks_lmul1",
+        .min_vlen = 256,
+        .blocks_fn = sha512_blocks_lmul1,
+    },
+    {
+        .name = "sha512_blocks_lmul2",
+        .min_vlen = 128,
+        .blocks_fn = sha512_blocks_lmul2,
+    },
+    {
+        .name = "sha512_block_lmul4",
+        .min_vlen = 64,
+        .hash_fn = sha512_block_lmul4,
+    },
+    {
+        .name = "sha512_blocks_lmul4",
+        .min_vlen = 64,
+        .blocks_fn = sha512_blocks_lmul4,
+    },
 };
 
 
+// Hashes 'msg' through the streaming API, 'chunk' bytes at a time.
+typedef void (*streaming_fn_t)(
+    uint8_t* digest, const uint8_t* msg, size_t len, size_t chunk);
+
+static void
+sha256_ctx_streaming(
+    void (*init_fn)(struct sha256_ctx*),
+    void (*final_fn)(struct sha256_ctx*, uint8_t*),
+    uint8_t* digest, const uint8_t* msg, size_t len, size_t chunk)
+{
+    struct sha256_ctx ctx;
+    init_fn(&ctx);
+    for (size_t off = 0; off < len; off += chunk) {
+        sha256_update(&ctx, msg + off, len - off < chunk ? len - off : chunk);
+    }
+    final_fn(&ctx, digest);
+}
+
+static void
+sha512_ctx_streaming(
+    void (*init_fn)(struct sha512_ctx*),
+    void (*final_fn)(struct sha512_ctx*, uint8_t*),
+    uint8_t* digest, const uint8_t* msg, size_t len, size_t chunk)
+{
+    struct sha512_ctx ctx;
+    init_fn(&ctx);
+    for (size_t off = 0; off < len; off += chunk) {
+        sha512_update(&ctx, msg + off, len - off < chunk ? len - off : chunk);
+    }
+    final_fn(&ctx, digest);
+}
+
+static void
+sha256_streaming(uint8_t* digest, const uint8_t* msg, size_t len, size_t chunk)
+{
+    sha256_ctx_streaming(sha256_init, sha256_final, digest, msg, len, chunk);
+}
+
+static void
+sha224_streaming(uint8_t* digest, const uint8_t* msg, size_t len, size_t chunk)
+{
+    sha256_ctx_streaming(sha224_init, sha224_final, digest, msg, len, chunk);
+}
+
+static void
+sha512_streaming(uint8_t* digest, const uint8_t* msg, size_t len, size_t chunk)
+{
+    sha512_ctx_streaming(sha512_init, sha512_final, digest, msg, len, chunk);
+}
+
+static void
+sha384_streaming(uint8_t* digest, const uint8_t* msg, size_t len, size_t chunk)
+{
+    sha512_ctx_streaming(sha384_init, sha384_final, digest, msg, len, chunk);
+}
+
+static void
+sha512_224_streaming(
+    uint8_t* digest, const uint8_t* msg, size_t len, size_t chunk)
+{
+    sha512_ctx_streaming(sha512_224_init, sha512_224_final,
+                         digest, msg, len, chunk);
+}
+
+static void
+sha512_256_streaming(
+    uint8_t* digest, const uint8_t* msg, size_t len, size_t chunk)
+{
+    sha512_ctx_streaming(sha512_256_init, sha512_256_final,
+                         digest, msg, len, chunk);
+}
+
 struct sha_params {
     size_t digest_size;
     size_t block_size;
@@ -78,6 +196,13 @@ struct sha_params {
     const void* initial_hash;
     size_t num_routines;
     const struct sha_routine* routines;
+    // Streaming API, and the minimum VLEN (bits) it requires.
+    streaming_fn_t streaming_fn;
+    size_t streaming_min_vlen;
+    // Multi-buffer job manager initialization, and the minimum VLEN (bits)
+    // it requires. NULL when the job manager does not support the variant.
+    void (*mb_init_fn)(struct sha2_mb_mgr*);
+    size_t mb_min_vlen;
 };
 
 const struct sha_params sha256_params = {
@@ -88,6 +213,10 @@ const struct sha_params sha256_params = {
     .initial_hash_size = sizeof(kSha256InitialHash),
     .num_routines = NUM_SHA256_ROUTINES,
     .routines = sha256_routines,
+    .streaming_fn = sha256_streaming,
+    .streaming_min_vlen = 64,
+    .mb_init_fn = sha256_mb_init,
+    .mb_min_vlen = 128,
 };
 
 
@@ -99,6 +228,61 @@ const struct sha_params sha512_params = {
     .initial_hash_size = sizeof(kSha512InitialHash),
     .num_routines = NUM_SHA512_ROUTINES,
     .routines = sha512_routines,
+    .streaming_fn = sha512_streaming,
+    .streaming_min_vlen = 64,
+    .mb_init_fn = sha512_mb_init,
+    .mb_min_vlen = 256,
+};
+
+// The truncated variants run the SHA-256/SHA-512 routines from their own
+// initial hash value and compare a prefix of the digest.
+
+const struct sha_params sha224_params = {
+    .digest_size = SHA224_DIGEST_SIZE,
+    .block_size = SHA256_BLOCK_SIZE,
+    .size_field_len = sizeof(uint64_t),
+    .initial_hash = kSha224InitialHash,
+    .initial_hash_size = sizeof(kSha224InitialHash),
+    .num_routines = NUM_SHA256_ROUTINES,
+    .routines = sha256_routines,
+    .streaming_fn = sha224_streaming,
+    .streaming_min_vlen = 64,
+};
+
+const struct sha_params sha384_params = {
+    .digest_size = SHA384_DIGEST_SIZE,
+    .block_size = SHA512_BLOCK_SIZE,
+    .size_field_len = 16,    // sizeof(uint128_t)
+    .initial_hash = kSha384InitialHash,
+    .initial_hash_size = sizeof(kSha384InitialHash),
+    .num_routines = NUM_SHA512_ROUTINES,
+    .routines = sha512_routines,
+    .streaming_fn = sha384_streaming,
+    .streaming_min_vlen = 64,
+};
+
+const struct sha_params sha512_224_params = {
+    .digest_size = SHA512_224_DIGEST_SIZE,
+    .block_size = SHA512_BLOCK_SIZE,
+    .size_field_len = 16,    // sizeof(uint128_t)
+    .initial_hash = kSha512_224InitialHash,
+    .initial_hash_size = sizeof(kSha512_224InitialHash),
+    .num_routines = NUM_SHA512_ROUTINES,
+    .routines = sha512_routines,
+    .streaming_fn = sha512_224_streaming,
+    .streaming_min_vlen = 64,
+};
+
+const struct sha_params sha512_256_params = {
+    .digest_size = SHA512_256_DIGEST_SIZE,
+    .block_size = SHA512_BLOCK_SIZE,
+    .size_field_len = 16,    // sizeof(uint128_t)
+    .initial_hash = kSha512_256InitialHash,
+    .initial_hash_size = sizeof(kSha512_256InitialHash),
+    .num_routines = NUM_SHA512_ROUTINES,
+    .routines = sha512_routines,
+    .streaming_fn = sha512_256_streaming,
+    .streaming_min_vlen = 64,
 };
 
 static void
@@ -150,12 +334,30 @@ final_bswap_64(uint64_t* hash)
 }
 
 
+// Hashes 'nblocks' blocks using the given routine.
+static void
+hash_blocks(
+    const struct sha_routine* routine,
+    const struct sha_params* params,
+    uint8_t* hash,
+    const uint8_t* data,
+    size_t nblocks
+) {
+    if (routine->blocks_fn != NULL) {
+        routine->blocks_fn(hash, data, nblocks);
+        return;
+    }
+    for (size_t i = 0; i < nblocks; i++) {
+        routine->hash_fn(hash, data + i * params->block_size);
+    }
+}
+
 // Runs a particular sha_test with the given
 static int
 run_test_against_routine(
     const struct sha_test* test,
     const struct sha_params* params,
-    block_fn_t hash_block_fn
+    const struct sha_routine* routine
 ) {
     uint8_t hash[SHA512_DIGEST_SIZE];
     uint8_t buf[2 * SHA512_BLOCK_SIZE];
@@ -165,11 +367,10 @@ run_test_against_routine(
 
     memcpy(hash, params->initial_hash, params->initial_hash_size);
 
-    while (len >= params->block_size) {
-        hash_block_fn(hash, block);
-        block += params->block_size;
-        len -= params->block_size;
-    }
+    const size_t nblocks = len / params->block_size;
+    hash_blocks(routine, params, hash, block, nblocks);
+    block += nblocks * params->block_size;
+    len -= nblocks * params->block_size;
 
     // Handle partial last block.
     memcpy(buf, block, len);
@@ -202,10 +403,10 @@ run_test_against_routine(
         assert(false);
     };
 
-    hash_block_fn(hash, buf);
-    if (len > params->block_size) {
-        hash_block_fn(hash, buf + params->block_size);
-    }
+    // One or two padding blocks, depending on whether the size field
+    // fits after the delimiter in the first one.
+    hash_blocks(routine, params, hash, buf,
+                (len + params->size_field_len) / params->block_size);
 
     // Following the last block, convert from the "native" representation
     // of 'H' to the NIST order/endianness.
@@ -236,15 +437,73 @@ run_test(const struct sha_test* test, const struct sha_params* params)
             continue;
         }
         LOG("Running againt routine '%s'", routine->name);
-        int rc = run_test_against_routine(test, params, routine->hash_fn);
+        int rc = run_test_against_routine(test, params, routine);
         if (rc != 0) {
             LOG("*** Test failed against routine '%s'", routine->name);
             return rc;
         }
     }
+
+    if (vlen < params->streaming_min_vlen) {
+        return 0;
+    }
+    // Whole message at once, then in chunks smaller than, close to,
+    // and larger than a block.
+    const size_t chunks[] = {
+        test->msglen > 0 ? test->msglen : 1, 1, 7, 65, 200,
+    };
+    for (size_t i = 0; i < sizeof(chunks) / sizeof(*chunks); ++i) {
+        uint8_t digest[SHA512_DIGEST_SIZE];
+        params->streaming_fn(digest, test->msg, test->msglen, chunks[i]);
+        if (memcmp(test->md, digest, params->digest_size) != 0) {
+            LOG("*** Test failed against the streaming API, chunk size %zu",
+                chunks[i]);
+            return 1;
+        }
+    }
     return 0;
 }
 
+// Hashes all the messages of the suite through the multi-buffer job
+// manager, so that messages of different lengths share a batch.
+static int
+run_suite_multi_buffer(
+    const struct sha_test_suite* suite,
+    const struct sha_params* params
+) {
+    if (params->mb_init_fn == NULL) {
+        return 0;
+    }
+    if (vlen_bits() < params->mb_min_vlen) {
+        LOG("Skipping multi-buffer tests due to VLEN < %zu",
+            params->mb_min_vlen);
+        return 0;
+    }
+
+    struct sha2_mb_job* jobs = calloc(suite->count, sizeof(*jobs));
+    assert(jobs != NULL);
+    struct sha2_mb_mgr mgr;
+    params->mb_init_fn(&mgr);
+    for (size_t i = 0; i < suite->count; i++) {
+        jobs[i].msg = suite->tests[i].msg;
+        jobs[i].len = suite->tests[i].msglen;
+        sha2_mb_submit(&mgr, &jobs[i]);
+    }
+    sha2_mb_flush(&mgr);
+
+    int rc = 0;
+    for (size_t i = 0; i < suite->count; i++) {
+        if (memcmp(suite->tests[i].md, jobs[i].digest,
+                   params->digest_size) != 0) {
+            LOG("*** test %zu failed against the multi-buffer API", i);
+            rc = 1;
+            break;
+        }
+    }
+    free(jobs);
+    return rc;
+}
+
 static void
 run_suite(
     const struct sha_test_suite* suite,
@@ -260,30 +519,227 @@ run_suite(
             exit(1);
         }
     }
+    if (run_suite_multi_buffer(suite, params) != 0) {
+        LOG("*** multi-buffer tests failed in suite '%s'", suite->name);
+        exit(1);
+    }
 
     LOG("Success, %d tests were run.", suite->count);
 }
 
+static void
+run_suites(
+    const char* name,
+    const struct sha_test_suite* suites,
+    size_t num_suites,
+    const struct sha_params* params
+) {
+    for (size_t i = 0; i < num_suites; i++) {
+        LOG("*** Running suite %zu for %s", i, name);
+        run_suite(&suites[i], params);
+    }
+}
+
+// Bitcoin genesis block header, and its double SHA-256.
+static const uint8_t kGenesisHeader[SHA256D_HEADER_SIZE] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3b, 0xa3, 0xed, 0xfd,
+    0x7a, 0x7b, 0x12, 0xb2, 0x7a, 0xc7, 0x2c, 0x3e,
+    0x67, 0x76, 0x8f, 0x61, 0x7f, 0xc8, 0x1b, 0xc3,
+    0x88, 0x8a, 0x51, 0x32, 0x3a, 0x9f, 0xb8, 0xaa,
+    0x4b, 0x1e, 0x5e, 0x4a, 0x29, 0xab, 0x5f, 0x49,
+    0xff, 0xff, 0x00, 0x1d, 0x1d, 0xac, 0x2b, 0x7c,
+};
+
+static const uint8_t kGenesisDigest[SHA256_DIGEST_SIZE] = {
+    0x6f, 0xe2, 0x8c, 0x0a, 0xb6, 0xf1, 0xb3, 0x72,
+    0xc1, 0xa6, 0xa2, 0x46, 0xae, 0x63, 0xf7, 0x4f,
+    0x93, 0x1e, 0x83, 0x65, 0xe1, 0x5a, 0x08, 0x9c,
+    0x68, 0xd6, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Number of nonces in the sweep test, spanning several calls to
+// sha256d_sweep_lmul1 and the 2^32 wrap around.
+#define SHA256D_SWEEP_COUNT 150
+#define SHA256D_SWEEP_FIRST_NONCE 0xffffffc0
+
+// Checks the header API against the genesis block, then a sweep of nonces
+// against one sha256d() call per header.
+static int
+run_sha256d_tests(void)
+{
+    struct sha256d_header hdr;
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    static uint8_t digests[SHA256D_SWEEP_COUNT][SHA256_DIGEST_SIZE];
+    uint8_t header[SHA256D_HEADER_SIZE];
+    uint32_t nonce;
+
+    sha256d(kGenesisHeader, sizeof(kGenesisHeader), digest);
+    if (memcmp(digest, kGenesisDigest, sizeof(digest)) != 0) {
+        LOG("*** sha256d() mismatch on the genesis block header");
+        return 1;
+    }
+    sha256d_header_init(&hdr, kGenesisHeader);
+    memcpy(&nonce, &kGenesisHeader[SHA256D_HEADER_SIZE - 4], sizeof(nonce));
+    sha256d_header_hash(&hdr, nonce, digest);
+    if (memcmp(digest, kGenesisDigest, sizeof(digest)) != 0) {
+        LOG("*** sha256d_header_hash() mismatch on the genesis block header");
+        return 1;
+    }
+
+    for (size_t i = 0; i < sizeof(header); i++) {
+        header[i] = (uint8_t)(i * 29 + 7);
+    }
+    sha256d_header_init(&hdr, header);
+    sha256d_sweep(&hdr, SHA256D_SWEEP_FIRST_NONCE, SHA256D_SWEEP_COUNT,
+                  digests);
+    for (size_t i = 0; i < SHA256D_SWEEP_COUNT; i++) {
+        nonce = SHA256D_SWEEP_FIRST_NONCE + (uint32_t)i;
+        memcpy(&header[SHA256D_HEADER_SIZE - 4], &nonce, sizeof(nonce));
+        sha256d(header, sizeof(header), digest);
+        if (memcmp(digest, digests[i], sizeof(digest)) != 0) {
+            LOG("*** sha256d_sweep() mismatch for nonce 0x%08" PRIx32, nonce);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Merkle tree tests: sizes of the data and of the leaves, and number of
+// threads.
+static const struct {
+    size_t len;
+    size_t leaf_size;
+    size_t nthreads;
+} kMerkleTests[] = {
+    { 9 * 4096 + 100, 4096, 1 },
+    { 9 * 4096 + 100, 4096, 4 },
+    { 150 * 100, 100, 3 },
+    { 64, 64, 1 },
+};
+
+#define NUM_MERKLE_TESTS (sizeof(kMerkleTests) / sizeof(*kMerkleTests))
+
+// Reference tree, one sha256_update() per node.
+static void
+merkle_reference(
+    const uint8_t* data,
+    size_t len,
+    size_t leaf_size,
+    uint8_t (*nodes)[SHA256_DIGEST_SIZE]
+)
+{
+    struct sha256_ctx ctx;
+    size_t count = 0;
+    for (size_t offset = 0; offset < len; offset += leaf_size) {
+        sha256_init(&ctx);
+        sha256_update(&ctx, data + offset,
+                      len - offset < leaf_size ? len - offset : leaf_size);
+        sha256_final(&ctx, nodes[count++]);
+    }
+
+    uint8_t (*level)[SHA256_DIGEST_SIZE] = nodes;
+    while (count > 1) {
+        uint8_t (*next)[SHA256_DIGEST_SIZE] = level + count;
+        for (size_t i = 0; i + 1 < count; i += 2) {
+            sha256_init(&ctx);
+            sha256_update(&ctx, level[i], 2 * SHA256_DIGEST_SIZE);
+            sha256_final(&ctx, next[i / 2]);
+        }
+        if (count & 1) {
+            memcpy(next[count / 2], level[count - 1], SHA256_DIGEST_SIZE);
+        }
+        level = next;
+        count = (count + 1) / 2;
+    }
+}
+
+// Checks all the nodes built by merkle_tree_build(), and merkle_root(),
+// against the reference tree.
+static int
+run_merkle_tests(void)
+{
+    for (size_t t = 0; t < NUM_MERKLE_TESTS; t++) {
+        const size_t len = kMerkleTests[t].len;
+        const size_t leaf_size = kMerkleTests[t].leaf_size;
+        const size_t nleaves = (len + leaf_size - 1) / leaf_size;
+        const size_t total = merkle_tree_nodes(nleaves);
+        uint8_t* data = malloc(len);
+        uint8_t (*nodes)[SHA256_DIGEST_SIZE] = malloc(total * sizeof(*nodes));
+        uint8_t (*expected)[SHA256_DIGEST_SIZE] =
+            malloc(total * sizeof(*expected));
+        uint8_t root[SHA256_DIGEST_SIZE];
+        assert(data != NULL && nodes != NULL && expected != NULL);
+
+        for (size_t i = 0; i < len; i++) {
+            data[i] = (uint8_t)(i * 131 + i / 7 + t);
+        }
+        merkle_reference(data, len, leaf_size, expected);
+        merkle_tree_build(data, len, leaf_size, kMerkleTests[t].nthreads,
+                          nodes);
+        merkle_root(data, len, leaf_size, kMerkleTests[t].nthreads, root);
+
+        int rc = 0;
+        for (size_t i = 0; i < total; i++) {
+            if (memcmp(nodes[i], expected[i], SHA256_DIGEST_SIZE) != 0) {
+                LOG("*** Merkle test %zu: node %zu mismatch", t, i);
+                rc = 1;
+                break;
+            }
+        }
+        if (rc == 0 &&
+            memcmp(root, expected[total - 1], SHA256_DIGEST_SIZE) != 0) {
+            LOG("*** Merkle test %zu: root mismatch", t);
+            rc = 1;
+        }
+        free(data);
+        free(nodes);
+        free(expected);
+        if (rc != 0) {
+            return rc;
+        }
+    }
+    return 0;
+}
+
 int
 main()
 {
     const uint64_t vlen = vlen_bits();
     LOG("VLEN = %" PRIu64, vlen);
 
-    if (true) {
-        const size_t num_tests256 = sizeof(sha256_suites) / sizeof(*sha256_suites);
-        for (size_t i = 0; i < num_tests256; i++) {
-            LOG("*** Running suite %zu for SHA-256", i);
-            run_suite(&sha256_suites[i], &sha256_params);
+    run_suites("SHA-256", sha256_suites,
+               sizeof(sha256_suites) / sizeof(*sha256_suites), &sha256_params);
+    run_suites("SHA-512", sha512_suites,
+               sizeof(sha512_suites) / sizeof(*sha512_suites), &sha512_params);
+    run_suites("SHA-224", sha224_suites,
+               sizeof(sha224_suites) / sizeof(*sha224_suites), &sha224_params);
+    run_suites("SHA-384", sha384_suites,
+               sizeof(sha384_suites) / sizeof(*sha384_suites), &sha384_params);
+    run_suites("SHA-512/224", sha512_224_suites,
+               sizeof(sha512_224_suites) / sizeof(*sha512_224_suites),
+               &sha512_224_params);
+    run_suites("SHA-512/256", sha512_256_suites,
+               sizeof(sha512_256_suites) / sizeof(*sha512_256_suites),
+               &sha512_256_params);
+
+    if (vlen < 128) {
+        LOG("Skipping double SHA-256 and Merkle tree tests due to VLEN < 128");
+    } else {
+        LOG("--- Running double SHA-256 tests...");
+        if (run_sha256d_tests() != 0) {
+            exit(1);
         }
-    }
+        LOG("--- Success.");
 
-    if (true) {
-        const size_t num_tests512 = sizeof(sha512_suites) / sizeof(*sha512_suites);
-        for (size_t i = 0; i < num_tests512; i++) {
-            LOG("*** Running suite %zu for SHA-512", i);
-            run_suite(&sha512_suites[i], &sha512_params);
+        LOG("--- Running Merkle tree tests...");
+        if (run_merkle_tests() != 0) {
+            exit(1);
         }
+        LOG("--- Success.");
     }
 
     return 0;
@@ -0,0 +1,463 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sha2.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "vlen-bits.h"
+
+// Uses the smallest LMUL for which an element group fits in a register
+// group: LMUL=1 keeps the round constants in registers across blocks,
+// LMUL=2 and LMUL=4 reload them for every block.
+void
+sha512_blocks(uint64_t* hash, const uint8_t* data, size_t nblocks)
+{
+    const uint64_t vlen = vlen_bits();
+    if (vlen >= 256) {
+        sha512_blocks_lmul1((uint8_t*)hash, data, nblocks);
+    } else if (vlen >= 128) {
+        sha512_blocks_lmul2((uint8_t*)hash, data, nblocks);
+    } else {
+        assert(vlen >= 64);
+        sha512_blocks_lmul4((uint8_t*)hash, data, nblocks);
+    }
+}
+
+void
+sha256_blocks(uint32_t* hash, const uint8_t* data, size_t nblocks)
+{
+    const uint64_t vlen = vlen_bits();
+    if (vlen >= 128) {
+        sha256_blocks_lmul1((uint8_t*)hash, data, nblocks);
+    } else {
+        assert(vlen >= 64);
+        sha256_blocks_lmul2((uint8_t*)hash, data, nblocks);
+    }
+}
+
+// Writes the final block(s) of a message into 'buf': the 'taillen' bytes
+// left after the last full block, the 0x80 delimiter, 0s and the big-endian
+// bit length of the message in a 'lenfield' bytes field. Returns the number
+// of blocks, 1 or 2.
+static size_t
+sha2_pad(
+    uint8_t* buf,
+    const uint8_t* tail,
+    size_t taillen,
+    uint64_t msglen,
+    size_t block_size,
+    size_t lenfield
+)
+{
+    const size_t nblocks = taillen + 1 + lenfield > block_size ? 2 : 1;
+    memset(buf, 0, nblocks * block_size);
+    memcpy(buf, tail, taillen);
+    buf[taillen] = 0x80;
+    // Bit lengths larger than 64 bits are not supported, the high bits
+    // of SHA-512's 128b field are left 0.
+    const uint64_t bitlen = __builtin_bswap64(8 * msglen);
+    memcpy(&buf[nblocks * block_size - 8], &bitlen, 8);
+    return nblocks;
+}
+
+// Positions of a,...,h in the native {f,e,b,a,h,g,d,c} order, used to
+// convert hash values to and from big-endian digests.
+static const int kDigestOrder[8] = { 3, 2, 7, 6, 1, 0, 5, 4 };
+
+void
+sha256_digest(uint8_t* digest, const uint32_t* hash)
+{
+    for (size_t i = 0; i < 8; i++) {
+        const uint32_t word = __builtin_bswap32(hash[kDigestOrder[i]]);
+        memcpy(&digest[4 * i], &word, 4);
+    }
+}
+
+void
+sha512_digest(uint8_t* digest, const uint64_t* hash)
+{
+    for (size_t i = 0; i < 8; i++) {
+        const uint64_t word = __builtin_bswap64(hash[kDigestOrder[i]]);
+        memcpy(&digest[8 * i], &word, 8);
+    }
+}
+
+void
+sha256_native(uint32_t* hash, const uint8_t* digest)
+{
+    for (size_t i = 0; i < 8; i++) {
+        uint32_t word;
+        memcpy(&word, &digest[4 * i], 4);
+        hash[kDigestOrder[i]] = __builtin_bswap32(word);
+    }
+}
+
+void
+sha512_native(uint64_t* hash, const uint8_t* digest)
+{
+    for (size_t i = 0; i < 8; i++) {
+        uint64_t word;
+        memcpy(&word, &digest[8 * i], 8);
+        hash[kDigestOrder[i]] = __builtin_bswap64(word);
+    }
+}
+
+void
+sha256_init(struct sha256_ctx* ctx)
+{
+    memcpy(ctx->hash, kSha256InitialHash, sizeof(ctx->hash));
+    ctx->buflen = 0;
+    ctx->msglen = 0;
+}
+
+void
+sha256_update(struct sha256_ctx* ctx, const void* data, size_t len)
+{
+    const uint8_t* bytes = data;
+    ctx->msglen += len;
+
+    // Complete the pending block first.
+    if (ctx->buflen != 0) {
+        const size_t n = SHA256_BLOCK_SIZE - ctx->buflen < len ?
+            SHA256_BLOCK_SIZE - ctx->buflen : len;
+        memcpy(&ctx->buf[ctx->buflen], bytes, n);
+        ctx->buflen += n;
+        bytes += n;
+        len -= n;
+        if (ctx->buflen < SHA256_BLOCK_SIZE) {
+            return;
+        }
+        sha256_blocks(ctx->hash, ctx->buf, 1);
+        ctx->buflen = 0;
+    }
+
+    // Full blocks, straight from the input.
+    const size_t nblocks = len / SHA256_BLOCK_SIZE;
+    if (nblocks != 0) {
+        sha256_blocks(ctx->hash, bytes, nblocks);
+        bytes += nblocks * SHA256_BLOCK_SIZE;
+        len -= nblocks * SHA256_BLOCK_SIZE;
+    }
+
+    memcpy(ctx->buf, bytes, len);
+    ctx->buflen = len;
+}
+
+void
+sha256_final(struct sha256_ctx* ctx, uint8_t* digest)
+{
+    uint8_t buf[2 * SHA256_BLOCK_SIZE];
+    const size_t nblocks = sha2_pad(buf, ctx->buf, ctx->buflen, ctx->msglen,
+                                    SHA256_BLOCK_SIZE, 8);
+    sha256_blocks(ctx->hash, buf, nblocks);
+    sha256_digest(digest, ctx->hash);
+}
+
+void
+sha512_init(struct sha512_ctx* ctx)
+{
+    memcpy(ctx->hash, kSha512InitialHash, sizeof(ctx->hash));
+    ctx->buflen = 0;
+    ctx->msglen = 0;
+}
+
+void
+sha512_update(struct sha512_ctx* ctx, const void* data, size_t len)
+{
+    const uint8_t* bytes = data;
+    ctx->msglen += len;
+
+    // Complete the pending block first.
+    if (ctx->buflen != 0) {
+        const size_t n = SHA512_BLOCK_SIZE - ctx->buflen < len ?
+            SHA512_BLOCK_SIZE - ctx->buflen : len;
+        memcpy(&ctx->buf[ctx->buflen], bytes, n);
+        ctx->buflen += n;
+        bytes += n;
+        len -= n;
+        if (ctx->buflen < SHA512_BLOCK_SIZE) {
+            return;
+        }
+        sha512_blocks(ctx->hash, ctx->buf, 1);
+        ctx->buflen = 0;
+    }
+
+    // Full blocks, straight from the input.
+    const size_t nblocks = len / SHA512_BLOCK_SIZE;
+    if (nblocks != 0) {
+        sha512_blocks(ctx->hash, bytes, nblocks);
+        bytes += nblocks * SHA512_BLOCK_SIZE;
+        len -= nblocks * SHA512_BLOCK_SIZE;
+    }
+
+    memcpy(ctx->buf, bytes, len);
+    ctx->buflen = len;
+}
+
+void
+sha512_final(struct sha512_ctx* ctx, uint8_t* digest)
+{
+    uint8_t buf[2 * SHA512_BLOCK_SIZE];
+    const size_t nblocks = sha2_pad(buf, ctx->buf, ctx->buflen, ctx->msglen,
+                                    SHA512_BLOCK_SIZE, 16);
+    sha512_blocks(ctx->hash, buf, nblocks);
+    sha512_digest(digest, ctx->hash);
+}
+
+//
+// Truncated variants
+//
+
+void
+sha224_init(struct sha256_ctx* ctx)
+{
+    sha256_init(ctx);
+    memcpy(ctx->hash, kSha224InitialHash, sizeof(ctx->hash));
+}
+
+void
+sha224_final(struct sha256_ctx* ctx, uint8_t* digest)
+{
+    uint8_t full[SHA256_DIGEST_SIZE];
+    sha256_final(ctx, full);
+    memcpy(digest, full, SHA224_DIGEST_SIZE);
+}
+
+void
+sha384_init(struct sha512_ctx* ctx)
+{
+    sha512_init(ctx);
+    memcpy(ctx->hash, kSha384InitialHash, sizeof(ctx->hash));
+}
+
+void
+sha384_final(struct sha512_ctx* ctx, uint8_t* digest)
+{
+    uint8_t full[SHA512_DIGEST_SIZE];
+    sha512_final(ctx, full);
+    memcpy(digest, full, SHA384_DIGEST_SIZE);
+}
+
+void
+sha512_224_init(struct sha512_ctx* ctx)
+{
+    sha512_init(ctx);
+    memcpy(ctx->hash, kSha512_224InitialHash, sizeof(ctx->hash));
+}
+
+void
+sha512_224_final(struct sha512_ctx* ctx, uint8_t* digest)
+{
+    uint8_t full[SHA512_DIGEST_SIZE];
+    sha512_final(ctx, full);
+    memcpy(digest, full, SHA512_224_DIGEST_SIZE);
+}
+
+void
+sha512_256_init(struct sha512_ctx* ctx)
+{
+    sha512_init(ctx);
+    memcpy(ctx->hash, kSha512_256InitialHash, sizeof(ctx->hash));
+}
+
+void
+sha512_256_final(struct sha512_ctx* ctx, uint8_t* digest)
+{
+    uint8_t full[SHA512_DIGEST_SIZE];
+    sha512_final(ctx, full);
+    memcpy(digest, full, SHA512_256_DIGEST_SIZE);
+}
+
+//
+// Multi-buffer job manager
+//
+
+size_t
+sha256_multi_lanes(void)
+{
+    const size_t lanes = vlen_bits() / 128;
+    return lanes < SHA2_MB_MAX_LANES ? lanes : SHA2_MB_MAX_LANES;
+}
+
+size_t
+sha512_multi_lanes(void)
+{
+    const size_t lanes = vlen_bits() / 256;
+    return lanes < SHA2_MB_MAX_LANES ? lanes : SHA2_MB_MAX_LANES;
+}
+
+void
+sha256_multi_hash(
+    uint32_t (*states)[8],
+    const uint8_t* const* msgs,
+    const size_t* lens,
+    uint64_t prefix_len,
+    uint8_t* const* digests,
+    size_t nlanes
+)
+{
+    const void* ptrs[SHA2_MB_MAX_LANES];
+    uint32_t counts[SHA2_MB_MAX_LANES];
+    size_t left[SHA2_MB_MAX_LANES];
+    uint8_t tails[SHA2_MB_MAX_LANES][2 * SHA256_BLOCK_SIZE];
+
+    assert(nlanes <= sha256_multi_lanes());
+    for (size_t i = 0; i < nlanes; i++) {
+        ptrs[i] = msgs[i];
+        left[i] = lens[i] / SHA256_BLOCK_SIZE;
+    }
+    // The block counts of the routine are 32-bit, longer messages are
+    // hashed over several calls of at most UINT32_MAX blocks per lane.
+    for (;;) {
+        bool more = false;
+        for (size_t i = 0; i < nlanes; i++) {
+            counts[i] = left[i] < UINT32_MAX ? left[i] : UINT32_MAX;
+            left[i] -= counts[i];
+            more |= counts[i] != 0;
+        }
+        if (!more) {
+            break;
+        }
+        sha256_multi_blocks_lmul1(&states[0][0], ptrs, counts, nlanes);
+        for (size_t i = 0; i < nlanes; i++) {
+            ptrs[i] = (const uint8_t*)ptrs[i] +
+                (size_t)counts[i] * SHA256_BLOCK_SIZE;
+        }
+    }
+
+    for (size_t i = 0; i < nlanes; i++) {
+        const size_t full = lens[i] / SHA256_BLOCK_SIZE * SHA256_BLOCK_SIZE;
+        counts[i] = sha2_pad(tails[i], msgs[i] + full, lens[i] - full,
+                             prefix_len + lens[i], SHA256_BLOCK_SIZE, 8);
+        ptrs[i] = tails[i];
+    }
+    sha256_multi_blocks_lmul1(&states[0][0], ptrs, counts, nlanes);
+
+    for (size_t i = 0; i < nlanes; i++) {
+        sha256_digest(digests[i], states[i]);
+    }
+}
+
+void
+sha512_multi_hash(
+    uint64_t (*states)[8],
+    const uint8_t* const* msgs,
+    const size_t* lens,
+    uint64_t prefix_len,
+    uint8_t* const* digests,
+    size_t nlanes
+)
+{
+    const void* ptrs[SHA2_MB_MAX_LANES];
+    uint64_t counts[SHA2_MB_MAX_LANES];
+    uint8_t tails[SHA2_MB_MAX_LANES][2 * SHA512_BLOCK_SIZE];
+
+    assert(nlanes <= sha512_multi_lanes());
+    for (size_t i = 0; i < nlanes; i++) {
+        ptrs[i] = msgs[i];
+        counts[i] = lens[i] / SHA512_BLOCK_SIZE;
+    }
+    sha512_multi_blocks_lmul1(&states[0][0], ptrs, counts, nlanes);
+
+    for (size_t i = 0; i < nlanes; i++) {
+        const size_t full = counts[i] * SHA512_BLOCK_SIZE;
+        counts[i] = sha2_pad(tails[i], msgs[i] + full, lens[i] - full,
+                             prefix_len + lens[i], SHA512_BLOCK_SIZE, 16);
+        ptrs[i] = tails[i];
+    }
+    sha512_multi_blocks_lmul1(&states[0][0], ptrs, counts, nlanes);
+
+    for (size_t i = 0; i < nlanes; i++) {
+        sha512_digest(digests[i], states[i]);
+    }
+}
+
+// Hashes the given jobs (at most one per lane) in lockstep, from the
+// initial hash value.
+static void
+sha256_mb_process(struct sha2_mb_job** jobs, size_t njobs)
+{
+    uint32_t states[SHA2_MB_MAX_LANES][8];
+    const uint8_t* msgs[SHA2_MB_MAX_LANES];
+    size_t lens[SHA2_MB_MAX_LANES];
+    uint8_t* digests[SHA2_MB_MAX_LANES];
+
+    for (size_t i = 0; i < njobs; i++) {
+        memcpy(states[i], kSha256InitialHash, sizeof(states[i]));
+        msgs[i] = jobs[i]->msg;
+        lens[i] = jobs[i]->len;
+        digests[i] = jobs[i]->digest;
+    }
+    sha256_multi_hash(states, msgs, lens, 0, digests, njobs);
+}
+
+static void
+sha512_mb_process(struct sha2_mb_job** jobs, size_t njobs)
+{
+    uint64_t states[SHA2_MB_MAX_LANES][8];
+    const uint8_t* msgs[SHA2_MB_MAX_LANES];
+    size_t lens[SHA2_MB_MAX_LANES];
+    uint8_t* digests[SHA2_MB_MAX_LANES];
+
+    for (size_t i = 0; i < njobs; i++) {
+        memcpy(states[i], kSha512InitialHash, sizeof(states[i]));
+        msgs[i] = jobs[i]->msg;
+        lens[i] = jobs[i]->len;
+        digests[i] = jobs[i]->digest;
+    }
+    sha512_multi_hash(states, msgs, lens, 0, digests, njobs);
+}
+
+void
+sha256_mb_init(struct sha2_mb_mgr* mgr)
+{
+    mgr->nlanes = sha256_multi_lanes();
+    assert(mgr->nlanes >= 1);
+    mgr->njobs = 0;
+    mgr->sha512 = false;
+}
+
+void
+sha512_mb_init(struct sha2_mb_mgr* mgr)
+{
+    mgr->nlanes = sha512_multi_lanes();
+    assert(mgr->nlanes >= 1);
+    mgr->njobs = 0;
+    mgr->sha512 = true;
+}
+
+void
+sha2_mb_submit(struct sha2_mb_mgr* mgr, struct sha2_mb_job* job)
+{
+    mgr->jobs[mgr->njobs++] = job;
+    if (mgr->njobs == mgr->nlanes) {
+        sha2_mb_flush(mgr);
+    }
+}
+
+void
+sha2_mb_flush(struct sha2_mb_mgr* mgr)
+{
+    if (mgr->njobs == 0) {
+        return;
+    }
+    if (mgr->sha512) {
+        sha512_mb_process(mgr->jobs, mgr->njobs);
+    } else {
+        sha256_mb_process(mgr->jobs, mgr->njobs);
+    }
+    mgr->njobs = 0;
+}
@@ -0,0 +1,215 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Streaming SHA-256/SHA-512 API on top of the Zvknh multi-block routines.
+//
+// Messages can be provided in chunks of arbitrary sizes. Full blocks are
+// passed to the vector routines directly from the caller's buffer, partial
+// blocks are buffered in the context. The hash value is kept in the
+// "native" {f,e,b,a,h,g,d,c} order used by the vector routines until
+// finalization.
+//
+// Since full blocks are loaded directly from the caller's buffers, message
+// buffers (including those of multi-buffer jobs) must be 32b aligned for
+// SHA-224/256, and 64b aligned for SHA-384/512, if the processor does not
+// support unaligned vector accesses.
+
+#ifndef SHA2_H_
+#define SHA2_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "zvknh.h"
+
+struct sha256_ctx {
+    // Hash value, in native order and endianness.
+    uint32_t hash[8];
+    // Pending bytes, less than one block.
+    uint8_t buf[SHA256_BLOCK_SIZE];
+    size_t buflen;
+    // Total number of bytes hashed so far.
+    uint64_t msglen;
+};
+
+struct sha512_ctx {
+    // Hash value, in native order and endianness.
+    uint64_t hash[8];
+    // Pending bytes, less than one block.
+    uint8_t buf[SHA512_BLOCK_SIZE];
+    size_t buflen;
+    // Total number of bytes hashed so far. The bit length field of SHA-512
+    // is 128 bits wide, messages are limited to 2^61 bytes here.
+    uint64_t msglen;
+};
+
+extern void
+sha256_init(struct sha256_ctx* ctx);
+
+extern void
+sha256_update(struct sha256_ctx* ctx, const void* data, size_t len);
+
+// Writes the SHA256_DIGEST_SIZE bytes digest. 'ctx' needs to be
+// re-initialized before further use.
+extern void
+sha256_final(struct sha256_ctx* ctx, uint8_t* digest);
+
+extern void
+sha512_init(struct sha512_ctx* ctx);
+
+extern void
+sha512_update(struct sha512_ctx* ctx, const void* data, size_t len);
+
+// Writes the SHA512_DIGEST_SIZE bytes digest. 'ctx' needs to be
+// re-initialized before further use.
+extern void
+sha512_final(struct sha512_ctx* ctx, uint8_t* digest);
+
+// Conversions between a full size digest (big-endian {a,...,h}) and the
+// native representation of the hash value.
+
+extern void
+sha256_digest(uint8_t* digest, const uint32_t* hash);
+
+extern void
+sha256_native(uint32_t* hash, const uint8_t* digest);
+
+extern void
+sha512_digest(uint8_t* digest, const uint64_t* hash);
+
+extern void
+sha512_native(uint64_t* hash, const uint8_t* digest);
+
+// Compresses 'nblocks' full blocks at 'data' into 'hash', in native layout,
+// with the block routine matching the current VLEN. No padding is added.
+
+extern void
+sha256_blocks(uint32_t* hash, const uint8_t* data, size_t nblocks);
+
+extern void
+sha512_blocks(uint64_t* hash, const uint8_t* data, size_t nblocks);
+
+// Truncated variants. They only differ from SHA-256/SHA-512 in their
+// initial hash value and digest size: contexts are set up with their own
+// init function, fed with sha256_update()/sha512_update() and completed
+// with their own final function, writing the truncated digest.
+
+extern void
+sha224_init(struct sha256_ctx* ctx);
+
+// Writes the SHA224_DIGEST_SIZE bytes digest.
+extern void
+sha224_final(struct sha256_ctx* ctx, uint8_t* digest);
+
+extern void
+sha384_init(struct sha512_ctx* ctx);
+
+// Writes the SHA384_DIGEST_SIZE bytes digest.
+extern void
+sha384_final(struct sha512_ctx* ctx, uint8_t* digest);
+
+extern void
+sha512_224_init(struct sha512_ctx* ctx);
+
+// Writes the SHA512_224_DIGEST_SIZE bytes digest.
+extern void
+sha512_224_final(struct sha512_ctx* ctx, uint8_t* digest);
+
+extern void
+sha512_256_init(struct sha512_ctx* ctx);
+
+// Writes the SHA512_256_DIGEST_SIZE bytes digest.
+extern void
+sha512_256_final(struct sha512_ctx* ctx, uint8_t* digest);
+
+// Multi-buffer job manager.
+//
+// Jobs are queued until there is one per element group, i.e., VLEN/128
+// for SHA-256 and VLEN/256 for SHA-512 (capped to SHA2_MB_MAX_LANES), then
+// hashed in lockstep by the multi-buffer routines. Messages of different
+// lengths are masked out as they complete. The digest of a job is only
+// available once it has been processed, which is guaranteed after
+// sha2_mb_flush().
+
+#define SHA2_MB_MAX_LANES 16
+
+struct sha2_mb_job {
+    const uint8_t* msg;
+    size_t len;
+    // SHA256_DIGEST_SIZE or SHA512_DIGEST_SIZE bytes are written.
+    uint8_t digest[SHA512_DIGEST_SIZE];
+};
+
+struct sha2_mb_mgr {
+    struct sha2_mb_job* jobs[SHA2_MB_MAX_LANES];
+    size_t njobs;
+    size_t nlanes;
+    bool sha512;
+};
+
+// Requires VLEN >= 128.
+extern void
+sha256_mb_init(struct sha2_mb_mgr* mgr);
+
+// Requires VLEN >= 256.
+extern void
+sha512_mb_init(struct sha2_mb_mgr* mgr);
+
+// Queues 'job', hashing the queued jobs if all lanes are used.
+extern void
+sha2_mb_submit(struct sha2_mb_mgr* mgr, struct sha2_mb_job* job);
+
+// Hashes the queued jobs.
+extern void
+sha2_mb_flush(struct sha2_mb_mgr* mgr);
+
+// Lower-level multi-buffer entry points, for constructions starting from
+// precomputed hash values (e.g., HMAC midstates).
+//
+// Lane 'i' starts from states[i], in native layout, which covers the first
+// 'prefix_len' bytes of the message (a multiple of the block size). It then
+// hashes the lens[i] bytes at msgs[i] and the padding, and writes the full
+// size digest to digests[i]. 'nlanes' is at most the value returned by
+// sha256_multi_lanes() (resp. sha512_multi_lanes()).
+
+// Number of lanes, VLEN/128 capped to SHA2_MB_MAX_LANES.
+extern size_t
+sha256_multi_lanes(void);
+
+// Number of lanes, VLEN/256 capped to SHA2_MB_MAX_LANES.
+extern size_t
+sha512_multi_lanes(void);
+
+extern void
+sha256_multi_hash(
+    uint32_t (*states)[8],
+    const uint8_t* const* msgs,
+    const size_t* lens,
+    uint64_t prefix_len,
+    uint8_t* const* digests,
+    size_t nlanes
+);
+
+extern void
+sha512_multi_hash(
+    uint64_t (*states)[8],
+    const uint8_t* const* msgs,
+    const size_t* lens,
+    uint64_t prefix_len,
+    uint8_t* const* digests,
+    size_t nlanes
+);
+
+#endif  // SHA2_H_
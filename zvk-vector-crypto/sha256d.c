@@ -0,0 +1,85 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sha256d.h"
+
+#include <string.h>
+
+// Number of nonces passed to sha256d_sweep_lmul1 at once, bounded by the
+// size of the native hash values buffer.
+#define SHA256D_SWEEP_CHUNK 64
+
+void
+sha256d(const void* msg, size_t len, uint8_t* digest)
+{
+    struct sha256_ctx ctx;
+    uint8_t first[SHA256_DIGEST_SIZE];
+
+    sha256_init(&ctx);
+    sha256_update(&ctx, msg, len);
+    sha256_final(&ctx, first);
+
+    sha256_init(&ctx);
+    sha256_update(&ctx, first, sizeof(first));
+    sha256_final(&ctx, digest);
+}
+
+void
+sha256d_header_init(struct sha256d_header* hdr, const uint8_t* header)
+{
+    memcpy(hdr->midstate, kSha256InitialHash, sizeof(hdr->midstate));
+    sha256_block_lmul1((uint8_t*)hdr->midstate, header);
+    memcpy(hdr->initial_hash, kSha256InitialHash, sizeof(hdr->initial_hash));
+
+    for (size_t i = 0; i < 3; i++) {
+        uint32_t w;
+        memcpy(&w, &header[SHA256_BLOCK_SIZE + 4 * i], sizeof(w));
+        hdr->tail[i] = __builtin_bswap32(w);
+    }
+    hdr->tail[3] = 0;
+}
+
+void
+sha256d_sweep(
+    const struct sha256d_header* hdr,
+    uint32_t first_nonce,
+    size_t count,
+    uint8_t (*digests)[SHA256_DIGEST_SIZE]
+)
+{
+    uint32_t hashes[SHA256D_SWEEP_CHUNK][8];
+
+    while (count > 0) {
+        const size_t n =
+            count < SHA256D_SWEEP_CHUNK ? count : SHA256D_SWEEP_CHUNK;
+        sha256d_sweep_lmul1(&hashes[0][0], (const uint32_t*)hdr, first_nonce,
+                            n);
+        for (size_t i = 0; i < n; i++) {
+            sha256_digest(digests[i], hashes[i]);
+        }
+        first_nonce += (uint32_t)n;
+        digests += n;
+        count -= n;
+    }
+}
+
+void
+sha256d_header_hash(
+    const struct sha256d_header* hdr,
+    uint32_t nonce,
+    uint8_t* digest
+)
+{
+    sha256d_sweep(hdr, nonce, 1, (uint8_t (*)[SHA256_DIGEST_SIZE])digest);
+}
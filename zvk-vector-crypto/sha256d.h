@@ -0,0 +1,73 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Double SHA-256, SHA-256(SHA-256(m)), with a fast path for 80 bytes
+// headers hashed with many different nonces.
+//
+// The first 64 bytes of such a header do not depend on the nonce. Their
+// compression is done once, by sha256d_header_init(). The two remaining
+// compressions of each nonce, whose blocks have a fixed layout, run in
+// sha256d_sweep_lmul1, one nonce per element group.
+
+#ifndef SHA256D_H_
+#define SHA256D_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sha2.h"
+
+#define SHA256D_HEADER_SIZE 80
+
+// A header without its nonce, the last 4 bytes (a little-endian uint32_t).
+// The layout is the one expected by sha256d_sweep_lmul1.
+struct sha256d_header {
+    // Hash value after the first 64 bytes, in native representation.
+    uint32_t midstate[8];
+    // SHA-256 initial hash value, in native representation.
+    uint32_t initial_hash[8];
+    // Header bytes 64 to 75, as big-endian words, and an unused word.
+    uint32_t tail[4];
+};
+
+// Writes the SHA256_DIGEST_SIZE bytes double SHA-256 of 'msg'.
+// Requires VLEN >= 128.
+extern void
+sha256d(const void* msg, size_t len, uint8_t* digest);
+
+// Sets up 'hdr' from the first SHA256D_HEADER_SIZE - 4 bytes of 'header'.
+// Requires VLEN >= 128.
+extern void
+sha256d_header_init(struct sha256d_header* hdr, const uint8_t* header);
+
+// Writes the double SHA-256 of the header with the given nonce.
+extern void
+sha256d_header_hash(
+    const struct sha256d_header* hdr,
+    uint32_t nonce,
+    uint8_t* digest
+);
+
+// Writes the double SHA-256 of the header with nonces 'first_nonce' to
+// 'first_nonce' + 'count' - 1 (modulo 2^32) to digests[0] to
+// digests[count - 1].
+extern void
+sha256d_sweep(
+    const struct sha256d_header* hdr,
+    uint32_t first_nonce,
+    size_t count,
+    uint8_t (*digests)[SHA256_DIGEST_SIZE]
+);
+
+#endif  // SHA256D_H_
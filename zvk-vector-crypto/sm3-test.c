@@ -20,7 +20,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "hmac-sm3.h"
 #include "log.h"
+#include "sm3.h"
 #include "vlen-bits.h"
 
 #include "zvksh.h"
@@ -141,6 +143,180 @@ static int run_sm3_test(const struct sm3_test_vector* vector)
     return 0;
 }
 
+// Hashes the message in chunks of 'chunk' bytes with the streaming API,
+// exporting the state after every chunk and resuming from it in a
+// different context.
+static int run_sm3_streaming_test(
+    const uint8_t* msg,
+    size_t len,
+    const uint8_t* expected,
+    size_t chunk
+) {
+    struct sm3_ctx ctx[2];
+    uint8_t state[SM3_STATE_SIZE];
+    uint8_t digest[SM3_DIGEST_SIZE];
+    size_t cur = 0;
+
+    sm3_init(&ctx[cur]);
+    for (size_t off = 0; off < len; off += chunk) {
+        const size_t n = len - off < chunk ? len - off : chunk;
+        sm3_update(&ctx[cur], msg + off, n);
+        sm3_export(&ctx[cur], state);
+        memset(&ctx[cur], 0xa5, sizeof(ctx[cur]));
+        cur ^= 1;
+        sm3_import(&ctx[cur], state);
+    }
+    sm3_final(&ctx[cur], digest);
+
+    return memcmp(digest, expected, SM3_DIGEST_SIZE) == 0 ? 0 : 1;
+}
+
+static int run_sm3_streaming_tests(void)
+{
+    static const size_t kChunks[] = { 1, 7, 64, 100, 1000 };
+    static uint8_t msg[SM3_LONG_MESSAGE_LEN];
+
+    for (size_t i = 0; i < sizeof(msg); i++) {
+        msg[i] = 31 * i + 7;
+    }
+
+    for (size_t c = 0; c < sizeof(kChunks) / sizeof(kChunks[0]); c++) {
+        for (size_t i = 0; i < sizeof(sm3_test_vectors) / sizeof(sm3_test_vectors[0]); ++i) {
+            const struct sm3_test_vector* vector = &sm3_test_vectors[i];
+            if (run_sm3_streaming_test((const uint8_t*)vector->message,
+                                       vector->message_len,
+                                       (const uint8_t*)vector->expected,
+                                       kChunks[c]) != 0) {
+                LOG("** Streaming test vector #%zu failed with %zu bytes chunks",
+                    i, kChunks[c]);
+                return 1;
+            }
+        }
+        if (kChunks[c] == 1) {
+            // Byte by byte on the long message is too slow on Spike.
+            continue;
+        }
+        if (run_sm3_streaming_test(msg, sizeof(msg), sm3_long_digest,
+                                   kChunks[c]) != 0) {
+            LOG("** Streaming long message failed with %zu bytes chunks",
+                kChunks[c]);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Hashes all the test vectors, and prefixes of a long message, through
+// the multi-buffer job manager. The prefixes are checked against the
+// streaming API.
+static int run_sm3_multi_buffer_tests(void)
+{
+    // Prefix lengths are 17 * i * i, up to 8228 bytes.
+    enum { kPrefixes = 23 };
+    enum { kVectors = sizeof(sm3_test_vectors) / sizeof(sm3_test_vectors[0]) };
+    const size_t nvectors = kVectors;
+    static uint8_t msg[SM3_LONG_MESSAGE_LEN];
+    struct sm3_mb_job jobs[kVectors + kPrefixes];
+    struct sm3_mb_mgr mgr;
+
+    for (size_t i = 0; i < sizeof(msg); i++) {
+        msg[i] = 31 * i + 7;
+    }
+
+    sm3_mb_init(&mgr);
+    for (size_t i = 0; i < nvectors; i++) {
+        jobs[i].msg = (const uint8_t*)sm3_test_vectors[i].message;
+        jobs[i].len = sm3_test_vectors[i].message_len;
+        sm3_mb_submit(&mgr, &jobs[i]);
+    }
+    for (size_t i = 0; i < kPrefixes; i++) {
+        jobs[nvectors + i].msg = msg;
+        jobs[nvectors + i].len = 17 * i * i;
+        sm3_mb_submit(&mgr, &jobs[nvectors + i]);
+    }
+    sm3_mb_flush(&mgr);
+
+    for (size_t i = 0; i < nvectors; i++) {
+        if (memcmp(jobs[i].digest, sm3_test_vectors[i].expected,
+                   SM3_DIGEST_SIZE) != 0) {
+            LOG("** Multi-buffer test vector #%zu failed", i);
+            return 1;
+        }
+    }
+    for (size_t i = 0; i < kPrefixes; i++) {
+        struct sm3_ctx ctx;
+        uint8_t digest[SM3_DIGEST_SIZE];
+        sm3_init(&ctx);
+        sm3_update(&ctx, msg, jobs[nvectors + i].len);
+        sm3_final(&ctx, digest);
+        if (memcmp(jobs[nvectors + i].digest, digest, SM3_DIGEST_SIZE) != 0) {
+            LOG("** Multi-buffer prefix of %zu bytes failed",
+                jobs[nvectors + i].len);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int run_hmac_sm3_tests(void)
+{
+    for (size_t i = 0; i < sizeof(hmac_sm3_tests) / sizeof(hmac_sm3_tests[0]); i++) {
+        const struct hmac_sm3_test* test = &hmac_sm3_tests[i];
+        struct hmac_sm3_key hkey;
+        uint8_t mac[HMAC_SM3_MAC_SIZE];
+        uint8_t bad[HMAC_SM3_MAC_SIZE];
+
+        hmac_sm3_key_init(&hkey, test->key, test->keylen);
+        hmac_sm3(&hkey, test->data, test->datalen, mac);
+        if (memcmp(mac, test->mac, sizeof(mac)) != 0) {
+            LOG("** HMAC-SM3 test '%s' failed", test->name);
+            return 1;
+        }
+
+        memcpy(bad, test->mac, sizeof(bad));
+        bad[sizeof(bad) - 1] ^= 1;
+        if (hmac_sm3_verify(&hkey, test->data, test->datalen, test->mac,
+                            sizeof(mac)) != 0 ||
+            hmac_sm3_verify(&hkey, test->data, test->datalen, bad,
+                            sizeof(bad)) == 0) {
+            LOG("** HMAC-SM3 verification '%s' failed", test->name);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Also checks that every prefix of the output is the output of a shorter
+// derivation, covering partial batches and a partial last digest.
+static int run_sm2_kdf_tests(void)
+{
+    static uint8_t out[512];
+
+    for (size_t i = 0; i < sizeof(sm2_kdf_tests) / sizeof(sm2_kdf_tests[0]); i++) {
+        const struct sm2_kdf_test* test = &sm2_kdf_tests[i];
+        uint8_t z[128];
+
+        assert(test->zlen <= sizeof(z) && test->outlen < sizeof(out));
+        for (size_t j = 0; j < test->zlen; j++) {
+            z[j] = 13 * j + 5;
+        }
+        for (size_t len = 1; len <= test->outlen; len += 37) {
+            memset(out, 0xa5, sizeof(out));
+            sm2_kdf(out, len, z, test->zlen);
+            if (memcmp(out, test->out, len) != 0 || out[len] != 0xa5) {
+                LOG("** SM2 KDF test #%zu failed for %zu bytes", i, len);
+                return 1;
+            }
+        }
+        sm2_kdf(out, test->outlen, z, test->zlen);
+        if (memcmp(out, test->out, test->outlen) != 0) {
+            LOG("** SM2 KDF test #%zu failed", i);
+            return 1;
+        }
+    }
+    return 0;
+}
+
 int main()
 {
     const uint64_t vlen = vlen_bits();
@@ -157,6 +333,30 @@ int main()
         }
     }
 
+    LOG("--- Running SM3 streaming tests...");
+    if (run_sm3_streaming_tests() != 0) {
+        exit(1);
+    }
+
+    if (vlen >= 256) {
+        LOG("--- Running SM3 multi-buffer tests...");
+        if (run_sm3_multi_buffer_tests() != 0) {
+            exit(1);
+        }
+    } else {
+        LOG("Skipping multi-buffer tests due to VLEN < 256");
+    }
+
+    LOG("--- Running HMAC-SM3 tests...");
+    if (run_hmac_sm3_tests() != 0) {
+        exit(1);
+    }
+
+    LOG("--- Running SM2 KDF tests...");
+    if (run_sm2_kdf_tests() != 0) {
+        exit(1);
+    }
+
     LOG("--- Success, %zu tests were run.", vector_count);
     return 0;
 }
@@ -29,4 +29,20 @@ struct sm3_test_suite {
     struct sm3_test_vector* vectors;
 };
 
+struct hmac_sm3_test {
+    const char* name;
+    const uint8_t* key;
+    size_t keylen;
+    const uint8_t* data;
+    size_t datalen;
+    uint8_t mac[32];
+};
+
+// SM2 KDF of a 'zlen' bytes Z, with z[i] = (13 * i + 5) & 0xff.
+struct sm2_kdf_test {
+    size_t zlen;
+    const uint8_t* out;
+    size_t outlen;
+};
+
 #endif  // SM3_TEST_H_
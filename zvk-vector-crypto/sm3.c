@@ -0,0 +1,236 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sm3.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "vlen-bits.h"
+
+// Initial hash value, in the byte order of the digest.
+static const uint8_t kSm3InitialHash[SM3_DIGEST_SIZE] = {
+    0x73, 0x80, 0x16, 0x6f, 0x49, 0x14, 0xb2, 0xb9,
+    0x17, 0x24, 0x42, 0xd7, 0xda, 0x8a, 0x06, 0x00,
+    0xa9, 0x6f, 0x30, 0xbc, 0x16, 0x31, 0x38, 0xaa,
+    0xe3, 0x8d, 0xee, 0x4d, 0xb0, 0xfb, 0x0e, 0x4e,
+};
+
+// Uses the smallest LMUL for which the 8 words of the state fit in a
+// register group.
+void
+sm3_blocks(uint8_t* hash, const uint8_t* data, size_t nblocks)
+{
+    const uint64_t vlen = vlen_bits();
+    const uint64_t len = nblocks * SM3_BLOCK_SIZE;
+    if (vlen >= 256) {
+        zvksh_sm3_blocks_lmul1(hash, data, len);
+    } else if (vlen >= 128) {
+        zvksh_sm3_blocks_lmul2(hash, data, len);
+    } else {
+        assert(vlen >= 64);
+        zvksh_sm3_blocks_lmul4(hash, data, len);
+    }
+}
+
+void
+sm3_init(struct sm3_ctx* ctx)
+{
+    memcpy(ctx->hash, kSm3InitialHash, sizeof(ctx->hash));
+    ctx->buflen = 0;
+    ctx->msglen = 0;
+}
+
+void
+sm3_update(struct sm3_ctx* ctx, const void* data, size_t len)
+{
+    const uint8_t* bytes = data;
+    ctx->msglen += len;
+
+    // Complete the pending block first.
+    if (ctx->buflen != 0) {
+        const size_t n = SM3_BLOCK_SIZE - ctx->buflen < len ?
+            SM3_BLOCK_SIZE - ctx->buflen : len;
+        memcpy(&ctx->buf[ctx->buflen], bytes, n);
+        ctx->buflen += n;
+        bytes += n;
+        len -= n;
+        if (ctx->buflen < SM3_BLOCK_SIZE) {
+            return;
+        }
+        sm3_blocks(ctx->hash, ctx->buf, 1);
+        ctx->buflen = 0;
+    }
+
+    // Full blocks, straight from the input.
+    const size_t nblocks = len / SM3_BLOCK_SIZE;
+    if (nblocks != 0) {
+        sm3_blocks(ctx->hash, bytes, nblocks);
+        bytes += nblocks * SM3_BLOCK_SIZE;
+        len -= nblocks * SM3_BLOCK_SIZE;
+    }
+
+    memcpy(ctx->buf, bytes, len);
+    ctx->buflen = len;
+}
+
+// Writes the final block(s) of a message into 'buf': the 'taillen' bytes
+// left after the last full block, the 0x80 delimiter, 0s and the big-endian
+// bit length of the 'msglen' bytes message. Returns the number of blocks,
+// 1 or 2.
+static size_t
+sm3_pad(uint8_t* buf, const uint8_t* tail, size_t taillen, uint64_t msglen)
+{
+    const size_t nblocks = taillen + 1 + 8 > SM3_BLOCK_SIZE ? 2 : 1;
+    memset(buf, 0, nblocks * SM3_BLOCK_SIZE);
+    memcpy(buf, tail, taillen);
+    buf[taillen] = 0x80;
+    const uint64_t bitlen = __builtin_bswap64(8 * msglen);
+    memcpy(&buf[nblocks * SM3_BLOCK_SIZE - 8], &bitlen, 8);
+    return nblocks;
+}
+
+void
+sm3_final(struct sm3_ctx* ctx, uint8_t* digest)
+{
+    uint8_t buf[2 * SM3_BLOCK_SIZE];
+    const size_t nblocks = sm3_pad(buf, ctx->buf, ctx->buflen, ctx->msglen);
+    sm3_blocks(ctx->hash, buf, nblocks);
+    memcpy(digest, ctx->hash, SM3_DIGEST_SIZE);
+}
+
+void
+sm3_export(const struct sm3_ctx* ctx, uint8_t* state)
+{
+    const uint64_t msglen = __builtin_bswap64(ctx->msglen);
+    memcpy(state, ctx->hash, SM3_DIGEST_SIZE);
+    memcpy(&state[SM3_DIGEST_SIZE], &msglen, 8);
+    memset(&state[SM3_DIGEST_SIZE + 8], 0, SM3_BLOCK_SIZE);
+    memcpy(&state[SM3_DIGEST_SIZE + 8], ctx->buf, ctx->buflen);
+}
+
+void
+sm3_import(struct sm3_ctx* ctx, const uint8_t* state)
+{
+    uint64_t msglen;
+    memcpy(ctx->hash, state, SM3_DIGEST_SIZE);
+    memcpy(&msglen, &state[SM3_DIGEST_SIZE], 8);
+    ctx->msglen = __builtin_bswap64(msglen);
+    // The pending bytes are those following the last full block.
+    ctx->buflen = ctx->msglen % SM3_BLOCK_SIZE;
+    memcpy(ctx->buf, &state[SM3_DIGEST_SIZE + 8], ctx->buflen);
+}
+
+//
+// Multi-buffer job manager
+//
+
+size_t
+sm3_multi_lanes(void)
+{
+    const size_t lanes = vlen_bits() / 256;
+    return lanes < SM3_MB_MAX_LANES ? lanes : SM3_MB_MAX_LANES;
+}
+
+void
+sm3_multi_hash(
+    uint8_t (*states)[SM3_DIGEST_SIZE],
+    const uint8_t* const* msgs,
+    const size_t* lens,
+    uint64_t prefix_len,
+    uint8_t* const* digests,
+    size_t nlanes
+)
+{
+    const void* ptrs[SM3_MB_MAX_LANES];
+    uint32_t counts[SM3_MB_MAX_LANES];
+    size_t left[SM3_MB_MAX_LANES];
+    uint8_t tails[SM3_MB_MAX_LANES][2 * SM3_BLOCK_SIZE];
+
+    assert(nlanes <= sm3_multi_lanes());
+    for (size_t i = 0; i < nlanes; i++) {
+        ptrs[i] = msgs[i];
+        left[i] = lens[i] / SM3_BLOCK_SIZE;
+    }
+    // The block counts of the routine are 32-bit, longer messages are
+    // hashed over several calls of at most UINT32_MAX blocks per lane.
+    for (;;) {
+        bool more = false;
+        for (size_t i = 0; i < nlanes; i++) {
+            counts[i] = left[i] < UINT32_MAX ? left[i] : UINT32_MAX;
+            left[i] -= counts[i];
+            more |= counts[i] != 0;
+        }
+        if (!more) {
+            break;
+        }
+        zvksh_sm3_multi_blocks_lmul1(&states[0][0], ptrs, counts, nlanes);
+        for (size_t i = 0; i < nlanes; i++) {
+            ptrs[i] = (const uint8_t*)ptrs[i] +
+                (size_t)counts[i] * SM3_BLOCK_SIZE;
+        }
+    }
+
+    for (size_t i = 0; i < nlanes; i++) {
+        const size_t full = lens[i] / SM3_BLOCK_SIZE * SM3_BLOCK_SIZE;
+        counts[i] = sm3_pad(tails[i], msgs[i] + full, lens[i] - full,
+                            prefix_len + lens[i]);
+        ptrs[i] = tails[i];
+    }
+    zvksh_sm3_multi_blocks_lmul1(&states[0][0], ptrs, counts, nlanes);
+
+    for (size_t i = 0; i < nlanes; i++) {
+        memcpy(digests[i], states[i], SM3_DIGEST_SIZE);
+    }
+}
+
+void
+sm3_mb_init(struct sm3_mb_mgr* mgr)
+{
+    mgr->nlanes = sm3_multi_lanes();
+    assert(mgr->nlanes >= 1);
+    mgr->njobs = 0;
+}
+
+void
+sm3_mb_submit(struct sm3_mb_mgr* mgr, struct sm3_mb_job* job)
+{
+    mgr->jobs[mgr->njobs++] = job;
+    if (mgr->njobs == mgr->nlanes) {
+        sm3_mb_flush(mgr);
+    }
+}
+
+// Hashes the queued jobs (at most one per lane) in lockstep, from the
+// initial hash value.
+void
+sm3_mb_flush(struct sm3_mb_mgr* mgr)
+{
+    uint8_t states[SM3_MB_MAX_LANES][SM3_DIGEST_SIZE];
+    const uint8_t* msgs[SM3_MB_MAX_LANES];
+    size_t lens[SM3_MB_MAX_LANES];
+    uint8_t* digests[SM3_MB_MAX_LANES];
+
+    if (mgr->njobs == 0) {
+        return;
+    }
+    for (size_t i = 0; i < mgr->njobs; i++) {
+        memcpy(states[i], kSm3InitialHash, sizeof(states[i]));
+        msgs[i] = mgr->jobs[i]->msg;
+        lens[i] = mgr->jobs[i]->len;
+        digests[i] = mgr->jobs[i]->digest;
+    }
+    sm3_multi_hash(states, msgs, lens, 0, digests, mgr->njobs);
+    mgr->njobs = 0;
+}
@@ -0,0 +1,130 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Streaming SM3 API on top of the Zvksh block routines.
+//
+// Messages can be provided in chunks of arbitrary sizes. Full blocks are
+// passed to the vector routines directly from the caller's buffer, partial
+// blocks are buffered in the context. The hash value is kept in the byte
+// order of the digest, which is the representation used by the vector
+// routines. Since full blocks are loaded directly from the caller's
+// buffers, message buffers (including those of multi-buffer jobs) must be
+// 32b aligned if the processor does not support unaligned vector accesses.
+//
+// The state of a context can be exported to a flat SM3_STATE_SIZE bytes
+// buffer, and later imported into a context to resume hashing, e.g., from
+// a checkpoint. The exported state is the hash value, the big-endian byte
+// length of the message so far, and the pending bytes of the last partial
+// block (zero padded).
+
+#ifndef SM3_H_
+#define SM3_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "zvksh.h"
+
+#define SM3_STATE_SIZE (SM3_DIGEST_SIZE + 8 + SM3_BLOCK_SIZE)
+
+struct sm3_ctx {
+    // Hash value, in the byte order of the digest.
+    uint8_t hash[SM3_DIGEST_SIZE];
+    // Pending bytes, less than one block.
+    uint8_t buf[SM3_BLOCK_SIZE];
+    size_t buflen;
+    // Total number of bytes hashed so far.
+    uint64_t msglen;
+};
+
+extern void
+sm3_init(struct sm3_ctx* ctx);
+
+extern void
+sm3_update(struct sm3_ctx* ctx, const void* data, size_t len);
+
+// Writes the SM3_DIGEST_SIZE bytes digest. 'ctx' needs to be
+// re-initialized before further use.
+extern void
+sm3_final(struct sm3_ctx* ctx, uint8_t* digest);
+
+extern void
+sm3_export(const struct sm3_ctx* ctx, uint8_t* state);
+
+extern void
+sm3_import(struct sm3_ctx* ctx, const uint8_t* state);
+
+// Compresses 'nblocks' full blocks at 'data' into 'hash', with the block
+// routine matching the current VLEN. No padding is added.
+extern void
+sm3_blocks(uint8_t* hash, const uint8_t* data, size_t nblocks);
+
+// Multi-buffer job manager.
+//
+// Jobs are queued until there is one per element group, i.e., VLEN/256
+// (capped to SM3_MB_MAX_LANES), then hashed in lockstep by
+// zvksh_sm3_multi_blocks_lmul1. Messages of different lengths are masked
+// out as they complete. The digest of a job is only available once it has
+// been processed, which is guaranteed after sm3_mb_flush().
+
+#define SM3_MB_MAX_LANES 16
+
+struct sm3_mb_job {
+    const uint8_t* msg;
+    size_t len;
+    uint8_t digest[SM3_DIGEST_SIZE];
+};
+
+struct sm3_mb_mgr {
+    struct sm3_mb_job* jobs[SM3_MB_MAX_LANES];
+    size_t njobs;
+    size_t nlanes;
+};
+
+// Requires VLEN >= 256.
+extern void
+sm3_mb_init(struct sm3_mb_mgr* mgr);
+
+// Queues 'job', hashing the queued jobs if all lanes are used.
+extern void
+sm3_mb_submit(struct sm3_mb_mgr* mgr, struct sm3_mb_job* job);
+
+// Hashes the queued jobs.
+extern void
+sm3_mb_flush(struct sm3_mb_mgr* mgr);
+
+// Lower-level multi-buffer entry point, for constructions starting from
+// precomputed hash values (e.g., HMAC midstates).
+//
+// Lane 'i' starts from states[i], which covers the first 'prefix_len' bytes
+// of the message (a multiple of the block size). It then hashes the lens[i]
+// bytes at msgs[i] and the padding, and writes the digest to digests[i].
+// 'nlanes' is at most the value returned by sm3_multi_lanes().
+
+// Number of lanes, VLEN/256 capped to SM3_MB_MAX_LANES.
+extern size_t
+sm3_multi_lanes(void);
+
+extern void
+sm3_multi_hash(
+    uint8_t (*states)[SM3_DIGEST_SIZE],
+    const uint8_t* const* msgs,
+    const size_t* lens,
+    uint64_t prefix_len,
+    uint8_t* const* digests,
+    size_t nlanes
+);
+
+#endif  // SM3_H_
@@ -0,0 +1,239 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sm4-gcm.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "zvkg.h"
+
+// Size of the chunks of text encrypted then hashed (resp. hashed then
+// decrypted) in turn, a multiple of 16.
+#define SM4_GCM_CHUNK_BYTES 2048
+
+typedef union sm4_gcm_block {
+    uint64_t dwords[2];
+    uint32_t words[4];
+    uint8_t bytes[16];
+} sm4_gcm_block;
+
+void
+sm4_expand_key_bytes(uint32_t* rk, const uint8_t* key)
+{
+    // SM4 words are big-endian.
+    uint32_t mk[4];
+    memcpy(mk, key, sizeof(mk));
+    for (size_t i = 0; i < 4; i++) {
+        mk[i] = __builtin_bswap32(mk[i]);
+    }
+    zvksed_sm4_expand_key(rk, mk);
+}
+
+void
+sm4_ctr32_crypt(
+    const uint32_t* rk,
+    uint8_t* counter_block,
+    uint8_t* out,
+    const uint8_t* in,
+    size_t len
+)
+{
+    const size_t full_bytes = len & ~(size_t)15;
+    zvksed_sm4_ctr32_vs_lmul2(out, in, full_bytes, rk, counter_block);
+
+    if (full_bytes != len) {
+        sm4_gcm_block block = {};
+        memcpy(&block, in + full_bytes, len - full_bytes);
+        zvksed_sm4_ctr32_vs_lmul2(&block, &block, 16, rk, counter_block);
+        memcpy(out + full_bytes, &block, len - full_bytes);
+    }
+}
+
+void
+sm4_gcm_init(struct sm4_gcm_key* ctx, const uint8_t* key)
+{
+    sm4_expand_key_bytes(ctx->rk, key);
+
+    // H = E(K, 0^128), i.e., the keystream of the all zero counter block.
+    sm4_gcm_block zero = {};
+    sm4_gcm_block H = {};
+    zvksed_sm4_ctr32_vs_lmul2(&H, &H, 16, ctx->rk, &zero);
+    memcpy(ctx->H, &H, sizeof(ctx->H));
+
+    sm4_gcm_block power = H;
+    for (size_t i = 1; i <= SM4_GCM_GHASH_TABLE_SIZE; i++) {
+        memcpy(ctx->Htable[SM4_GCM_GHASH_TABLE_SIZE - i], &power, 16);
+        zvkg_vgmul(&power, ctx->H);
+    }
+}
+
+// Applies GHASH to 'len' bytes of data, updating X. The trailing partial
+// block, if any, is padded with 0s.
+static void
+sm4_gcm_ghash(
+    const struct sm4_gcm_key* ctx,
+    sm4_gcm_block* X,
+    const uint8_t* data,
+    size_t len
+)
+{
+    const size_t full_bytes = len & ~(size_t)15;
+    zvkg_ghash_aggregated_lmul4(X, data, full_bytes,
+                                ctx->Htable, SM4_GCM_GHASH_TABLE_SIZE);
+    if (full_bytes != len) {
+        sm4_gcm_block block = {};
+        memcpy(&block, data + full_bytes, len - full_bytes);
+        zvkg_vghsh(X, &block, ctx->H);
+    }
+}
+
+// Computes the Initial Counter Block (J0).
+static void
+sm4_gcm_icb(
+    const struct sm4_gcm_key* ctx,
+    sm4_gcm_block* icb,
+    const uint8_t* iv,
+    size_t ivlen
+)
+{
+    if (ivlen == 12) {
+        // ICB = IV || 0^31 || 1
+        memcpy(icb, iv, 12);
+        icb->words[3] = __builtin_bswap32(1);
+        return;
+    }
+
+    // ICB = GHASH(IV || 0^s || 0^64 || len(IV)_64)
+    assert(ivlen > 0);
+    sm4_gcm_block lengths = {};
+    memset(icb, 0, sizeof(*icb));
+    sm4_gcm_ghash(ctx, icb, iv, ivlen);
+    lengths.dwords[1] = __builtin_bswap64(8 * ivlen);
+    zvkg_vghsh(icb, &lengths, ctx->H);
+}
+
+// Computes the full 128b tag, T = GHASH(H, A, C) xor E(K, J0), given the
+// GHASH of the AAD and text (X), and the keystream block of J0.
+static void
+sm4_gcm_tag(
+    const struct sm4_gcm_key* ctx,
+    sm4_gcm_block* X,
+    const sm4_gcm_block* ek0,
+    size_t aadlen,
+    size_t len
+)
+{
+    // "Lengths block", len(A)_64 || len(C)_64
+    sm4_gcm_block lengths;
+    lengths.dwords[0] = __builtin_bswap64(8 * aadlen);
+    lengths.dwords[1] = __builtin_bswap64(8 * len);
+    zvkg_vghsh(X, &lengths, ctx->H);
+
+    X->dwords[0] ^= ek0->dwords[0];
+    X->dwords[1] ^= ek0->dwords[1];
+}
+
+// Hashes the AAD, and returns E(K, J0) in 'ek0' and inc32(J0) in 'cb'.
+static void
+sm4_gcm_start(
+    const struct sm4_gcm_key* ctx,
+    const uint8_t* iv,
+    size_t ivlen,
+    const uint8_t* aad,
+    size_t aadlen,
+    sm4_gcm_block* X,
+    sm4_gcm_block* ek0,
+    sm4_gcm_block* cb
+)
+{
+    sm4_gcm_icb(ctx, cb, iv, ivlen);
+    // The keystream of J0 leaves the counter block at inc32(J0), the
+    // first counter block of the text.
+    memset(ek0, 0, sizeof(*ek0));
+    zvksed_sm4_ctr32_vs_lmul2(ek0, ek0, 16, ctx->rk, cb);
+
+    memset(X, 0, sizeof(*X));
+    sm4_gcm_ghash(ctx, X, aad, aadlen);
+}
+
+void
+sm4_gcm_seal(
+    const struct sm4_gcm_key* ctx,
+    const uint8_t* iv,
+    size_t ivlen,
+    const uint8_t* aad,
+    size_t aadlen,
+    const uint8_t* pt,
+    size_t len,
+    uint8_t* ct,
+    uint8_t* tag,
+    size_t taglen
+)
+{
+    sm4_gcm_block X, ek0, cb;
+
+    assert(taglen >= 1 && taglen <= SM4_GCM_TAG_SIZE);
+    sm4_gcm_start(ctx, iv, ivlen, aad, aadlen, &X, &ek0, &cb);
+
+    for (size_t offset = 0; offset < len; offset += SM4_GCM_CHUNK_BYTES) {
+        const size_t n = len - offset < SM4_GCM_CHUNK_BYTES ?
+            len - offset : SM4_GCM_CHUNK_BYTES;
+        sm4_ctr32_crypt(ctx->rk, cb.bytes, ct + offset, pt + offset, n);
+        sm4_gcm_ghash(ctx, &X, ct + offset, n);
+    }
+
+    sm4_gcm_tag(ctx, &X, &ek0, aadlen, len);
+    memcpy(tag, &X, taglen);
+}
+
+int
+sm4_gcm_open(
+    const struct sm4_gcm_key* ctx,
+    const uint8_t* iv,
+    size_t ivlen,
+    const uint8_t* aad,
+    size_t aadlen,
+    const uint8_t* ct,
+    size_t len,
+    const uint8_t* tag,
+    size_t taglen,
+    uint8_t* pt
+)
+{
+    sm4_gcm_block X, ek0, cb;
+
+    assert(taglen >= 1 && taglen <= SM4_GCM_TAG_SIZE);
+    sm4_gcm_start(ctx, iv, ivlen, aad, aadlen, &X, &ek0, &cb);
+
+    // The chunk is hashed before it is decrypted, which allows in-place
+    // decryption.
+    for (size_t offset = 0; offset < len; offset += SM4_GCM_CHUNK_BYTES) {
+        const size_t n = len - offset < SM4_GCM_CHUNK_BYTES ?
+            len - offset : SM4_GCM_CHUNK_BYTES;
+        sm4_gcm_ghash(ctx, &X, ct + offset, n);
+        sm4_ctr32_crypt(ctx->rk, cb.bytes, pt + offset, ct + offset, n);
+    }
+
+    sm4_gcm_tag(ctx, &X, &ek0, aadlen, len);
+    uint8_t diff = 0;
+    for (size_t i = 0; i < taglen; i++) {
+        diff |= X.bytes[i] ^ tag[i];
+    }
+    if (diff != 0) {
+        memset(pt, 0, len);
+        return -1;
+    }
+    return 0;
+}
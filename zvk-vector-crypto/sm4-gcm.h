@@ -0,0 +1,101 @@
+// Copyright 2023 Rivos Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// SM4-CTR and SM4-GCM (NIST SP 800-38D with the SM4 block cipher, as used
+// by the TLS_SM4_GCM_SM3 cipher suite of RFC 8998).
+//
+// The counter blocks are generated in registers by zvksed_sm4_ctr32_vs_lmul2,
+// and GHASH uses the aggregated Zvkg kernel with precomputed powers of H, as
+// the GMAC and parallel AES-GCM code of aes-gcm-test.c does. Seal and open
+// are stitched: the text is processed in chunks small enough to stay in the
+// L1 cache, each chunk being hashed right after (resp. before) it is
+// encrypted (resp. decrypted), so the text is only read once from memory.
+//
+// Keys are byte strings, as are the texts. Text buffers must be 32b
+// aligned if the processor does not support unaligned vector accesses.
+// Requires VLEN >= 128.
+
+#ifndef SM4_GCM_H_
+#define SM4_GCM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "zvksed.h"
+
+#define SM4_KEY_SIZE 16
+#define SM4_GCM_TAG_SIZE 16
+
+// Number of powers of H precomputed at key setup.
+#define SM4_GCM_GHASH_TABLE_SIZE 16
+
+struct sm4_gcm_key {
+    uint32_t rk[ZVKSED_SM4_EXPANDED_KEY_WORDS];
+    uint64_t H[2];
+    // Htable[i] = H^(SM4_GCM_GHASH_TABLE_SIZE - i), H^1 is the last entry.
+    uint64_t Htable[SM4_GCM_GHASH_TABLE_SIZE][2];
+};
+
+// Expands the 16 bytes 'key' into the round keys of zvksed_sm4_expand_key.
+extern void
+sm4_expand_key_bytes(uint32_t* rk, const uint8_t* key);
+
+// CTR encryption (or decryption) of 'len' bytes, starting with the given
+// counter block, which is updated to the next unused one. A trailing
+// partial block uses up a whole counter block.
+extern void
+sm4_ctr32_crypt(
+    const uint32_t* rk,
+    uint8_t* counter_block,
+    uint8_t* out,
+    const uint8_t* in,
+    size_t len
+);
+
+extern void
+sm4_gcm_init(struct sm4_gcm_key* ctx, const uint8_t* key);
+
+// Encrypts 'len' bytes from 'pt' into 'ct' and computes the 'taglen'
+// bytes tag, 1 <= taglen <= 16.
+extern void
+sm4_gcm_seal(
+    const struct sm4_gcm_key* ctx,
+    const uint8_t* iv,
+    size_t ivlen,
+    const uint8_t* aad,
+    size_t aadlen,
+    const uint8_t* pt,
+    size_t len,
+    uint8_t* ct,
+    uint8_t* tag,
+    size_t taglen
+);
+
+// Returns 0 if the tag matches, in which case 'pt' holds the plain text.
+// Otherwise 'pt' is zeroed and -1 is returned.
+extern int
+sm4_gcm_open(
+    const struct sm4_gcm_key* ctx,
+    const uint8_t* iv,
+    size_t ivlen,
+    const uint8_t* aad,
+    size_t aadlen,
+    const uint8_t* ct,
+    size_t len,
+    const uint8_t* tag,
+    size_t taglen,
+    uint8_t* pt
+);
+
+#endif  // SM4_GCM_H_
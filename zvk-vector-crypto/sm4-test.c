@@ -20,9 +20,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "sm4-gcm.h"
+#include "vlen-bits.h"
 #include "zvksed.h"
 #include "sm4-test.h"
+#include "test-vectors/sm4-gcm-test-vectors.h"
 #include "test-vectors/sm4-test-vectors.h"
+#include "test-vectors/sm4-xts-test-vectors.h"
 
 __attribute__((aligned(16)))
 uint32_t buf[128] = {0};
@@ -52,25 +56,512 @@ static int run_sm4_test(struct sm4_test_vector *vector)
     return memcmp(vector->output, buf, vector->message_len);
 }
 
+typedef void (*sm4_rk_fn)(void* dest, const void* src, uint64_t length,
+                          const uint32_t* rk);
+
+struct sm4_routine {
+    const char* name;
+    sm4_rk_fn encode;
+    sm4_rk_fn decode;
+    uint64_t min_vlen;
+};
+
+static const struct sm4_routine sm4_routines[] = {
+    {
+        .name = "zvksed_sm4_rk_vv",
+        .encode = &zvksed_sm4_encode_rk_vv,
+        .decode = &zvksed_sm4_decode_rk_vv,
+        .min_vlen = 128,
+    },
+    {
+        .name = "zvksed_sm4_rk_vs_lmul1",
+        .encode = &zvksed_sm4_encode_rk_vs_lmul1,
+        .decode = &zvksed_sm4_decode_rk_vs_lmul1,
+        .min_vlen = 128,
+    },
+    {
+        .name = "zvksed_sm4_rk_vs_lmul2",
+        .encode = &zvksed_sm4_encode_rk_vs_lmul2,
+        .decode = &zvksed_sm4_decode_rk_vs_lmul2,
+        .min_vlen = 64,
+    },
+    {
+        .name = "zvksed_sm4_rk_vs_lmul4",
+        .encode = &zvksed_sm4_encode_rk_vs_lmul4,
+        .decode = &zvksed_sm4_decode_rk_vs_lmul4,
+        .min_vlen = 32,
+    },
+};
+
+static int run_sm4_test_routine(struct sm4_test_vector *vector,
+                                const struct sm4_routine *routine)
+{
+    uint32_t rk[ZVKSED_SM4_EXPANDED_KEY_WORDS];
+    const sm4_rk_fn fn = vector->encrypt ? routine->encode : routine->decode;
+
+    assert(vector->message_len % 16 == 0 &&
+           vector->message_len < sizeof(buf));
+
+    zvksed_sm4_expand_key(rk, vector->master_key);
+    memcpy(buf, vector->message, vector->message_len);
+    for (size_t i = 0; i < vector->iterarions; i++) {
+        fn(buf, buf, vector->message_len, rk);
+    }
+
+    return memcmp(vector->output, buf, vector->message_len);
+}
+
+// Number of blocks of the multi-block test, chosen so that the last
+// iteration of the strip-mined routines is a partial one for every VLEN
+// and LMUL.
+#define NUM_MULTI_BLOCKS 37
+
+// Checks that encoding NUM_MULTI_BLOCKS blocks at once matches encoding
+// them one at a time, and that decoding gives the plain text back.
+static int run_multi_block_test(const struct sm4_routine *routine)
+{
+    static uint32_t plain[NUM_MULTI_BLOCKS * 4];
+    static uint32_t cipher[NUM_MULTI_BLOCKS * 4];
+    static uint32_t out[NUM_MULTI_BLOCKS * 4];
+    uint32_t rk[ZVKSED_SM4_EXPANDED_KEY_WORDS];
+    uint32_t x = 0x9e3779b9;
+
+    for (size_t i = 0; i < NUM_MULTI_BLOCKS * 4; ++i) {
+        // xorshift32
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        plain[i] = x;
+    }
+    zvksed_sm4_expand_key(rk, &plain[0]);
+
+    routine->encode(cipher, plain, sizeof(plain), rk);
+    for (size_t i = 0; i < NUM_MULTI_BLOCKS; ++i) {
+        routine->encode(&out[4 * i], &plain[4 * i], 16, rk);
+    }
+    if (memcmp(cipher, out, sizeof(out)) != 0) {
+        printf("%s: multi-block encoding mismatch\n", routine->name);
+        return 1;
+    }
+
+    routine->decode(out, cipher, sizeof(cipher), rk);
+    if (memcmp(plain, out, sizeof(out)) != 0) {
+        printf("%s: multi-block decoding mismatch\n", routine->name);
+        return 1;
+    }
+    return 0;
+}
+
+#define NUM_BATCH_KEYS 11
+
+// Checks that expanding keys in a batch, one per element group, matches
+// expanding them one at a time.
+static int run_batch_expansion_test(void)
+{
+    uint32_t keys[NUM_BATCH_KEYS][4];
+    uint32_t rks[NUM_BATCH_KEYS][ZVKSED_SM4_EXPANDED_KEY_WORDS];
+    uint32_t rk[ZVKSED_SM4_EXPANDED_KEY_WORDS];
+    uint32_t x = 0x12345678;
+
+    for (size_t i = 0; i < NUM_BATCH_KEYS; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            // xorshift32
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            keys[i][j] = x;
+        }
+    }
+
+    zvksed_sm4_expand_keys(&rks[0][0], keys, NUM_BATCH_KEYS);
+    for (size_t i = 0; i < NUM_BATCH_KEYS; ++i) {
+        zvksed_sm4_expand_key(rk, keys[i]);
+        if (memcmp(rk, rks[i], sizeof(rk)) != 0) {
+            printf("key %zu mismatch\n", i);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Seals and opens the given test, and checks that a modified tag is
+// rejected.
+static int run_gcm_test(const struct sm4_gcm_test *test)
+{
+    __attribute__((aligned(16)))
+    uint8_t text[256];
+    uint8_t tag[SM4_GCM_TAG_SIZE];
+    struct sm4_gcm_key key;
+
+    assert(test->len <= sizeof(text));
+
+    sm4_gcm_init(&key, test->key);
+    sm4_gcm_seal(&key, test->iv, test->ivlen, test->aad, test->aadlen,
+                 test->pt, test->len, text, tag, sizeof(tag));
+    if (memcmp(tag, test->tag, sizeof(tag)) != 0 ||
+        (test->len != 0 && memcmp(text, test->ct, test->len) != 0)) {
+        printf("seal mismatch\n");
+        return 1;
+    }
+
+    if (sm4_gcm_open(&key, test->iv, test->ivlen, test->aad, test->aadlen,
+                     test->ct, test->len, test->tag, SM4_GCM_TAG_SIZE,
+                     text) != 0 ||
+        (test->len != 0 && memcmp(text, test->pt, test->len) != 0)) {
+        printf("open mismatch\n");
+        return 1;
+    }
+
+    memcpy(tag, test->tag, sizeof(tag));
+    tag[sizeof(tag) - 1] ^= 1;
+    if (sm4_gcm_open(&key, test->iv, test->ivlen, test->aad, test->aadlen,
+                     test->ct, test->len, tag, sizeof(tag), text) != -1) {
+        printf("modified tag accepted\n");
+        return 1;
+    }
+    return 0;
+}
+
+#define GCM_LONG_MESSAGE_BYTES 5000
+#define GCM_LONG_AAD_BYTES 100
+
+// Seals, then opens in place, a message spanning several stitched chunks.
+static int run_gcm_long_message_test(void)
+{
+    static uint8_t pt[GCM_LONG_MESSAGE_BYTES];
+    static uint8_t text[GCM_LONG_MESSAGE_BYTES];
+    uint8_t aad[GCM_LONG_AAD_BYTES];
+    uint8_t key_bytes[SM4_KEY_SIZE];
+    uint8_t iv[12];
+    uint8_t tag[SM4_GCM_TAG_SIZE];
+    struct sm4_gcm_key key;
+
+    for (size_t i = 0; i < sizeof(key_bytes); i++) {
+        key_bytes[i] = i;
+    }
+    for (size_t i = 0; i < sizeof(iv); i++) {
+        iv[i] = 0x10 + i;
+    }
+    for (size_t i = 0; i < sizeof(aad); i++) {
+        aad[i] = 13 * i + 1;
+    }
+    for (size_t i = 0; i < sizeof(pt); i++) {
+        pt[i] = 31 * i + 7;
+    }
+
+    sm4_gcm_init(&key, key_bytes);
+    sm4_gcm_seal(&key, iv, sizeof(iv), aad, sizeof(aad), pt, sizeof(pt),
+                 text, tag, sizeof(tag));
+    if (memcmp(tag, sm4_gcm_long_tag, sizeof(tag)) != 0) {
+        printf("long message tag mismatch\n");
+        return 1;
+    }
+    if (sm4_gcm_open(&key, iv, sizeof(iv), aad, sizeof(aad), text,
+                     sizeof(text), tag, sizeof(tag), text) != 0 ||
+        memcmp(text, pt, sizeof(pt)) != 0) {
+        printf("long message open mismatch\n");
+        return 1;
+    }
+    return 0;
+}
+
+typedef void (*sm4_xts_fn)(void* dest, const void* src, uint64_t length,
+                           const uint32_t* rks, const void* iv);
+
+static void
+sm4_xts_expand_key(uint32_t* rks, const uint8_t* key)
+{
+    sm4_expand_key_bytes(rks, key);
+    sm4_expand_key_bytes(rks + ZVKSED_SM4_EXPANDED_KEY_WORDS,
+                         key + SM4_KEY_SIZE);
+}
+
+// Encrypts then decrypts, in place, the given data unit.
+static int run_xts_test(const uint8_t* key, const uint8_t* iv,
+                        const uint8_t* pt, const uint8_t* ct, size_t len,
+                        bool gb)
+{
+    __attribute__((aligned(16)))
+    static uint8_t text[512];
+    uint32_t rks[ZVKSED_SM4_XTS_KEY_WORDS];
+    const sm4_xts_fn encrypt = gb ? &zvksed_sm4_xts_gb_encrypt_vs_lmul2 :
+                                    &zvksed_sm4_xts_encrypt_vs_lmul2;
+    const sm4_xts_fn decrypt = gb ? &zvksed_sm4_xts_gb_decrypt_vs_lmul2 :
+                                    &zvksed_sm4_xts_decrypt_vs_lmul2;
+
+    assert(len <= sizeof(text));
+
+    sm4_xts_expand_key(rks, key);
+    memcpy(text, pt, len);
+    encrypt(text, text, len, rks, iv);
+    if (memcmp(text, ct, len) != 0) {
+        printf("encryption mismatch\n");
+        return 1;
+    }
+    decrypt(text, text, len, rks, iv);
+    if (memcmp(text, pt, len) != 0) {
+        printf("decryption mismatch\n");
+        return 1;
+    }
+    return 0;
+}
+
+static int run_xts_long_tests(void)
+{
+    uint8_t key[2 * SM4_KEY_SIZE];
+    uint8_t iv[16];
+    uint8_t pt[sizeof(sm4_xts_long_ct_ieee)];
+
+    for (size_t i = 0; i < sizeof(key); i++) {
+        key[i] = 0x20 + i;
+    }
+    for (size_t i = 0; i < sizeof(iv); i++) {
+        iv[i] = 15 - i;
+    }
+    for (size_t i = 0; i < sizeof(pt); i++) {
+        pt[i] = 7 * i + 3;
+    }
+
+    return run_xts_test(key, iv, pt, sm4_xts_long_ct_ieee,
+                        sizeof(sm4_xts_long_ct_ieee), false) ||
+           run_xts_test(key, iv, pt, sm4_xts_long_ct_gb,
+                        sizeof(sm4_xts_long_ct_gb), true);
+}
+
+typedef void (*sm4_chain_fn)(void* dest, const void* src, uint64_t length,
+                             const uint32_t* rk, void* iv);
+
+// Encrypts in two calls, continuing from the updated IV, then decrypts in
+// place.
+static int run_chain_test(const uint8_t* key, const uint8_t* iv0,
+                          const uint8_t* pt, const uint8_t* ct, size_t len,
+                          bool cfb)
+{
+    __attribute__((aligned(16)))
+    static uint8_t text[512];
+    uint8_t iv[16];
+    uint32_t rk[ZVKSED_SM4_EXPANDED_KEY_WORDS];
+    const sm4_chain_fn encrypt = cfb ? &zvksed_sm4_cfb_encrypt_vs_lmul2 :
+                                       &zvksed_sm4_cbc_encrypt_vs_lmul2;
+    const sm4_chain_fn decrypt = cfb ? &zvksed_sm4_cfb_decrypt_vs_lmul2 :
+                                       &zvksed_sm4_cbc_decrypt_vs_lmul2;
+    const size_t half = len / 32 * 16;
+
+    assert(len % 16 == 0 && len <= sizeof(text));
+
+    sm4_expand_key_bytes(rk, key);
+    memcpy(text, pt, len);
+    memcpy(iv, iv0, sizeof(iv));
+    encrypt(text, text, half, rk, iv);
+    encrypt(text + half, text + half, len - half, rk, iv);
+    if (memcmp(text, ct, len) != 0 ||
+        memcmp(iv, ct + len - sizeof(iv), sizeof(iv)) != 0) {
+        printf("encryption mismatch\n");
+        return 1;
+    }
+    memcpy(iv, iv0, sizeof(iv));
+    decrypt(text, text, len, rk, iv);
+    if (memcmp(text, pt, len) != 0) {
+        printf("decryption mismatch\n");
+        return 1;
+    }
+    return 0;
+}
+
+static int run_chain_long_tests(void)
+{
+    uint8_t key[SM4_KEY_SIZE];
+    uint8_t iv[16];
+    uint8_t pt[sizeof(sm4_cbc_long_ct)];
+
+    for (size_t i = 0; i < sizeof(key); i++) {
+        key[i] = 0x40 + i;
+    }
+    for (size_t i = 0; i < sizeof(iv); i++) {
+        iv[i] = 0xf0 - i;
+    }
+    for (size_t i = 0; i < sizeof(pt); i++) {
+        pt[i] = 5 * i + 1;
+    }
+
+    return run_chain_test(key, iv, pt, sm4_cbc_long_ct,
+                          sizeof(sm4_cbc_long_ct), false) ||
+           run_chain_test(key, iv, pt, sm4_cfb_long_ct,
+                          sizeof(sm4_cfb_long_ct), true);
+}
+
+// Checks the multi-key routines against single key encryptions, the first
+// job being the GB/T 32907 example.
+static int run_multikey_test(void)
+{
+    enum { kJobs = 19 };
+    struct zvksed_sm4_job jobs[kJobs];
+    uint8_t expected[kJobs][16];
+
+    for (size_t j = 0; j < kJobs; j++) {
+        for (size_t i = 0; i < 16; i++) {
+            jobs[j].key[i] = 17 * j + i;
+            jobs[j].block[i] = 3 * i + j;
+        }
+    }
+    for (size_t i = 0; i < 4; i++) {
+        const uint32_t key = __builtin_bswap32(gbt32907k1[i]);
+        const uint32_t msg = __builtin_bswap32(gbt32907m1[i]);
+        memcpy(&jobs[0].key[4 * i], &key, sizeof(key));
+        memcpy(&jobs[0].block[4 * i], &msg, sizeof(msg));
+    }
+    for (size_t j = 0; j < kJobs; j++) {
+        uint32_t rk[ZVKSED_SM4_EXPANDED_KEY_WORDS];
+        uint8_t iv[16] = {0};
+        sm4_expand_key_bytes(rk, jobs[j].key);
+        // A single block CBC encryption with a zero IV.
+        zvksed_sm4_cbc_encrypt_vs_lmul2(expected[j], jobs[j].block, 16, rk,
+                                        iv);
+    }
+    for (size_t i = 0; i < 4; i++) {
+        const uint32_t ct = __builtin_bswap32(gbt32907e1[i]);
+        if (memcmp(&expected[0][4 * i], &ct, sizeof(ct)) != 0) {
+            printf("reference mismatch\n");
+            return 1;
+        }
+    }
+
+    zvksed_sm4_encrypt_jobs_vv_lmul2(jobs, kJobs);
+    for (size_t j = 0; j < kJobs; j++) {
+        if (memcmp(jobs[j].block, expected[j], 16) != 0) {
+            printf("encryption mismatch for job %zu\n", j);
+            return 1;
+        }
+    }
+    zvksed_sm4_decrypt_jobs_vv_lmul2(jobs, kJobs);
+    for (size_t j = 0; j < kJobs; j++) {
+        for (size_t i = 0; i < 16; i++) {
+            const uint8_t pt = j == 0 ?
+                gbt32907m1[i / 4] >> (24 - 8 * (i % 4)) : 3 * i + j;
+            if (jobs[j].block[i] != pt) {
+                printf("decryption mismatch for job %zu\n", j);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
 int main()
 {
     int result;
     size_t suites_count;
     struct sm4_test_vector *test;
+    const uint64_t vlen = vlen_bits();
+    const size_t routines_count =
+        sizeof(sm4_routines) / sizeof(sm4_routines[0]);
+
+    printf("VLEN = %llu\n", (unsigned long long)vlen);
 
     suites_count = sizeof(sm4_suites) / sizeof(sm4_suites[0]);
     for (size_t i = 0; i < suites_count; ++i) {
         printf("Running %s test suite...", sm4_suites[i].name);
         for (size_t j = 0; j < sm4_suites[i].tests_count; ++j) {
             test = &sm4_suites[i].vectors[j];
-            result = run_sm4_test(test);
-            if (result != 0) {
-                printf("test %zu failed\n", j);
-                exit(1);
+            if (vlen >= 128) {
+                result = run_sm4_test(test);
+                if (result != 0) {
+                    printf("test %zu failed\n", j);
+                    exit(1);
+                }
+            }
+            for (size_t k = 0; k < routines_count; ++k) {
+                if (vlen < sm4_routines[k].min_vlen) {
+                    continue;
+                }
+                result = run_sm4_test_routine(test, &sm4_routines[k]);
+                if (result != 0) {
+                    printf("test %zu failed with '%s'\n", j,
+                           sm4_routines[k].name);
+                    exit(1);
+                }
             }
         }
         printf("success, %zu tests were run.\n", sm4_suites[i].tests_count);
     }
 
+    for (size_t k = 0; k < routines_count; ++k) {
+        if (vlen < sm4_routines[k].min_vlen) {
+            printf("Skipping '%s' due to VLEN < %llu\n", sm4_routines[k].name,
+                   (unsigned long long)sm4_routines[k].min_vlen);
+            continue;
+        }
+        printf("Running multi-block test against '%s'...",
+               sm4_routines[k].name);
+        if (run_multi_block_test(&sm4_routines[k]) != 0) {
+            exit(1);
+        }
+        printf("success.\n");
+    }
+
+    if (vlen < 64) {
+        printf("Skipping mode and multi-key tests due to VLEN < 64\n");
+        return 0;
+    }
+    printf("Running SM4-CBC and SM4-CFB tests...");
+    for (size_t i = 0;
+         i < sizeof(sm4_chain_tests) / sizeof(sm4_chain_tests[0]); ++i) {
+        const struct sm4_chain_test *test = &sm4_chain_tests[i];
+        if (run_chain_test(test->key, test->iv, test->pt, test->ct,
+                           test->len, test->cfb) != 0) {
+            printf("test %zu failed\n", i);
+            exit(1);
+        }
+    }
+    if (run_chain_long_tests() != 0) {
+        exit(1);
+    }
+    printf("success.\n");
+
+    printf("Running multi-key SM4 test...");
+    if (run_multikey_test() != 0) {
+        exit(1);
+    }
+    printf("success.\n");
+
+    printf("Running SM4-XTS tests...");
+    for (size_t i = 0; i < sizeof(sm4_xts_tests) / sizeof(sm4_xts_tests[0]);
+         ++i) {
+        const struct sm4_xts_test *test = &sm4_xts_tests[i];
+        if (run_xts_test(test->key, test->iv, test->pt, test->ct, test->len,
+                         test->gb) != 0) {
+            printf("test %zu failed\n", i);
+            exit(1);
+        }
+    }
+    if (run_xts_long_tests() != 0) {
+        exit(1);
+    }
+    printf("success.\n");
+
+    if (vlen < 128) {
+        printf("Skipping batch key expansion and GCM tests due to "
+               "VLEN < 128\n");
+        return 0;
+    }
+    printf("Running batch key expansion test...");
+    if (run_batch_expansion_test() != 0) {
+        exit(1);
+    }
+    printf("success.\n");
+
+    printf("Running SM4-GCM tests...");
+    for (size_t i = 0; i < sizeof(sm4_gcm_tests) / sizeof(sm4_gcm_tests[0]);
+         ++i) {
+        if (run_gcm_test(&sm4_gcm_tests[i]) != 0) {
+            printf("test %zu failed\n", i);
+            exit(1);
+        }
+    }
+    if (run_gcm_long_message_test() != 0) {
+        exit(1);
+    }
+    printf("success.\n");
+
     return 0;
 }
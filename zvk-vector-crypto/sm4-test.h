@@ -34,4 +34,39 @@ struct sm4_test_suite {
     size_t tests_count;
 };
 
+struct sm4_gcm_test {
+    const uint8_t* key;
+    const uint8_t* iv;
+    size_t ivlen;
+    const uint8_t* aad;
+    size_t aadlen;
+    const uint8_t* pt;
+    const uint8_t* ct;
+    size_t len;
+    // 16 bytes tag.
+    const uint8_t* tag;
+};
+
+struct sm4_xts_test {
+    // Key1 || Key2, 32 bytes.
+    const uint8_t* key;
+    const uint8_t* iv;
+    const uint8_t* pt;
+    const uint8_t* ct;
+    size_t len;
+    // GB/T 17964 tweaks, IEEE 1619 ones otherwise.
+    bool gb;
+};
+
+// SM4-CBC and SM4-CFB, whole blocks.
+struct sm4_chain_test {
+    const uint8_t* key;
+    const uint8_t* iv;
+    const uint8_t* pt;
+    const uint8_t* ct;
+    size_t len;
+    // CFB, CBC otherwise.
+    bool cfb;
+};
+
 #endif  // SM4_TEST_H_
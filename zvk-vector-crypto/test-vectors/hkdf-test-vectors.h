@@ -0,0 +1,813 @@
+#ifndef _HKDF_TEST_VECTORS_
+#define _HKDF_TEST_VECTORS_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * The HKDF-SHA-256 test vectors are test cases 1 to 3 from RFC 5869,
+ * appendix A. The HKDF-SHA-384 ones were computed with Python's hmac
+ * module.
+ */
+
+static const uint8_t hkdf_ikm0[] = {
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+};
+
+static const uint8_t hkdf_salt0[] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c,
+};
+
+static const uint8_t hkdf_info0[] = {
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9,
+};
+
+static const uint8_t hkdf_okm0[] = {
+    0x3c, 0xb2, 0x5f, 0x25, 0xfa, 0xac, 0xd5, 0x7a,
+    0x90, 0x43, 0x4f, 0x64, 0xd0, 0x36, 0x2f, 0x2a,
+    0x2d, 0x2d, 0x0a, 0x90, 0xcf, 0x1a, 0x5a, 0x4c,
+    0x5d, 0xb0, 0x2d, 0x56, 0xec, 0xc4, 0xc5, 0xbf,
+    0x34, 0x00, 0x72, 0x08, 0xd5, 0xb8, 0x87, 0x18,
+    0x58, 0x65,
+};
+
+static const uint8_t hkdf_ikm1[] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+};
+
+static const uint8_t hkdf_salt1[] = {
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+    0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+};
+
+static const uint8_t hkdf_info1[] = {
+    0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+    0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
+    0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff,
+};
+
+static const uint8_t hkdf_okm1[] = {
+    0xb1, 0x1e, 0x39, 0x8d, 0xc8, 0x03, 0x27, 0xa1,
+    0xc8, 0xe7, 0xf7, 0x8c, 0x59, 0x6a, 0x49, 0x34,
+    0x4f, 0x01, 0x2e, 0xda, 0x2d, 0x4e, 0xfa, 0xd8,
+    0xa0, 0x50, 0xcc, 0x4c, 0x19, 0xaf, 0xa9, 0x7c,
+    0x59, 0x04, 0x5a, 0x99, 0xca, 0xc7, 0x82, 0x72,
+    0x71, 0xcb, 0x41, 0xc6, 0x5e, 0x59, 0x0e, 0x09,
+    0xda, 0x32, 0x75, 0x60, 0x0c, 0x2f, 0x09, 0xb8,
+    0x36, 0x77, 0x93, 0xa9, 0xac, 0xa3, 0xdb, 0x71,
+    0xcc, 0x30, 0xc5, 0x81, 0x79, 0xec, 0x3e, 0x87,
+    0xc1, 0x4c, 0x01, 0xd5, 0xc1, 0xf3, 0x43, 0x4f,
+    0x1d, 0x87,
+};
+
+static const uint8_t hkdf_ikm2[] = {
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+};
+
+static const uint8_t hkdf_okm2[] = {
+    0x8d, 0xa4, 0xe7, 0x75, 0xa5, 0x63, 0xc1, 0x8f,
+    0x71, 0x5f, 0x80, 0x2a, 0x06, 0x3c, 0x5a, 0x31,
+    0xb8, 0xa1, 0x1f, 0x5c, 0x5e, 0xe1, 0x87, 0x9e,
+    0xc3, 0x45, 0x4e, 0x5f, 0x3c, 0x73, 0x8d, 0x2d,
+    0x9d, 0x20, 0x13, 0x95, 0xfa, 0xa4, 0xb6, 0x1a,
+    0x96, 0xc8,
+};
+
+static const uint8_t hkdf_ikm3[] = {
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+};
+
+static const uint8_t hkdf_salt3[] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c,
+};
+
+static const uint8_t hkdf_info3[] = {
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9,
+};
+
+static const uint8_t hkdf_okm3[] = {
+    0x9b, 0x50, 0x97, 0xa8, 0x60, 0x38, 0xb8, 0x05,
+    0x30, 0x90, 0x76, 0xa4, 0x4b, 0x3a, 0x9f, 0x38,
+    0x06, 0x3e, 0x25, 0xb5, 0x16, 0xdc, 0xbf, 0x36,
+    0x9f, 0x39, 0x4c, 0xfa, 0xb4, 0x36, 0x85, 0xf7,
+    0x48, 0xb6, 0x45, 0x77, 0x63, 0xe4, 0xf0, 0x20,
+    0x4f, 0xc5,
+};
+
+static const uint8_t hkdf_ikm4[] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+};
+
+static const uint8_t hkdf_salt4[] = {
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+    0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+};
+
+static const uint8_t hkdf_info4[] = {
+    0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+    0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
+    0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff,
+};
+
+static const uint8_t hkdf_okm4[] = {
+    0x48, 0x4c, 0xa0, 0x52, 0xb8, 0xcc, 0x72, 0x4f,
+    0xd1, 0xc4, 0xec, 0x64, 0xd5, 0x7b, 0x4e, 0x81,
+    0x8c, 0x7e, 0x25, 0xa8, 0xe0, 0xf4, 0x56, 0x9e,
+    0xd7, 0x2a, 0x6a, 0x05, 0xfe, 0x06, 0x49, 0xee,
+    0xbf, 0x69, 0xf8, 0xd5, 0xc8, 0x32, 0x85, 0x6b,
+    0xf4, 0xe4, 0xfb, 0xc1, 0x79, 0x67, 0xd5, 0x49,
+    0x75, 0x32, 0x4a, 0x94, 0x98, 0x7f, 0x7f, 0x41,
+    0x83, 0x58, 0x17, 0xd8, 0x99, 0x4f, 0xdb, 0xd6,
+    0xf4, 0xc0, 0x9c, 0x55, 0x00, 0xdc, 0xa2, 0x4a,
+    0x56, 0x22, 0x2f, 0xea, 0x53, 0xd8, 0x96, 0x7a,
+    0x8b, 0x2e, 0x2a, 0x12, 0x5b, 0xbb, 0xd8, 0x22,
+    0xa8, 0x4e, 0xb7, 0x7b, 0xe8, 0x2d, 0xfd, 0x76,
+    0xa1, 0xc0, 0xab, 0x1e, 0x4d, 0x79, 0x3a, 0xae,
+    0x63, 0x9a, 0x91, 0x60, 0xb7, 0x64, 0x24, 0xa9,
+    0x35, 0xb8, 0x50, 0x5c, 0xaf, 0xf5, 0xfc, 0x94,
+    0xb7, 0x13, 0xe5, 0xd4, 0xef, 0xf4, 0x4d, 0xae,
+    0x70, 0x8e,
+};
+
+static const uint8_t hkdf_ikm5[] = {
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+    0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a,
+    0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22,
+    0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a,
+    0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+    0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a,
+    0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52,
+    0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+    0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66,
+};
+
+static const uint8_t hkdf_okm5[] = {
+    0xac, 0xe3, 0xd0, 0x03, 0x27, 0x68, 0x88, 0x08,
+    0xfb, 0x76, 0xf7, 0x50, 0x62, 0x1c, 0xfc, 0xb0,
+    0x69, 0x3b, 0x34, 0x67, 0xd4, 0x4f, 0xfe, 0xc6,
+    0x8b, 0x01, 0xe7, 0xd7, 0xca, 0xa1, 0x42, 0x0d,
+    0xd9, 0xd0, 0x52, 0x70, 0x07, 0xcd, 0x38, 0xa9,
+    0x1f, 0xed, 0xc2, 0xd6, 0x5c, 0xa6, 0xc6, 0xf6,
+    0xa8, 0xe4, 0x66, 0xe0, 0x1b, 0x6f, 0x5d, 0x17,
+    0x7f, 0x85, 0xda, 0xa7, 0xe5, 0x98, 0xba, 0x06,
+    0x58, 0x11, 0x55, 0x32, 0xe1, 0xba, 0xdd, 0xf5,
+    0xe4, 0x55, 0x4e, 0x24, 0xd5, 0xfc, 0x13, 0x78,
+    0xdf, 0x60, 0xf2, 0xf3, 0x2e, 0x40, 0x3f, 0x05,
+    0x6a, 0x12, 0x0b, 0x9a, 0x93, 0x3e, 0xfa, 0x28,
+    0xfa, 0xbb, 0xdb, 0x69, 0x05, 0x2c, 0xb2, 0xb8,
+    0x08, 0x53, 0x7e, 0xc3, 0x99, 0x4c, 0xb3, 0x55,
+    0xe2, 0xed, 0x5a, 0x84, 0x3e, 0x00, 0x63, 0xf4,
+    0x91, 0xfc, 0x94, 0xae, 0xb8, 0x4a, 0x3f, 0xff,
+    0x5a, 0xf5, 0x7d, 0x65, 0x37, 0x36, 0xf9, 0x96,
+    0x6a, 0x7c, 0xf4, 0x13, 0x87, 0xfa, 0xe8, 0x45,
+    0x9f, 0x43, 0x04, 0x88, 0xbf, 0x72, 0x7b, 0x99,
+    0x51, 0xc9, 0x85, 0xad, 0x8d, 0x90, 0x96, 0xba,
+    0x57, 0xcb, 0x3a, 0xbd, 0xad, 0x41, 0x99, 0xe0,
+    0xbb, 0xd1, 0xf2, 0x71, 0x34, 0xc3, 0xb0, 0xe4,
+    0xce, 0x15, 0xae, 0xaf, 0x99, 0xf8, 0xc0, 0x61,
+    0x3c, 0xc5, 0xca, 0x96, 0x97, 0x99, 0xc3, 0x0e,
+    0x4f, 0x3e, 0x52, 0x85, 0xea, 0xda, 0x13, 0x31,
+    0xf7, 0xbb, 0xe7, 0xf5, 0xf6, 0x2f, 0x74, 0x95,
+    0xe5, 0xf2, 0xab, 0x35, 0x51, 0xe8, 0xcb, 0xaf,
+    0xaa, 0xe4, 0x75, 0xe1, 0xf2, 0xa6, 0x8f, 0x6e,
+    0x15, 0x6a, 0x06, 0x4c, 0xb2, 0x28, 0x15, 0x6c,
+    0x4d, 0xa1, 0x10, 0xb1, 0xe0, 0xad, 0x2c, 0xf1,
+    0xee, 0x29, 0xaa, 0x37, 0x98, 0x62, 0x73, 0xdc,
+    0xdf, 0x43, 0x90, 0xa0, 0xa1, 0x59, 0xab, 0xa7,
+    0x0c, 0xa1, 0x8c, 0x54, 0xb1, 0xb2, 0xc2, 0x42,
+    0x2e, 0x09, 0x2a, 0x15, 0xb2, 0xce, 0x5a, 0xcd,
+    0xc1, 0x63, 0xf8, 0xbe, 0xde, 0xd6, 0xcf, 0x9d,
+    0x74, 0x80, 0x95, 0x81, 0x49, 0x4f, 0x4f, 0xc8,
+    0x96, 0xe3, 0x7c, 0x09, 0x45, 0xb1, 0xcd, 0xce,
+    0x8f, 0x1f, 0xc6, 0xe5,
+};
+
+static const struct hkdf_test hkdf_tests[] = {
+    {
+        .name = "RFC 5869 test case 1",
+        .sha384 = false,
+        .ikm = hkdf_ikm0,
+        .ikmlen = sizeof(hkdf_ikm0),
+        .salt = hkdf_salt0,
+        .saltlen = sizeof(hkdf_salt0),
+        .info = hkdf_info0,
+        .infolen = sizeof(hkdf_info0),
+        .prk = {
+            0x07, 0x77, 0x09, 0x36, 0x2c, 0x2e, 0x32, 0xdf,
+            0x0d, 0xdc, 0x3f, 0x0d, 0xc4, 0x7b, 0xba, 0x63,
+            0x90, 0xb6, 0xc7, 0x3b, 0xb5, 0x0f, 0x9c, 0x31,
+            0x22, 0xec, 0x84, 0x4a, 0xd7, 0xc2, 0xb3, 0xe5,
+        },
+        .okm = hkdf_okm0,
+        .okmlen = sizeof(hkdf_okm0),
+    },
+    {
+        .name = "RFC 5869 test case 2",
+        .sha384 = false,
+        .ikm = hkdf_ikm1,
+        .ikmlen = sizeof(hkdf_ikm1),
+        .salt = hkdf_salt1,
+        .saltlen = sizeof(hkdf_salt1),
+        .info = hkdf_info1,
+        .infolen = sizeof(hkdf_info1),
+        .prk = {
+            0x06, 0xa6, 0xb8, 0x8c, 0x58, 0x53, 0x36, 0x1a,
+            0x06, 0x10, 0x4c, 0x9c, 0xeb, 0x35, 0xb4, 0x5c,
+            0xef, 0x76, 0x00, 0x14, 0x90, 0x46, 0x71, 0x01,
+            0x4a, 0x19, 0x3f, 0x40, 0xc1, 0x5f, 0xc2, 0x44,
+        },
+        .okm = hkdf_okm1,
+        .okmlen = sizeof(hkdf_okm1),
+    },
+    {
+        .name = "RFC 5869 test case 3",
+        .sha384 = false,
+        .ikm = hkdf_ikm2,
+        .ikmlen = sizeof(hkdf_ikm2),
+        .prk = {
+            0x19, 0xef, 0x24, 0xa3, 0x2c, 0x71, 0x7b, 0x16,
+            0x7f, 0x33, 0xa9, 0x1d, 0x6f, 0x64, 0x8b, 0xdf,
+            0x96, 0x59, 0x67, 0x76, 0xaf, 0xdb, 0x63, 0x77,
+            0xac, 0x43, 0x4c, 0x1c, 0x29, 0x3c, 0xcb, 0x04,
+        },
+        .okm = hkdf_okm2,
+        .okmlen = sizeof(hkdf_okm2),
+    },
+    {
+        .name = "HKDF-SHA-384 short",
+        .sha384 = true,
+        .ikm = hkdf_ikm3,
+        .ikmlen = sizeof(hkdf_ikm3),
+        .salt = hkdf_salt3,
+        .saltlen = sizeof(hkdf_salt3),
+        .info = hkdf_info3,
+        .infolen = sizeof(hkdf_info3),
+        .prk = {
+            0x70, 0x4b, 0x39, 0x99, 0x07, 0x79, 0xce, 0x1d,
+            0xc5, 0x48, 0x05, 0x2c, 0x7d, 0xc3, 0x9f, 0x30,
+            0x35, 0x70, 0xdd, 0x13, 0xfb, 0x39, 0xf7, 0xac,
+            0xc5, 0x64, 0x68, 0x0b, 0xef, 0x80, 0xe8, 0xde,
+            0xc7, 0x0e, 0xe9, 0xa7, 0xe1, 0xf3, 0xe2, 0x93,
+            0xef, 0x68, 0xec, 0xeb, 0x07, 0x2a, 0x5a, 0xde,
+        },
+        .okm = hkdf_okm3,
+        .okmlen = sizeof(hkdf_okm3),
+    },
+    {
+        .name = "HKDF-SHA-384 long",
+        .sha384 = true,
+        .ikm = hkdf_ikm4,
+        .ikmlen = sizeof(hkdf_ikm4),
+        .salt = hkdf_salt4,
+        .saltlen = sizeof(hkdf_salt4),
+        .info = hkdf_info4,
+        .infolen = sizeof(hkdf_info4),
+        .prk = {
+            0xb3, 0x19, 0xf6, 0x83, 0x1d, 0xff, 0x93, 0x14,
+            0xef, 0xb6, 0x43, 0xba, 0xa2, 0x92, 0x63, 0xb3,
+            0x0e, 0x4a, 0x8d, 0x77, 0x9f, 0xe3, 0x1e, 0x9c,
+            0x90, 0x1e, 0xfd, 0x7d, 0xe7, 0x37, 0xc8, 0x5b,
+            0x62, 0xe6, 0x76, 0xd4, 0xdc, 0x87, 0xb0, 0x89,
+            0x5c, 0x6a, 0x7d, 0xc9, 0x7b, 0x52, 0xce, 0xbb,
+        },
+        .okm = hkdf_okm4,
+        .okmlen = sizeof(hkdf_okm4),
+    },
+    {
+        .name = "HKDF-SHA-384 no salt",
+        .sha384 = true,
+        .ikm = hkdf_ikm5,
+        .ikmlen = sizeof(hkdf_ikm5),
+        .prk = {
+            0x85, 0x78, 0xf3, 0x6a, 0x92, 0xb2, 0xc0, 0xea,
+            0x3d, 0x23, 0x8d, 0x47, 0x9f, 0x26, 0x9d, 0xae,
+            0xd1, 0x51, 0x72, 0xaf, 0x0d, 0xb7, 0x6f, 0xae,
+            0xc5, 0xb8, 0x95, 0x3e, 0x6e, 0x2c, 0x08, 0x12,
+            0xcc, 0x32, 0x11, 0xb6, 0x23, 0x7d, 0x01, 0xc7,
+            0xb4, 0x52, 0x30, 0xd4, 0x3e, 0xd5, 0xa5, 0xe3,
+        },
+        .okm = hkdf_okm5,
+        .okmlen = sizeof(hkdf_okm5),
+    },
+};
+
+/*
+ * The first TLS 1.3 key schedule reuses the inputs of the "Simple 1-RTT
+ * Handshake" trace of RFC 8448, section 3: its early, handshake and
+ * master secrets, and its handshake traffic secrets, keys and IVs match
+ * the trace. The transcript hashes after the Finished messages are
+ * SHA-256 of arbitrary strings. The expected outputs of all the key
+ * schedules were computed with Python's hmac module.
+ */
+
+static const uint8_t tls13_ecdhe0[] = {
+    0x8b, 0xd4, 0x05, 0x4f, 0xb5, 0x5b, 0x9d, 0x63,
+    0xfd, 0xfb, 0xac, 0xf9, 0xf0, 0x4b, 0x9f, 0x0d,
+    0x35, 0xe6, 0xd6, 0x3f, 0x53, 0x75, 0x63, 0xef,
+    0xd4, 0x62, 0x72, 0x90, 0x0f, 0x89, 0x49, 0x2d,
+};
+
+static const uint8_t tls13_psk1[] = {
+    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b,
+    0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
+    0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b,
+    0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x93,
+};
+
+static const uint8_t tls13_ecdhe1[] = {
+    0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+    0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+    0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e,
+    0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+};
+
+static const uint8_t tls13_psk2[] = {
+    0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+    0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
+};
+
+static const struct tls13_test tls13_tests[] = {
+    {
+        .name = "RFC 8448 1-RTT, TLS_AES_128_GCM_SHA256",
+        .sha384 = false,
+        .key_size = 16,
+        .ecdhe = tls13_ecdhe0,
+        .ecdhelen = sizeof(tls13_ecdhe0),
+        .server_hello_hash = {
+            0x86, 0x0c, 0x06, 0xed, 0xc0, 0x78, 0x58, 0xee,
+            0x8e, 0x78, 0xf0, 0xe7, 0x42, 0x8c, 0x58, 0xed,
+            0xd6, 0xb4, 0x3f, 0x2c, 0xa3, 0xe6, 0xe9, 0x5f,
+            0x02, 0xed, 0x06, 0x3c, 0xf0, 0xe1, 0xca, 0xd8,
+        },
+        .server_finished_hash = {
+            0x75, 0x41, 0x76, 0x8a, 0x45, 0xdb, 0x42, 0x40,
+            0x84, 0xa1, 0x7f, 0xd9, 0x83, 0x33, 0x4c, 0xa7,
+            0x8f, 0x8b, 0xa6, 0xef, 0xc1, 0x47, 0x18, 0xe8,
+            0x50, 0x42, 0xaf, 0xc6, 0xa7, 0xd4, 0xb7, 0x22,
+        },
+        .client_finished_hash = {
+            0xa2, 0xbf, 0x63, 0xf6, 0xd1, 0x2d, 0x35, 0x42,
+            0x29, 0x29, 0xc3, 0x78, 0x9e, 0x02, 0x2c, 0x5d,
+            0x38, 0xee, 0x8f, 0x42, 0xb5, 0xaf, 0xa8, 0xc2,
+            0x16, 0x52, 0xc9, 0xff, 0xae, 0xa4, 0xb6, 0x55,
+        },
+        .early_secret = {
+            0x33, 0xad, 0x0a, 0x1c, 0x60, 0x7e, 0xc0, 0x3b,
+            0x09, 0xe6, 0xcd, 0x98, 0x93, 0x68, 0x0c, 0xe2,
+            0x10, 0xad, 0xf3, 0x00, 0xaa, 0x1f, 0x26, 0x60,
+            0xe1, 0xb2, 0x2e, 0x10, 0xf1, 0x70, 0xf9, 0x2a,
+        },
+        .handshake_secret = {
+            0x1d, 0xc8, 0x26, 0xe9, 0x36, 0x06, 0xaa, 0x6f,
+            0xdc, 0x0a, 0xad, 0xc1, 0x2f, 0x74, 0x1b, 0x01,
+            0x04, 0x6a, 0xa6, 0xb9, 0x9f, 0x69, 0x1e, 0xd2,
+            0x21, 0xa9, 0xf0, 0xca, 0x04, 0x3f, 0xbe, 0xac,
+        },
+        .master_secret = {
+            0x18, 0xdf, 0x06, 0x84, 0x3d, 0x13, 0xa0, 0x8b,
+            0xf2, 0xa4, 0x49, 0x84, 0x4c, 0x5f, 0x8a, 0x47,
+            0x80, 0x01, 0xbc, 0x4d, 0x4c, 0x62, 0x79, 0x84,
+            0xd5, 0xa4, 0x1d, 0xa8, 0xd0, 0x40, 0x29, 0x19,
+        },
+        .client_handshake_secret = {
+            0xb3, 0xed, 0xdb, 0x12, 0x6e, 0x06, 0x7f, 0x35,
+            0xa7, 0x80, 0xb3, 0xab, 0xf4, 0x5e, 0x2d, 0x8f,
+            0x3b, 0x1a, 0x95, 0x07, 0x38, 0xf5, 0x2e, 0x96,
+            0x00, 0x74, 0x6a, 0x0e, 0x27, 0xa5, 0x5a, 0x21,
+        },
+        .client_handshake_key = {
+            0xdb, 0xfa, 0xa6, 0x93, 0xd1, 0x76, 0x2c, 0x5b,
+            0x66, 0x6a, 0xf5, 0xd9, 0x50, 0x25, 0x8d, 0x01,
+        },
+        .client_handshake_iv = {
+            0x5b, 0xd3, 0xc7, 0x1b, 0x83, 0x6e, 0x0b, 0x76,
+            0xbb, 0x73, 0x26, 0x5f,
+        },
+        .server_handshake_secret = {
+            0xb6, 0x7b, 0x7d, 0x69, 0x0c, 0xc1, 0x6c, 0x4e,
+            0x75, 0xe5, 0x42, 0x13, 0xcb, 0x2d, 0x37, 0xb4,
+            0xe9, 0xc9, 0x12, 0xbc, 0xde, 0xd9, 0x10, 0x5d,
+            0x42, 0xbe, 0xfd, 0x59, 0xd3, 0x91, 0xad, 0x38,
+        },
+        .server_handshake_key = {
+            0x3f, 0xce, 0x51, 0x60, 0x09, 0xc2, 0x17, 0x27,
+            0xd0, 0xf2, 0xe4, 0xe8, 0x6e, 0xe4, 0x03, 0xbc,
+        },
+        .server_handshake_iv = {
+            0x5d, 0x31, 0x3e, 0xb2, 0x67, 0x12, 0x76, 0xee,
+            0x13, 0x00, 0x0b, 0x30,
+        },
+        .client_finished_key = {
+            0xb8, 0x0a, 0xd0, 0x10, 0x15, 0xfb, 0x2f, 0x0b,
+            0xd6, 0x5f, 0xf7, 0xd4, 0xda, 0x5d, 0x6b, 0xf8,
+            0x3f, 0x84, 0x82, 0x1d, 0x1f, 0x87, 0xfd, 0xc7,
+            0xd3, 0xc7, 0x5b, 0x5a, 0x7b, 0x42, 0xd9, 0xc4,
+        },
+        .server_finished_key = {
+            0x00, 0x8d, 0x3b, 0x66, 0xf8, 0x16, 0xea, 0x55,
+            0x9f, 0x96, 0xb5, 0x37, 0xe8, 0x85, 0xc3, 0x1f,
+            0xc0, 0x68, 0xbf, 0x49, 0x2c, 0x65, 0x2f, 0x01,
+            0xf2, 0x88, 0xa1, 0xd8, 0xcd, 0xc1, 0x9f, 0xc8,
+        },
+        .client_application_secret = {
+            0xc4, 0x96, 0xc2, 0x7e, 0xb4, 0x98, 0x03, 0x5c,
+            0x23, 0x1a, 0xc0, 0x03, 0xec, 0x18, 0x98, 0xcd,
+            0xb6, 0xc0, 0xd6, 0x43, 0xc5, 0xb5, 0xee, 0x6e,
+            0x6f, 0x22, 0x40, 0x2e, 0xfc, 0x27, 0x79, 0x12,
+        },
+        .client_application_key = {
+            0x22, 0x18, 0xff, 0x8a, 0x01, 0xcd, 0xdb, 0x8a,
+            0xfd, 0xc2, 0x98, 0xce, 0x8f, 0x2e, 0x57, 0xec,
+        },
+        .client_application_iv = {
+            0x7b, 0x3c, 0x9b, 0x48, 0x34, 0xd6, 0x5c, 0xff,
+            0x9b, 0x31, 0xb8, 0x7c,
+        },
+        .server_application_secret = {
+            0x90, 0x90, 0x29, 0x6e, 0x32, 0xf3, 0xff, 0x21,
+            0x4a, 0xc2, 0x3d, 0x79, 0x30, 0x8a, 0x8f, 0x7a,
+            0x55, 0xe9, 0x4c, 0x59, 0xcb, 0x11, 0x1a, 0x9c,
+            0xee, 0x13, 0xd8, 0xe3, 0x84, 0x81, 0xc1, 0x4d,
+        },
+        .server_application_key = {
+            0x86, 0x13, 0xe9, 0xdf, 0xb1, 0xb1, 0x5c, 0x8e,
+            0xfe, 0x15, 0xe8, 0xd5, 0xb5, 0xdf, 0x77, 0x73,
+        },
+        .server_application_iv = {
+            0x29, 0x8f, 0x8a, 0x13, 0x76, 0x4c, 0x5d, 0xb7,
+            0xaf, 0xc6, 0x1c, 0x34,
+        },
+        .exporter_master_secret = {
+            0x71, 0x9c, 0xe7, 0x78, 0x68, 0x96, 0x16, 0x6b,
+            0x1e, 0x6b, 0xcf, 0x1c, 0x5f, 0xd9, 0xd6, 0x59,
+            0x05, 0x94, 0x49, 0x72, 0xfa, 0x77, 0xc9, 0x23,
+            0x05, 0xd0, 0xfd, 0xb0, 0x73, 0x36, 0x9e, 0x8b,
+        },
+        .resumption_master_secret = {
+            0xf1, 0xa7, 0x30, 0xf3, 0x71, 0x2f, 0xd6, 0xca,
+            0xf2, 0x97, 0x8c, 0xc7, 0xb9, 0x4d, 0xc6, 0x55,
+            0xaa, 0xe7, 0x93, 0x13, 0x1e, 0x88, 0x8d, 0xd9,
+            0x3c, 0x58, 0x17, 0x7c, 0xff, 0xc3, 0x85, 0x07,
+        },
+    },
+    {
+        .name = "PSK-DHE, TLS_AES_256_GCM_SHA384",
+        .sha384 = true,
+        .key_size = 32,
+        .psk = tls13_psk1,
+        .psklen = sizeof(tls13_psk1),
+        .ecdhe = tls13_ecdhe1,
+        .ecdhelen = sizeof(tls13_ecdhe1),
+        .server_hello_hash = {
+            0xa5, 0x3e, 0xbf, 0x54, 0x65, 0xb7, 0xb2, 0x28,
+            0x1e, 0xb5, 0x0b, 0xca, 0x0f, 0x54, 0x92, 0x34,
+            0xbf, 0xc1, 0xba, 0x60, 0xbc, 0xb2, 0x36, 0x55,
+            0x81, 0x8d, 0xcc, 0xe0, 0x71, 0xa2, 0xf4, 0xd5,
+            0xdb, 0xd1, 0xb2, 0x78, 0xd4, 0x7a, 0xf1, 0x77,
+            0xc2, 0xa5, 0x08, 0x70, 0xd8, 0x76, 0xc9, 0xeb,
+        },
+        .server_finished_hash = {
+            0xb1, 0xe8, 0x02, 0x28, 0x99, 0xeb, 0xa9, 0x87,
+            0x8c, 0xb2, 0x62, 0x14, 0xa6, 0xdc, 0x4f, 0x07,
+            0x88, 0x37, 0xb2, 0x45, 0xc8, 0xb3, 0xcc, 0x81,
+            0x6e, 0xb0, 0xdb, 0xb9, 0x2d, 0xf0, 0xa9, 0x3b,
+            0x3c, 0x34, 0x07, 0x6f, 0xa5, 0xa7, 0xd7, 0xb3,
+            0x31, 0xbd, 0x7c, 0x5e, 0xa0, 0x4a, 0xf6, 0x35,
+        },
+        .client_finished_hash = {
+            0x73, 0x40, 0x05, 0x33, 0x50, 0x9f, 0x74, 0x40,
+            0x7b, 0x0d, 0x0e, 0x88, 0x12, 0xcd, 0x41, 0xce,
+            0x8b, 0x3f, 0xdb, 0xea, 0xc2, 0x12, 0x4f, 0x9d,
+            0xbb, 0xba, 0xb3, 0xec, 0xd8, 0x2f, 0x90, 0xb3,
+            0xe6, 0x9f, 0x0d, 0x0e, 0x51, 0xf1, 0x6e, 0x69,
+            0xcd, 0x59, 0x52, 0xb0, 0x78, 0x4e, 0x64, 0xd9,
+        },
+        .early_secret = {
+            0x1f, 0x94, 0xf6, 0xfe, 0x30, 0x3c, 0xe4, 0xa8,
+            0x2e, 0xf1, 0x30, 0x4b, 0x01, 0x4c, 0xf8, 0x28,
+            0x1f, 0x7f, 0x73, 0x03, 0xb3, 0x51, 0x21, 0xb2,
+            0x49, 0xf2, 0x8d, 0xdf, 0xdd, 0x65, 0xb8, 0x58,
+            0xdb, 0x2b, 0xe1, 0xf0, 0xd4, 0x3b, 0x54, 0xef,
+            0xfd, 0x3b, 0x46, 0x31, 0x6d, 0xa0, 0x38, 0x48,
+        },
+        .handshake_secret = {
+            0x80, 0xa3, 0xc7, 0x4e, 0xc8, 0xc8, 0xd8, 0x56,
+            0x33, 0xd4, 0x02, 0x6c, 0x37, 0x97, 0xe4, 0x0c,
+            0xeb, 0x36, 0x6a, 0xc3, 0xda, 0x50, 0x10, 0xa1,
+            0x1d, 0xe6, 0xec, 0x5a, 0x73, 0x2a, 0x72, 0x55,
+            0x61, 0xde, 0x13, 0xc3, 0x93, 0x7d, 0x8b, 0xf6,
+            0x6a, 0x1b, 0x2e, 0xbc, 0x65, 0xab, 0xf8, 0x2c,
+        },
+        .master_secret = {
+            0x8d, 0xd4, 0x8f, 0xa7, 0x84, 0x27, 0xfe, 0xb5,
+            0x8b, 0x5e, 0xd4, 0x13, 0x16, 0x83, 0x08, 0x59,
+            0x7b, 0xd7, 0x8b, 0x9e, 0x05, 0x26, 0xac, 0xe2,
+            0x42, 0xdb, 0x13, 0xe4, 0x46, 0x63, 0xdc, 0xa4,
+            0xb3, 0x15, 0x62, 0x50, 0xfb, 0xfd, 0x03, 0xe7,
+            0xb7, 0x68, 0x3d, 0xec, 0x2c, 0x09, 0x27, 0xfa,
+        },
+        .client_handshake_secret = {
+            0x42, 0xb5, 0xdc, 0xf3, 0x50, 0x66, 0x1f, 0x5f,
+            0xaa, 0x44, 0xd4, 0x8b, 0x26, 0x8d, 0x87, 0xa4,
+            0xe9, 0x3c, 0xcd, 0x57, 0x5c, 0xf7, 0xb4, 0x22,
+            0x40, 0x43, 0x69, 0x07, 0x3a, 0x5f, 0x0a, 0xfc,
+            0x3e, 0xcd, 0x1e, 0x84, 0x4a, 0x87, 0x6d, 0x05,
+            0xd2, 0x24, 0xa6, 0xe9, 0xb5, 0xdb, 0x7e, 0xbe,
+        },
+        .client_handshake_key = {
+            0x84, 0xaf, 0x17, 0x33, 0xea, 0x05, 0x78, 0xe2,
+            0x1d, 0x04, 0x99, 0x1d, 0x99, 0xe1, 0x6f, 0xa7,
+            0xa9, 0x2f, 0xc6, 0xd5, 0x54, 0xb2, 0x6d, 0x91,
+            0x70, 0xdb, 0xe2, 0xe8, 0x24, 0xd7, 0x1c, 0xe3,
+        },
+        .client_handshake_iv = {
+            0x15, 0x90, 0x72, 0x2d, 0xf1, 0x65, 0xfc, 0xb1,
+            0xe9, 0xfa, 0x52, 0x31,
+        },
+        .server_handshake_secret = {
+            0x41, 0x32, 0xf4, 0xda, 0x10, 0x40, 0x22, 0x5f,
+            0xc2, 0x0d, 0x8e, 0x59, 0x7e, 0x62, 0x4f, 0xc0,
+            0x72, 0xc4, 0x6e, 0xc9, 0x84, 0x95, 0x73, 0x79,
+            0x50, 0xba, 0x6e, 0xe8, 0xf0, 0x67, 0xab, 0xc5,
+            0x2f, 0x5b, 0x38, 0x31, 0x9f, 0xda, 0xe2, 0xed,
+            0x42, 0xc2, 0x36, 0xed, 0x4c, 0x16, 0x0f, 0x77,
+        },
+        .server_handshake_key = {
+            0x9b, 0x23, 0x47, 0x4a, 0x08, 0x71, 0x7d, 0x63,
+            0xa7, 0x04, 0xd9, 0x44, 0x95, 0x49, 0x86, 0x24,
+            0xc4, 0xa6, 0xfa, 0x9f, 0xd2, 0x26, 0x14, 0x35,
+            0x21, 0x90, 0x9b, 0x68, 0x0e, 0xdf, 0x02, 0x31,
+        },
+        .server_handshake_iv = {
+            0x1b, 0xc8, 0x30, 0x75, 0x30, 0x71, 0xb2, 0xf8,
+            0x04, 0xde, 0xba, 0xd2,
+        },
+        .client_finished_key = {
+            0x9d, 0xc4, 0xea, 0x80, 0xa1, 0x9c, 0xb3, 0x77,
+            0x7e, 0x49, 0xc9, 0xd3, 0x41, 0xfb, 0xfc, 0x8a,
+            0xcf, 0x90, 0x12, 0x27, 0xd2, 0xac, 0xce, 0xa9,
+            0xbb, 0x6e, 0x81, 0x5a, 0xec, 0x42, 0xf2, 0x6a,
+            0x9e, 0xe0, 0x81, 0x8b, 0x6c, 0x0b, 0x01, 0xec,
+            0x57, 0x2d, 0xf9, 0xe1, 0xff, 0x88, 0x19, 0xb0,
+        },
+        .server_finished_key = {
+            0x77, 0x51, 0xda, 0x73, 0xe7, 0x85, 0xcd, 0x96,
+            0x49, 0x45, 0x82, 0xa6, 0xe1, 0x29, 0x08, 0x96,
+            0x74, 0x6a, 0x81, 0x84, 0x0b, 0xb1, 0x6f, 0x1a,
+            0xa6, 0x23, 0x99, 0xfd, 0x19, 0xf2, 0xed, 0xc2,
+            0xb3, 0x64, 0x7f, 0x9d, 0xd2, 0x36, 0xcc, 0xac,
+            0xce, 0x4c, 0x6c, 0x66, 0x31, 0x7f, 0xe6, 0xfb,
+        },
+        .client_application_secret = {
+            0xd2, 0x8d, 0x98, 0x58, 0x2a, 0xa7, 0xc2, 0x8a,
+            0xa0, 0x50, 0xd7, 0xda, 0x2b, 0x5b, 0x44, 0xf5,
+            0xe9, 0x59, 0xf0, 0x1e, 0xba, 0x26, 0x4f, 0x04,
+            0xa9, 0xb2, 0x39, 0x46, 0x25, 0xa1, 0x16, 0x51,
+            0xdc, 0x78, 0xb6, 0x67, 0x6d, 0x84, 0xc6, 0xa8,
+            0x98, 0x0d, 0xa0, 0x67, 0x86, 0x2d, 0x7b, 0xd5,
+        },
+        .client_application_key = {
+            0x3a, 0x6c, 0x57, 0x64, 0xea, 0x0f, 0x44, 0xc5,
+            0x1b, 0x96, 0x72, 0x07, 0x74, 0x00, 0xe1, 0x9b,
+            0xe1, 0x9f, 0x33, 0x9a, 0xbc, 0x8e, 0x08, 0x59,
+            0x02, 0x8d, 0xbd, 0xf1, 0x67, 0x77, 0x33, 0xef,
+        },
+        .client_application_iv = {
+            0x22, 0x61, 0x15, 0xeb, 0xa5, 0xd3, 0xe8, 0x41,
+            0x8b, 0xe3, 0xdd, 0xad,
+        },
+        .server_application_secret = {
+            0xb9, 0x26, 0x7a, 0x25, 0xe7, 0x63, 0xc1, 0xab,
+            0x3c, 0x24, 0x81, 0x9c, 0xda, 0x90, 0x76, 0x44,
+            0xd7, 0x8f, 0xa4, 0x34, 0x06, 0x79, 0xec, 0x61,
+            0x3a, 0x85, 0xf1, 0xdc, 0xca, 0xbd, 0x08, 0xb1,
+            0x78, 0xd7, 0x4f, 0xea, 0xaf, 0xa3, 0x2c, 0xce,
+            0x1b, 0xd0, 0xa9, 0xd5, 0xa0, 0xe4, 0xf3, 0x17,
+        },
+        .server_application_key = {
+            0xde, 0x8a, 0x8e, 0x32, 0xa0, 0xe2, 0x8f, 0x63,
+            0xa3, 0xf1, 0xb5, 0xad, 0x91, 0x31, 0x00, 0x3c,
+            0xc4, 0xf9, 0x3f, 0x3f, 0x7a, 0xc2, 0x98, 0x98,
+            0xff, 0x15, 0x2e, 0x41, 0x61, 0xba, 0x91, 0x31,
+        },
+        .server_application_iv = {
+            0x10, 0xd1, 0xf8, 0xc0, 0x41, 0x09, 0x41, 0x0f,
+            0xf1, 0xad, 0x1f, 0x98,
+        },
+        .exporter_master_secret = {
+            0x63, 0x06, 0xce, 0xdc, 0x12, 0x98, 0x61, 0xbf,
+            0x2d, 0x97, 0xb5, 0x86, 0x7f, 0x0c, 0xb4, 0x26,
+            0xfd, 0xfa, 0x39, 0xc0, 0xdb, 0x3b, 0x43, 0x4e,
+            0x4b, 0xd3, 0xfc, 0xdc, 0xfd, 0x47, 0x2a, 0xba,
+            0xd3, 0x16, 0x88, 0x9b, 0xed, 0x97, 0x32, 0x46,
+            0xdb, 0xa6, 0xa6, 0xdc, 0xc7, 0xce, 0xf9, 0x89,
+        },
+        .resumption_master_secret = {
+            0x62, 0xb2, 0x81, 0x89, 0xeb, 0x45, 0xa3, 0x71,
+            0x29, 0xbd, 0x71, 0x0d, 0x1d, 0xb2, 0xa6, 0x21,
+            0x40, 0x61, 0xc2, 0x87, 0x0b, 0xf5, 0x0c, 0xb5,
+            0x06, 0xdd, 0x94, 0x0b, 0xdb, 0x92, 0x5b, 0x3d,
+            0x32, 0xee, 0x79, 0x4d, 0xa4, 0x20, 0xf9, 0x54,
+            0x3f, 0x74, 0xbc, 0x82, 0x2b, 0x22, 0xf6, 0xab,
+        },
+    },
+    {
+        .name = "PSK only, TLS_CHACHA20_POLY1305_SHA256",
+        .sha384 = false,
+        .key_size = 32,
+        .psk = tls13_psk2,
+        .psklen = sizeof(tls13_psk2),
+        .server_hello_hash = {
+            0x97, 0x09, 0x0b, 0xa3, 0xb8, 0x86, 0x41, 0x78,
+            0x1b, 0x8c, 0x1e, 0xbc, 0xf3, 0xc4, 0x30, 0xb9,
+            0xbf, 0x83, 0xa8, 0x32, 0x9b, 0xa3, 0x07, 0xdb,
+            0x89, 0x3b, 0xe7, 0x8f, 0xf3, 0x28, 0x65, 0xe1,
+        },
+        .server_finished_hash = {
+            0x75, 0x41, 0x76, 0x8a, 0x45, 0xdb, 0x42, 0x40,
+            0x84, 0xa1, 0x7f, 0xd9, 0x83, 0x33, 0x4c, 0xa7,
+            0x8f, 0x8b, 0xa6, 0xef, 0xc1, 0x47, 0x18, 0xe8,
+            0x50, 0x42, 0xaf, 0xc6, 0xa7, 0xd4, 0xb7, 0x22,
+        },
+        .client_finished_hash = {
+            0xa2, 0xbf, 0x63, 0xf6, 0xd1, 0x2d, 0x35, 0x42,
+            0x29, 0x29, 0xc3, 0x78, 0x9e, 0x02, 0x2c, 0x5d,
+            0x38, 0xee, 0x8f, 0x42, 0xb5, 0xaf, 0xa8, 0xc2,
+            0x16, 0x52, 0xc9, 0xff, 0xae, 0xa4, 0xb6, 0x55,
+        },
+        .early_secret = {
+            0x1f, 0xad, 0x58, 0xc4, 0x73, 0xdb, 0x3c, 0xf5,
+            0x3f, 0x9f, 0x47, 0x60, 0x24, 0xb0, 0x2b, 0x22,
+            0x36, 0xbe, 0x03, 0xec, 0x83, 0xc4, 0xb3, 0x54,
+            0x34, 0xb5, 0x41, 0x51, 0xaa, 0x2a, 0xcb, 0x5f,
+        },
+        .handshake_secret = {
+            0xf6, 0xc9, 0x39, 0x49, 0x9c, 0xd6, 0xfd, 0x7a,
+            0x0a, 0x20, 0x1e, 0xc8, 0x63, 0x98, 0x24, 0xa6,
+            0xf3, 0x49, 0x5a, 0xf6, 0x0e, 0x66, 0x52, 0xee,
+            0x90, 0xba, 0x64, 0x25, 0xb9, 0x95, 0xe8, 0x41,
+        },
+        .master_secret = {
+            0xfb, 0x72, 0x63, 0x0e, 0xfc, 0x59, 0x02, 0x4d,
+            0x82, 0x4d, 0x00, 0x9a, 0xec, 0x4a, 0x66, 0x91,
+            0xea, 0x6a, 0x00, 0xe3, 0x8f, 0x56, 0x9c, 0xf0,
+            0x59, 0x06, 0x15, 0xc3, 0x59, 0x77, 0x2b, 0x14,
+        },
+        .client_handshake_secret = {
+            0xf4, 0x81, 0x0b, 0xed, 0x2d, 0x21, 0x60, 0x96,
+            0xe3, 0x0e, 0xd4, 0x9f, 0x34, 0x58, 0x30, 0x9b,
+            0x26, 0xf4, 0xc6, 0xa7, 0x58, 0xed, 0xa9, 0x3f,
+            0xe1, 0xe1, 0x03, 0x5b, 0x80, 0x7c, 0xa9, 0x37,
+        },
+        .client_handshake_key = {
+            0xbb, 0xd1, 0x2c, 0x34, 0xae, 0x72, 0xb9, 0x4d,
+            0xdf, 0xb5, 0xb5, 0xab, 0xa4, 0x62, 0x98, 0x5d,
+            0xfc, 0x08, 0x26, 0xe6, 0xc1, 0x74, 0x6d, 0xab,
+            0xf2, 0x30, 0xb9, 0x67, 0x00, 0xcb, 0x5e, 0x4a,
+        },
+        .client_handshake_iv = {
+            0xf0, 0x02, 0x31, 0x38, 0xae, 0xfc, 0x93, 0xde,
+            0xf7, 0xc1, 0xfe, 0x4b,
+        },
+        .server_handshake_secret = {
+            0x6e, 0x85, 0xb9, 0xa6, 0x04, 0x96, 0xf2, 0xdc,
+            0x87, 0x2b, 0xd4, 0xb6, 0xbf, 0x0b, 0xda, 0x8e,
+            0x0e, 0x74, 0x65, 0xc7, 0xd7, 0x51, 0xa2, 0xaf,
+            0x83, 0x95, 0xbb, 0x05, 0x4c, 0x52, 0x78, 0xc0,
+        },
+        .server_handshake_key = {
+            0xad, 0x40, 0x29, 0xaf, 0x81, 0xf3, 0xe9, 0xc8,
+            0xb3, 0x37, 0x55, 0xa7, 0x62, 0x23, 0xde, 0x9f,
+            0x40, 0x32, 0xc0, 0x0c, 0x02, 0xf2, 0xaf, 0xd6,
+            0x43, 0xd7, 0x78, 0x38, 0xb7, 0xb2, 0xb9, 0x53,
+        },
+        .server_handshake_iv = {
+            0x67, 0xee, 0xf7, 0xf9, 0x3a, 0x18, 0x4b, 0x00,
+            0x63, 0xda, 0x1e, 0x3d,
+        },
+        .client_finished_key = {
+            0xb8, 0xb4, 0x36, 0xc1, 0x60, 0xa5, 0x49, 0xd7,
+            0xcf, 0xc6, 0xfe, 0x70, 0x9f, 0x2e, 0x92, 0x9c,
+            0x4f, 0xdf, 0xfb, 0xe9, 0xdd, 0x63, 0xaa, 0x37,
+            0xfc, 0xf5, 0x42, 0xbb, 0x1c, 0xae, 0xf9, 0x51,
+        },
+        .server_finished_key = {
+            0x30, 0x4e, 0xfc, 0x09, 0xa4, 0xf3, 0x9a, 0xac,
+            0xd1, 0x65, 0xf9, 0xcc, 0x6f, 0xc0, 0xda, 0x97,
+            0xd4, 0x62, 0x86, 0x06, 0x9f, 0xa8, 0xcf, 0x3a,
+            0xff, 0xa5, 0x58, 0x24, 0x1f, 0x0d, 0x5c, 0x77,
+        },
+        .client_application_secret = {
+            0x57, 0x26, 0xa6, 0x02, 0xa0, 0x89, 0x5c, 0xa2,
+            0xe0, 0x06, 0x62, 0xea, 0x67, 0x33, 0x57, 0xf1,
+            0x83, 0x75, 0x95, 0xac, 0x58, 0x27, 0x9f, 0x65,
+            0x0c, 0x91, 0x4f, 0x20, 0xad, 0x23, 0x0d, 0x1a,
+        },
+        .client_application_key = {
+            0xe6, 0xb7, 0xf0, 0x96, 0xea, 0xe6, 0xde, 0xa2,
+            0x67, 0x19, 0xda, 0x98, 0xa8, 0x08, 0x5d, 0x34,
+            0x9d, 0x49, 0xa6, 0x95, 0xa5, 0x41, 0x93, 0x95,
+            0x80, 0xdf, 0xc5, 0x91, 0x0b, 0xa0, 0xd3, 0x6d,
+        },
+        .client_application_iv = {
+            0x9f, 0x45, 0x28, 0xd6, 0x9f, 0xed, 0xd2, 0x65,
+            0xef, 0xe4, 0xe5, 0x73,
+        },
+        .server_application_secret = {
+            0xe3, 0xb8, 0x9a, 0x9c, 0x3a, 0x87, 0xe6, 0xc7,
+            0x83, 0x26, 0x8f, 0x65, 0x74, 0xe9, 0x2c, 0x2c,
+            0x95, 0xc5, 0x3b, 0x25, 0x3e, 0xfd, 0x2d, 0x1c,
+            0xa0, 0xe5, 0x61, 0x32, 0x62, 0x1b, 0x3d, 0xdd,
+        },
+        .server_application_key = {
+            0x09, 0xf4, 0x2a, 0xc0, 0x97, 0xc8, 0x8e, 0xba,
+            0x34, 0x8c, 0xb4, 0x4d, 0x70, 0x7c, 0x58, 0xc9,
+            0x69, 0x31, 0xb1, 0xea, 0x30, 0x91, 0xe2, 0x13,
+            0x33, 0x49, 0x65, 0xc4, 0xd4, 0x54, 0x65, 0xd5,
+        },
+        .server_application_iv = {
+            0x59, 0x37, 0x42, 0xec, 0xb6, 0x8b, 0x8a, 0x41,
+            0x68, 0x9f, 0x2e, 0x23,
+        },
+        .exporter_master_secret = {
+            0x18, 0xf5, 0x1c, 0xc4, 0x3d, 0xfe, 0x39, 0x5a,
+            0x25, 0x9c, 0x1d, 0x50, 0x5f, 0x2c, 0xbb, 0x3e,
+            0x2e, 0x57, 0xb3, 0xaf, 0x6c, 0xe5, 0xec, 0x44,
+            0x60, 0x01, 0x5c, 0x00, 0x95, 0x2d, 0x23, 0x59,
+        },
+        .resumption_master_secret = {
+            0x9a, 0x3b, 0x60, 0xe8, 0x3c, 0x90, 0xc2, 0xd8,
+            0xfd, 0xc9, 0x2d, 0xb3, 0xc7, 0x6c, 0xbf, 0x02,
+            0x59, 0x2f, 0x29, 0x06, 0x00, 0xdd, 0x78, 0x04,
+            0xde, 0x4f, 0xc4, 0xda, 0x3a, 0x66, 0x5d, 0xae,
+        },
+    },
+};
+
+#endif  // _HKDF_TEST_VECTORS_
@@ -0,0 +1,781 @@
+#ifndef _HMAC_DRBG_TEST_VECTORS_
+#define _HMAC_DRBG_TEST_VECTORS_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * The HMAC_DRBG outputs were computed with a Python implementation of
+ * NIST SP 800-90A section 10.1.2 on top of the hmac module, the same
+ * implementation reproducing the RFC 6979 nonces below. Those are from
+ * RFC 6979, appendix A, except for the secp256k1 one, which is a
+ * commonly used cross-implementation check.
+ */
+
+static const uint8_t hmac_drbg_entropy0[] = {
+    0x6a, 0x5d, 0x67, 0x1b, 0xfd, 0x54, 0x25, 0x9e,
+    0x30, 0xe1, 0xa3, 0xb2, 0x1e, 0x01, 0x69, 0x62,
+    0xe9, 0x8f, 0xa3, 0x41, 0x8c, 0xbd, 0x9d, 0x91,
+    0x85, 0x8b, 0xc7, 0xa8, 0x27, 0x0d, 0x8b, 0x7e,
+};
+
+static const uint8_t hmac_drbg_nonce0[] = {
+    0xd1, 0xb8, 0x14, 0x5c, 0xaa, 0x96, 0xec, 0x61,
+    0x84, 0x65, 0xf5, 0x65, 0xf2, 0x3e, 0x45, 0x7b,
+};
+
+static const uint8_t hmac_drbg_output0[] = {
+    0x45, 0x8b, 0x05, 0x16, 0x98, 0xf0, 0x02, 0x44,
+    0x7e, 0x83, 0x74, 0xb6, 0x21, 0x2b, 0x17, 0x7e,
+    0xd7, 0xb0, 0x3a, 0xe5, 0x09, 0xb0, 0x4c, 0xe0,
+    0xc2, 0x13, 0x9c, 0x2b, 0xeb, 0x21, 0x7d, 0x5f,
+    0x99, 0x1d, 0xdc, 0x88, 0xb9, 0x7b, 0x77, 0x5f,
+    0x0b, 0xa4, 0xdf, 0xde, 0xf3, 0x60, 0x45, 0x0e,
+    0xcd, 0x0b, 0x12, 0xd4, 0xc1, 0x00, 0x78, 0x1c,
+    0x1a, 0x03, 0xfe, 0xda, 0x44, 0x32, 0xdf, 0xdd,
+    0xe3, 0xf8, 0xaf, 0x7e, 0x80, 0x79, 0x9c, 0x46,
+    0xed, 0xfc, 0x1d, 0xe5, 0x4f, 0x41, 0xb2, 0x76,
+    0xc6, 0x2a, 0x9a, 0x2a, 0x2f, 0x20, 0x7e, 0x87,
+    0x1e, 0x89, 0xdb, 0xa7, 0xd2, 0xc4, 0xbc, 0x63,
+    0x93, 0x99, 0xba, 0xc1, 0x6b, 0x7c, 0x65, 0x05,
+    0x78, 0xc9, 0x35, 0x6d, 0x94, 0xc2, 0x9b, 0xe6,
+    0xb4, 0x09, 0x1b, 0xec, 0xd7, 0x52, 0xe7, 0xae,
+    0x14, 0x80, 0xe8, 0x6d, 0x96, 0x35, 0x25, 0x9c,
+};
+
+static const uint8_t hmac_drbg_entropy1[] = {
+    0x64, 0x23, 0x83, 0x2c, 0xc3, 0x69, 0xbf, 0x1a,
+    0x7f, 0x67, 0x8a, 0xfb, 0x78, 0xb7, 0xba, 0xa5,
+    0xea, 0x68, 0x57, 0x71, 0x40, 0x75, 0x76, 0xfb,
+    0x16, 0xa6, 0xfc, 0xc7, 0xbc, 0xf3, 0x47, 0x7f,
+};
+
+static const uint8_t hmac_drbg_nonce1[] = {
+    0xaa, 0x5c, 0xb2, 0xf5, 0x0f, 0x83, 0x4b, 0x3f,
+    0x8d, 0x90, 0x72, 0x3e, 0x3d, 0xff, 0x94, 0xc0,
+};
+
+static const uint8_t hmac_drbg_pers1[] = {
+    0xbb, 0xa3, 0xca, 0xce, 0x48, 0x08, 0x36, 0x8f,
+    0x61, 0xa4, 0x75, 0x90, 0x9b, 0x0d, 0xd0, 0xbb,
+    0x8d, 0xd5, 0x0d, 0x8b, 0x06, 0x6c, 0x89, 0xb2,
+    0x78, 0x1d, 0xa1, 0x7d, 0x78, 0x52, 0x32, 0xa7,
+};
+
+static const uint8_t hmac_drbg_additional11[] = {
+    0xc8, 0x89, 0x6b, 0x91, 0x85, 0xef, 0x5b, 0x95,
+    0x7d, 0x48, 0x02, 0x1a, 0xe5, 0xb4, 0x19, 0xb6,
+    0x42, 0x8b, 0xfc, 0xb9, 0xb3, 0x41, 0x6a, 0x0b,
+    0x92, 0xc7, 0xb5, 0xd2, 0x9f, 0x8f, 0x6d, 0xc6,
+};
+
+static const uint8_t hmac_drbg_additional21[] = {
+    0xdc, 0x27, 0x8f, 0xdf, 0xd7, 0x77, 0x6a, 0x55,
+    0xf3, 0x23, 0x73, 0xc5, 0x30, 0x02, 0xbb, 0xf3,
+    0x0a, 0x3f, 0xc5, 0x03, 0x4f, 0x9a, 0x43, 0x0b,
+    0xf7, 0xaa, 0x18, 0xee, 0x32, 0x86, 0x64, 0x4b,
+};
+
+static const uint8_t hmac_drbg_output1[] = {
+    0xb1, 0x69, 0x40, 0xe2, 0x2d, 0x9e, 0x7b, 0x3a,
+    0x82, 0x82, 0x32, 0x9e, 0xf2, 0x66, 0x1a, 0x60,
+    0x60, 0x28, 0x50, 0x61, 0x37, 0x33, 0xc2, 0xdd,
+    0x2b, 0x32, 0x78, 0xb4, 0x90, 0xc3, 0x4c, 0x47,
+    0x61, 0x30, 0x86, 0xad, 0xc3, 0x16, 0xec, 0x31,
+    0xa1, 0x36, 0xe2, 0xd9, 0x94, 0x47, 0x1f, 0xc1,
+    0x05, 0x73, 0x82, 0xe3, 0x56, 0x91, 0xad, 0xa8,
+    0xc2, 0x2a, 0x25, 0x24, 0x79, 0x47, 0x90, 0x8a,
+    0xae, 0xd1, 0xbe, 0x5e, 0x0a, 0xa7, 0xd8, 0x54,
+    0xe1, 0x84, 0xb3, 0xe6, 0xf5, 0xb7, 0x83, 0xfe,
+    0x1f, 0xea, 0xf7, 0xe8, 0xf3, 0x02, 0x16, 0x8c,
+    0x5e, 0xcb, 0x48, 0x97, 0xcd, 0x96, 0xb6, 0x98,
+    0x6b, 0x66, 0x97, 0x8b, 0x25, 0xd9, 0x81, 0x97,
+    0x6d, 0x53, 0x8c, 0x1b, 0xdc, 0x3c, 0xf8, 0xa6,
+    0xbf, 0x5c, 0xc3, 0xf8, 0x42, 0xaa, 0xdd, 0x30,
+    0x47, 0x1b, 0x92, 0xfe, 0xf3, 0xd1, 0x43, 0xb0,
+};
+
+static const uint8_t hmac_drbg_entropy2[] = {
+    0x1f, 0xd1, 0x2b, 0x68, 0x46, 0x5a, 0xf8, 0xd8,
+    0x5c, 0x99, 0xde, 0x72, 0x28, 0xd3, 0xd9, 0xc4,
+    0xe5, 0x02, 0x8d, 0x10, 0x08, 0x4a, 0x69, 0x2c,
+    0x31, 0x92, 0xb5, 0xcb, 0xac, 0xca, 0xce, 0x47,
+};
+
+static const uint8_t hmac_drbg_nonce2[] = {
+    0xb1, 0x06, 0xc3, 0xc3, 0xa5, 0x36, 0xff, 0xc8,
+    0x9b, 0xa8, 0x77, 0xf3, 0x5d, 0xe0, 0x7e, 0x59,
+};
+
+static const uint8_t hmac_drbg_pers2[] = {
+    0x30, 0xeb, 0x2e, 0xaf, 0x4e, 0x4e, 0x4c, 0x06,
+    0xc7, 0x42, 0xd3, 0x2c, 0x18, 0x41, 0xd1, 0xe9,
+    0x89, 0x99, 0x9d, 0xd7, 0xa2, 0x75, 0x80, 0x90,
+    0x95, 0x21, 0xa1, 0xcd, 0xd0, 0x5c, 0x23, 0xb6,
+};
+
+static const uint8_t hmac_drbg_reseed_entropy2[] = {
+    0x7a, 0xb7, 0x15, 0x05, 0x55, 0xdf, 0xb5, 0x64,
+    0x65, 0x3c, 0x83, 0xe5, 0x78, 0xfb, 0x08, 0x65,
+    0x7e, 0xe4, 0xaa, 0xb7, 0x2e, 0x14, 0xaf, 0x3e,
+    0xf6, 0x61, 0x0a, 0x0c, 0xe0, 0x28, 0xaa, 0x4c,
+};
+
+static const uint8_t hmac_drbg_reseed_additional2[] = {
+    0x24, 0xd5, 0xd2, 0x74, 0x5f, 0x49, 0x26, 0xfd,
+    0xda, 0x8e, 0x14, 0x09, 0x3b, 0x46, 0x47, 0x15,
+    0x6c, 0x43, 0xb6, 0xef, 0xc1, 0x72, 0x9b, 0x5f,
+    0x06, 0x22, 0xd2, 0x18, 0x4e, 0x67, 0x36, 0x10,
+};
+
+static const uint8_t hmac_drbg_additional12[] = {
+    0xed, 0xa7, 0xcb, 0x67, 0x89, 0x0c, 0xf0, 0xe8,
+    0xe7, 0x18, 0xdb, 0xec, 0xb2, 0xf2, 0xe8, 0x06,
+    0x05, 0x16, 0x5c, 0x63, 0x4b, 0xf7, 0xda, 0x17,
+    0x39, 0xab, 0x39, 0x83, 0xd6, 0x09, 0x02, 0x6c,
+};
+
+static const uint8_t hmac_drbg_additional22[] = {
+    0x46, 0x2a, 0xf1, 0xb4, 0x1d, 0xbe, 0xf2, 0x05,
+    0x5d, 0x8c, 0xb4, 0x49, 0xfb, 0x35, 0x00, 0xbb,
+    0xa2, 0x17, 0x5e, 0xa3, 0xe5, 0x89, 0x83, 0x5f,
+    0xf5, 0x90, 0x41, 0x2f, 0x4c, 0xff, 0x82, 0xab,
+};
+
+static const uint8_t hmac_drbg_output2[] = {
+    0xa7, 0xe8, 0xe7, 0xcb, 0xf9, 0x00, 0xfd, 0x06,
+    0x0f, 0x95, 0xe9, 0x10, 0x25, 0xe7, 0xa1, 0x5f,
+    0x3d, 0xd9, 0xde, 0x4b, 0x20, 0x47, 0x03, 0x4c,
+    0x4c, 0x88, 0xcd, 0x0c, 0x75, 0xe6, 0x6f, 0xce,
+    0xae, 0x10, 0xd1, 0x19, 0xc5, 0xb8, 0x3c, 0xc1,
+    0x35, 0x7a, 0x7c, 0xb1, 0x65, 0x30, 0xac, 0x2f,
+    0xe6, 0xd1, 0xba, 0x8c, 0xb2, 0x59, 0x8b, 0xe5,
+    0x71, 0xc4, 0x25, 0x6f, 0x0c, 0x1a, 0x86, 0xa4,
+    0xf0, 0xf9, 0xea, 0x61, 0xcf, 0xcd, 0x77, 0x37,
+    0xb1, 0x99, 0x7f, 0x14, 0x4c, 0x4a, 0xbf, 0xac,
+    0x16, 0x5f, 0x16, 0x85, 0x50, 0x48, 0xe4, 0xc1,
+    0x87, 0x69, 0x53, 0x4c, 0x93, 0xfc, 0x64, 0x1c,
+    0xec, 0x62, 0xa5, 0x07, 0x3b, 0x41, 0x8e, 0x2d,
+    0x36, 0x56, 0x12, 0x26, 0xa5, 0x12, 0x1e, 0xf0,
+    0xa2, 0x70, 0x6a, 0x43, 0xe1, 0x5f, 0x89, 0x07,
+    0xee, 0x7a, 0x17, 0xae, 0x25, 0xd7, 0x90, 0xd6,
+};
+
+static const uint8_t hmac_drbg_entropy3[] = {
+    0x77, 0x79, 0x4e, 0x38, 0xc0, 0x91, 0x98, 0x99,
+    0x74, 0x43, 0xd5, 0xb8, 0x34, 0x92, 0x0a, 0x0e,
+    0xf6, 0x04, 0xa8, 0xc5, 0x08, 0xaa, 0x12, 0xf1,
+    0xb0, 0x48, 0xd1, 0xf8, 0x9f, 0xb8, 0xfc, 0x5b,
+    0xaa, 0xbb, 0xcb, 0xc4, 0xfc, 0x1c, 0x27, 0xb8,
+    0x41, 0x43, 0xe2, 0x98, 0x59, 0xfd, 0xc4, 0xe9,
+};
+
+static const uint8_t hmac_drbg_nonce3[] = {
+    0xde, 0xd4, 0xbb, 0x2a, 0xba, 0xe7, 0x51, 0xe4,
+    0x2c, 0x95, 0x7c, 0xfd, 0xc5, 0xa8, 0x6f, 0xa4,
+    0x8f, 0xd3, 0x91, 0x4a, 0x74, 0x85, 0xf3, 0x1d,
+};
+
+static const uint8_t hmac_drbg_output3[] = {
+    0x45, 0x07, 0x2b, 0x4f, 0x6e, 0xe5, 0xd5, 0x77,
+    0xda, 0x3f, 0x92, 0x04, 0x30, 0x37, 0xfe, 0x1f,
+    0x18, 0x85, 0x04, 0x8e, 0x17, 0x2f, 0x88, 0x18,
+    0xaa, 0xe1, 0xa3, 0x69, 0xa9, 0x5d, 0xfc, 0x48,
+    0x24, 0xcd, 0xeb, 0x24, 0xff, 0xc4, 0xf9, 0x58,
+    0x01, 0xb4, 0xd7, 0xe4, 0xe5, 0x27, 0x84, 0xab,
+    0xc9, 0x1a, 0x3c, 0xad, 0x38, 0xd6, 0x9a, 0x0b,
+    0x9b, 0x4d, 0xaf, 0x7d, 0xa2, 0xcd, 0xfe, 0x82,
+    0x08, 0xb0, 0x55, 0x7c, 0xa2, 0xba, 0x08, 0xe7,
+    0xef, 0x04, 0x57, 0xe2, 0xe0, 0x3e, 0x86, 0x8d,
+    0x3f, 0xaf, 0xd3, 0xff, 0x98, 0xb5, 0x3d, 0x1e,
+    0x90, 0x0e, 0xf8, 0x68, 0x75, 0xf4, 0x70, 0x3b,
+    0x68, 0x07, 0x86, 0xd3, 0x85, 0x15, 0x82, 0xff,
+    0x9d, 0x2f, 0x2a, 0xdf, 0xa6, 0x52, 0x7d, 0xe1,
+    0x5b, 0x15, 0xff, 0x57, 0xf4, 0xc3, 0xdd, 0x9c,
+    0xf7, 0xc3, 0x26, 0x5e, 0x7b, 0x18, 0xef, 0x23,
+    0xec, 0x66, 0x69, 0x59, 0x51, 0x0d, 0x8c, 0x84,
+    0x51, 0xa9, 0x1b, 0x01, 0x5d, 0x30, 0x01, 0xe5,
+    0x1a, 0xb8, 0xc0, 0x8e, 0x10, 0xba, 0x51, 0x02,
+    0xfc, 0x60, 0x40, 0xc7, 0x4d, 0x81, 0xf1, 0xa5,
+    0x11, 0x62, 0x6c, 0x23, 0x2e, 0x98, 0xf8, 0xec,
+    0x79, 0x03, 0xaf, 0xae, 0xbc, 0xc7, 0x87, 0x4f,
+    0xd5, 0xe4, 0x12, 0x20, 0xc9, 0xee, 0x18, 0xdc,
+    0x7a, 0xa9, 0x16, 0x56, 0x71, 0x97, 0x08, 0x10,
+    0x30, 0xd2, 0x7e, 0x73, 0x89, 0xc5, 0xce, 0xd5,
+    0x05, 0x2f, 0x60, 0x2d, 0x2e, 0x0a, 0xf1, 0xed,
+    0x79, 0xc0, 0x0d, 0x37, 0xee, 0x3e, 0x25, 0x19,
+    0x81, 0xe6, 0xc9, 0xf3, 0x8a, 0xe3, 0x0a, 0x38,
+    0xb8, 0x08, 0x3d, 0x65, 0x34, 0x01, 0x1f, 0x1e,
+    0xdc, 0x44, 0x08, 0x95, 0x9f, 0x42, 0x29, 0x00,
+    0xc6, 0x19, 0x25, 0x9f, 0x55, 0x07, 0x36, 0x31,
+    0x44, 0xcc, 0xb8, 0x5f, 0xed, 0xfd, 0x9b, 0x20,
+    0x68, 0xfa, 0x61, 0x66, 0x62, 0x42, 0xa1, 0xbc,
+    0xcd, 0x3e, 0x56, 0x15, 0x30, 0x25, 0x17, 0x8b,
+    0x5d, 0x61, 0xfe, 0x73, 0x5f, 0x8f, 0x1a, 0xc4,
+    0x1c, 0xdc, 0x8d, 0x72, 0x88, 0xd0, 0x4a, 0x43,
+    0x19, 0x45, 0x5a, 0x6d, 0x9e, 0x66, 0xc4, 0xaa,
+    0xf1, 0x60, 0x50, 0x86, 0xef, 0x79, 0x5c, 0x57,
+    0x8b, 0xb6, 0x85, 0xdc, 0x83, 0x3d, 0x09, 0x94,
+    0x79, 0x0e, 0xb3, 0x5a, 0x09, 0x6e, 0x12, 0x12,
+    0xae, 0x08, 0x61, 0x1e, 0x7b, 0x2e, 0xc9, 0x3b,
+    0x7d, 0xa1, 0x0a, 0xf0, 0x81, 0x93, 0x6b, 0xd7,
+    0x30, 0x9b, 0x8a, 0x2a, 0x1a, 0x5d, 0x01, 0x08,
+    0x30, 0x3e, 0xd3, 0x76, 0x89, 0x99, 0x74, 0xcb,
+    0xc1, 0xe6, 0xe1, 0x47, 0x4b, 0xb9, 0xe3, 0x53,
+    0xeb, 0x7d, 0xe1, 0x6d, 0xb7, 0x61, 0xc4, 0x78,
+    0xb3, 0x73, 0xe4, 0xe0, 0x1f, 0x88, 0x21, 0xa4,
+    0x56, 0x02, 0x56, 0x22, 0xac, 0x39, 0x05, 0xe4,
+    0x8e, 0xe6, 0xc7, 0x74, 0x3a, 0x84, 0x37, 0x25,
+    0x32, 0x2b, 0x23, 0x3f, 0x64, 0xbb, 0x0f, 0xd9,
+    0x38, 0x04, 0x5e, 0x10, 0xb8, 0xf2, 0x5a, 0x94,
+    0x62, 0xed, 0xa4, 0x65, 0xa2, 0x92, 0x96, 0x9a,
+    0x9b, 0xc6, 0xec, 0xcf, 0xfa, 0x69, 0x68, 0x09,
+    0x25, 0xe8, 0xad, 0xa5, 0x6b, 0xd6, 0xaf, 0xed,
+    0x85, 0x94, 0x60, 0x91, 0x20, 0xf3, 0x9d, 0xbb,
+    0xe1, 0x90, 0x53, 0xfe, 0xc9, 0xe5, 0x33, 0x5b,
+    0x07, 0x62, 0x7c, 0x27, 0xa1, 0x63, 0x6d, 0xce,
+    0xdb, 0x2c, 0xe0, 0xf6, 0x35, 0x12, 0x1f, 0xe3,
+    0x63, 0x7b, 0x02, 0x39, 0xf1, 0x19, 0x6f, 0xff,
+    0xe2, 0x6a, 0x34, 0xb1, 0x8f, 0xd4, 0x9a, 0xf3,
+    0x87, 0x68, 0xa6, 0x24, 0x26, 0x1e, 0x26, 0x10,
+    0xc4, 0xe9, 0xbc, 0xc6, 0xcd, 0x94, 0xe9, 0xda,
+    0x82, 0x4a, 0xcc, 0x7d, 0x7b, 0x98, 0x21, 0xbc,
+    0x88, 0xe3, 0xd5, 0x7d, 0xf9, 0x1f, 0x9c, 0xa5,
+    0x34, 0xf5, 0x38, 0x4c, 0x59, 0x78, 0x42, 0xa9,
+    0xae, 0xed, 0x1c, 0xe3, 0x33, 0x2d, 0x43, 0x6d,
+    0x8e, 0xbb, 0xef, 0xf3, 0x16, 0x50, 0x51, 0x98,
+    0x29, 0x64, 0xa1, 0x35, 0xa2, 0xc1, 0xbe, 0x5d,
+    0x1c, 0xdb, 0x43, 0x3f, 0x34, 0xac, 0xde, 0x50,
+    0x9a, 0xb2, 0x97, 0x53, 0xcc, 0x1c, 0x90, 0x37,
+    0x4a, 0x92, 0xcf, 0x4b, 0x59, 0xdb, 0x8e, 0xac,
+    0x16, 0x0f, 0x6f, 0xb6, 0x01, 0x16, 0x81, 0xde,
+    0x21, 0xed, 0x42, 0x08, 0x3e, 0x64, 0x16, 0xbb,
+    0xb5, 0x39, 0xe4, 0xa1, 0x2c, 0xf3, 0xf7, 0xe6,
+    0xf4, 0xfd, 0xa2, 0x0a, 0x6e, 0xa7, 0x06, 0x8e,
+    0xbe, 0xbc, 0x1d, 0xce, 0x15, 0xbc, 0x47, 0xe6,
+    0x14, 0x13, 0x32, 0xbd, 0xaa, 0x19, 0xca, 0xda,
+    0x10, 0x88, 0xbd, 0xdb, 0xcb, 0x84, 0xa7, 0xb0,
+    0x39, 0x40, 0x3e, 0x41, 0xd9, 0xbb, 0xdc, 0x33,
+    0x08, 0x4c, 0x2c, 0x41, 0x8c, 0x8e, 0xb1, 0x34,
+    0xaa, 0x8a, 0xb0, 0x0a, 0x0e, 0x6f, 0xbf, 0xf3,
+    0x3b, 0x71, 0x62, 0xc4, 0xa6, 0xd0, 0x94, 0xcc,
+    0x5a, 0xaf, 0xb5, 0x6c, 0x50, 0x00, 0x7f, 0x48,
+    0x69, 0xce, 0xef, 0xf0, 0x43, 0x60, 0x2e, 0x21,
+    0x8f, 0x96, 0xe3, 0xb7, 0x27, 0xc3, 0xf7, 0x6c,
+    0x4f, 0x13, 0x38, 0x5b, 0x93, 0x05, 0x94, 0x66,
+    0xf8, 0xf4, 0xcd, 0xa2, 0xc3, 0x12, 0x76, 0xd3,
+    0x91, 0x11, 0xbb, 0x30, 0x98, 0x88, 0x6c, 0x75,
+    0x7d, 0x24, 0xd4, 0x4d, 0x3b, 0xa6, 0x3e, 0x9e,
+    0x4f, 0xc4, 0x0a, 0xfe, 0xfe, 0x1d, 0x33, 0xa2,
+    0xfb, 0x2e, 0xdf, 0x17, 0x31, 0xd9, 0x85, 0x97,
+    0x94, 0x3c, 0xc2, 0x8e, 0x59, 0x5c, 0xf2, 0x58,
+    0xae, 0xd0, 0xd1, 0x2d, 0xc7, 0x20, 0xe6, 0x09,
+    0xec, 0xf2, 0x9b, 0x2f, 0xa1, 0x71, 0x0b, 0x6e,
+    0x72, 0xc3, 0x9b, 0x8b, 0x86, 0xbc, 0xc2, 0xd8,
+    0xb2, 0x1c, 0x0e, 0xfd, 0x89, 0x80, 0x51, 0xa1,
+    0x0c, 0x42, 0x18, 0xa3, 0xb6, 0xbf, 0x3e, 0x3c,
+    0x51, 0xb2, 0x33, 0xa7, 0xfe, 0xbe, 0xdb, 0x50,
+    0xbf, 0x60, 0x7a, 0xd0, 0x1e, 0x54, 0xf2, 0x74,
+    0x43, 0x32, 0xb2, 0x0d, 0xcd, 0xb1, 0x08, 0xa6,
+    0x82, 0xd0, 0x98, 0x31, 0xd4, 0x2f, 0x1a, 0x4a,
+    0x1d, 0x2f, 0xaa, 0x92, 0x52, 0x48, 0x25, 0xd7,
+    0xec, 0x68, 0x36, 0x8e, 0x15, 0x14, 0xba, 0x21,
+    0xac, 0x89, 0x80, 0x7c, 0x1e, 0x98, 0x69, 0x8b,
+    0x16, 0xd1, 0xba, 0x6d, 0x33, 0x85, 0x4c, 0x72,
+    0x09, 0x77, 0x96, 0x1d, 0x1e, 0x4e, 0x41, 0x37,
+    0xd9, 0x58, 0xb2, 0x4f, 0x9c, 0x37, 0x3c, 0x6b,
+    0xee, 0x34, 0xaa, 0xed, 0xc0, 0x6b, 0xe0, 0xf3,
+    0xdc, 0xf5, 0x62, 0x35, 0xa5, 0x44, 0xf9, 0x1f,
+    0xf0, 0x07, 0x2d, 0x14, 0x73, 0x57, 0x90, 0xef,
+    0xc4, 0xaa, 0x4f, 0x15, 0x5f, 0xe9, 0x0b, 0x0f,
+    0xb4, 0x13, 0x3a, 0x67, 0xe2, 0x46, 0xbc, 0x71,
+    0x54, 0x5f, 0xe7, 0x31, 0x27, 0xe3, 0x4a, 0xc2,
+    0x69, 0x8b, 0x82, 0x75, 0x16, 0x66, 0x89, 0xea,
+    0x07, 0x53, 0x4f, 0x52, 0x25, 0x87, 0x69, 0xed,
+    0x1b, 0x8b, 0x81, 0x8b, 0x53, 0x74, 0x03, 0x85,
+    0xb7, 0xdb, 0x20, 0xec, 0xa7, 0x16, 0xb0, 0x44,
+    0x15, 0x7f, 0xb9, 0xc0, 0x16, 0x95, 0xe3, 0x71,
+    0xf9, 0x6b, 0x6c, 0x03, 0x9c, 0xb2, 0xca, 0xa2,
+    0xd0, 0xc9, 0xc5, 0xa4, 0x2f, 0xc9, 0xf3, 0x23,
+    0xbc, 0x54, 0xa9, 0xc0, 0xcf, 0x8a, 0x11, 0x4a,
+    0xb9, 0xb7, 0xa7, 0x94, 0x9f, 0xa7, 0x7e, 0xac,
+    0x37, 0x9e, 0x17, 0x3f, 0x7f, 0x83, 0xeb, 0x78,
+    0xef, 0xea, 0x33, 0xff, 0x9c, 0x1d, 0xf9, 0x5b,
+    0xaa, 0x59, 0xbf, 0x20, 0x14, 0x01, 0x8c, 0xdb,
+};
+
+static const uint8_t hmac_drbg_entropy4[] = {
+    0x6f, 0xac, 0xd5, 0xdd, 0x5b, 0x69, 0x26, 0xab,
+    0x11, 0x46, 0x5b, 0x58, 0x58, 0x15, 0xe6, 0x15,
+    0xb8, 0x01, 0x74, 0x8f, 0x36, 0x1b, 0xf7, 0x0c,
+    0xa2, 0x3c, 0x01, 0x4f, 0x5d, 0x57, 0xea, 0x6f,
+    0x9a, 0x20, 0x2d, 0xf0, 0x23, 0x7e, 0xf8, 0x8a,
+    0xee, 0x95, 0xbc, 0x1e, 0xab, 0xd2, 0x2a, 0xba,
+    0x11, 0x3e, 0x89, 0x56, 0x26, 0x69, 0xf8, 0x48,
+    0x14, 0x01, 0x85, 0xf8, 0xd2, 0x99, 0x9e, 0xd5,
+};
+
+static const uint8_t hmac_drbg_nonce4[] = {
+    0xab, 0x9f, 0xc6, 0xaa, 0x6f, 0x28, 0x51, 0x2a,
+    0xf8, 0xb6, 0x9d, 0x7a, 0xdc, 0xd8, 0x72, 0x5b,
+    0x36, 0x59, 0xac, 0x7e, 0x65, 0x78, 0x0d, 0x9b,
+    0x1e, 0x3a, 0x38, 0x24, 0xc3, 0x21, 0x4e, 0xf3,
+};
+
+static const uint8_t hmac_drbg_output4[] = {
+    0x08, 0x67, 0xac, 0x2a, 0x4a, 0x2b, 0xdf, 0xd7,
+    0xdc, 0x20, 0x4c, 0x52, 0x9a, 0x26, 0x40, 0x20,
+    0x20, 0x59, 0xd9, 0x4a, 0xe9, 0xe1, 0xff, 0x98,
+    0x0f, 0x71, 0x73, 0xa7, 0x81, 0x61, 0x9f, 0xcd,
+    0x83, 0xf7, 0xcd, 0xe4, 0xd6, 0x94, 0x68, 0x5e,
+    0xe3, 0x9a, 0x7b, 0x40, 0x93, 0x6d, 0x99, 0x6b,
+    0xb5, 0x31, 0x14, 0x6c, 0x23, 0x47, 0xe2, 0x4d,
+    0xcc, 0x5d, 0xae, 0xb9, 0x1c, 0x46, 0x44, 0x35,
+    0xb5, 0x12, 0xe4, 0xaa, 0x14, 0xe3, 0x3d, 0x35,
+    0x44, 0xf4, 0x67, 0x4a, 0x0e, 0x01, 0xb7, 0xcb,
+    0x3b, 0x48, 0x79, 0x85, 0x78, 0x6b, 0x2a, 0x8a,
+    0x57, 0x47, 0x32, 0xa0, 0x03, 0x7c, 0x42, 0xe3,
+    0x60, 0x7c, 0x1e, 0x20, 0x7e, 0xcc, 0x5f, 0xa9,
+    0x28, 0x17, 0x3d, 0x35, 0x2d, 0xea, 0x85, 0x7b,
+    0x9f, 0xd6, 0x68, 0x0c, 0x58, 0x57, 0x0f, 0x53,
+    0x30, 0xeb, 0x5a, 0x51, 0x80, 0xb2, 0xd9, 0x62,
+    0x5d, 0x31, 0xae, 0x56, 0x8b, 0xa5, 0xb2, 0x97,
+    0x24, 0x53, 0x46, 0x67, 0x41, 0xb9, 0x46, 0x32,
+    0x0c, 0x37, 0x9d, 0x30, 0xce, 0xc9, 0x81, 0x5e,
+    0x0d, 0x7e, 0xd7, 0x92, 0xed, 0xea, 0x5e, 0x7c,
+    0xba, 0x2f, 0x75, 0xec, 0x23, 0xb0, 0xa0, 0xd5,
+    0x50, 0x9e, 0x81, 0x37, 0x24, 0x1a, 0xca, 0x5e,
+    0x05, 0x21, 0xc3, 0x88, 0xe4, 0x51, 0xd2, 0x86,
+    0xa5, 0xce, 0xb3, 0x22, 0x5b, 0x23, 0xd1, 0x72,
+    0x67, 0xa0, 0x3a, 0x86, 0xc6, 0x47, 0xad, 0xff,
+    0x59, 0xf2, 0xbf, 0x65, 0x99, 0x34, 0x2d, 0x58,
+    0x3a, 0x25, 0xb0, 0x01, 0xde, 0x12, 0x77, 0x98,
+    0xf4, 0xd1, 0xd0, 0x89, 0x46, 0x54, 0x4e, 0x41,
+    0x25, 0xe5, 0xa5, 0xd2, 0x90, 0x49, 0xd1, 0xb5,
+    0x88, 0xd3, 0x44, 0xf9, 0x3b, 0x0b, 0xd0, 0xae,
+    0x12, 0x3a, 0xf6, 0xeb, 0x37, 0x6b, 0xc5, 0x4b,
+    0xb0, 0x89, 0xd1, 0x38, 0x40, 0x73, 0xf9, 0x56,
+};
+
+static const uint8_t hmac_drbg_entropy5[] = {
+    0x23, 0x2d, 0x47, 0x52, 0x88, 0x0b, 0x66, 0x59,
+    0xff, 0xd6, 0x62, 0xa7, 0x21, 0x16, 0x4f, 0x77,
+    0xbf, 0x3c, 0x0c, 0x96, 0x27, 0x97, 0x34, 0xa3,
+    0xed, 0xf7, 0xd3, 0x42, 0xd2, 0x7f, 0x52, 0x13,
+    0x62, 0x0f, 0x4c, 0xfa, 0x85, 0x5f, 0x4a, 0xb4,
+    0xc2, 0xec, 0x10, 0xed, 0x29, 0x30, 0xa7, 0x39,
+    0x6a, 0x0d, 0x01, 0xef, 0x2a, 0x8a, 0xb7, 0xa3,
+    0xb5, 0x51, 0xdb, 0x2c, 0x49, 0x4c, 0x82, 0x19,
+};
+
+static const uint8_t hmac_drbg_nonce5[] = {
+    0x38, 0xeb, 0x26, 0x60, 0xea, 0x5f, 0xd8, 0x0e,
+    0x1d, 0xa4, 0x39, 0x15, 0x61, 0xc0, 0xa9, 0xc1,
+    0x8c, 0x07, 0xcb, 0xfb, 0x02, 0x3d, 0xb4, 0x73,
+    0x25, 0x08, 0x10, 0xe8, 0xf5, 0x2b, 0x4f, 0x1c,
+};
+
+static const uint8_t hmac_drbg_pers5[] = {
+    0x81, 0x1d, 0x98, 0x26, 0x5e, 0x0c, 0x10, 0xcc,
+    0x4e, 0x29, 0x82, 0xc7, 0xa2, 0xeb, 0x83, 0xf2,
+    0x5e, 0x26, 0x45, 0x0e, 0xb9, 0x17, 0x17, 0x48,
+    0x86, 0x05, 0x13, 0x03, 0xad, 0x36, 0xee, 0xcb,
+    0x47, 0xdd, 0xf7, 0xb7, 0x26, 0x03, 0x86, 0xc0,
+    0xd2, 0x1c, 0xd1, 0xd1, 0xaa, 0x03, 0xfe, 0x5a,
+    0xea, 0xa0, 0x79, 0xf5, 0xa5, 0x25, 0xa5, 0x31,
+    0x51, 0xaa, 0x90, 0x6b, 0x6a, 0x96, 0x63, 0xb4,
+};
+
+static const uint8_t hmac_drbg_reseed_entropy5[] = {
+    0x0f, 0x98, 0x59, 0x69, 0x63, 0xb1, 0x8f, 0x3b,
+    0xc8, 0x02, 0x3c, 0x34, 0x10, 0xd0, 0xe3, 0xd1,
+    0x29, 0xbe, 0x0f, 0x6f, 0x90, 0xc0, 0xe8, 0x37,
+    0xa1, 0xb4, 0x4f, 0xea, 0xd4, 0xd9, 0xe4, 0x0a,
+    0x1d, 0xcf, 0x4e, 0xef, 0xc8, 0x73, 0xf5, 0xe0,
+    0x49, 0x64, 0x4d, 0xd5, 0x79, 0xeb, 0x06, 0x98,
+    0xaa, 0x31, 0xb7, 0xf9, 0x70, 0xc6, 0xd3, 0x46,
+    0xfc, 0x77, 0xdf, 0xae, 0xc8, 0x96, 0xb9, 0xc7,
+};
+
+static const uint8_t hmac_drbg_reseed_additional5[] = {
+    0x45, 0x86, 0xd4, 0x0c, 0x0b, 0xeb, 0x29, 0xa1,
+    0x67, 0xd8, 0xef, 0xc2, 0xbe, 0xab, 0xe3, 0xb7,
+    0x8b, 0xa8, 0x0e, 0xab, 0x2c, 0xc7, 0x1b, 0xfa,
+    0x86, 0x48, 0x8b, 0x21, 0xb3, 0xef, 0xf8, 0xde,
+    0x40, 0xd3, 0x1f, 0x0a, 0xfd, 0xc8, 0x5f, 0x6b,
+    0xc1, 0x15, 0x50, 0x31, 0x18, 0xe4, 0xbf, 0x26,
+    0xe5, 0xfe, 0x5f, 0xc4, 0xf0, 0xb8, 0xe6, 0xef,
+    0x43, 0x70, 0x7f, 0xff, 0x4f, 0x8b, 0x2c, 0x28,
+};
+
+static const uint8_t hmac_drbg_additional15[] = {
+    0xae, 0x71, 0xd5, 0x27, 0x2e, 0xb6, 0x0a, 0x0d,
+    0x17, 0x2e, 0x52, 0x99, 0x05, 0x46, 0xe2, 0x85,
+    0x27, 0x5b, 0x17, 0xd4, 0x39, 0xeb, 0x96, 0x9d,
+    0x89, 0x9e, 0xdf, 0x53, 0x9e, 0x1a, 0xe5, 0xd5,
+    0x01, 0x92, 0x4a, 0xed, 0x3f, 0xe4, 0x74, 0x68,
+    0x94, 0x1b, 0x2d, 0x6b, 0x86, 0x4e, 0x82, 0xde,
+    0x3e, 0x7e, 0xe1, 0xfb, 0xb1, 0x01, 0x7f, 0x1e,
+    0xbb, 0xbc, 0xc3, 0xd2, 0x0a, 0x7c, 0x35, 0xfe,
+};
+
+static const uint8_t hmac_drbg_additional25[] = {
+    0xdb, 0xd0, 0xdf, 0x7b, 0x6f, 0x56, 0xc8, 0x8d,
+    0x53, 0x4b, 0x81, 0xe8, 0x1e, 0x7e, 0x73, 0xc4,
+    0x77, 0xae, 0x76, 0xcf, 0x5e, 0x3b, 0xe7, 0xa1,
+    0x04, 0x44, 0x9a, 0x2e, 0x3c, 0xdd, 0xeb, 0x22,
+    0xd3, 0x16, 0x03, 0x54, 0x39, 0x90, 0x77, 0xff,
+    0x68, 0x60, 0x16, 0xb3, 0x89, 0xbd, 0xc2, 0x69,
+    0xba, 0x2e, 0x43, 0xae, 0x41, 0x33, 0x60, 0xfd,
+    0x8f, 0x9b, 0x99, 0xf5, 0xc1, 0xc9, 0xa7, 0x1f,
+};
+
+static const uint8_t hmac_drbg_output5[] = {
+    0x5e, 0x3b, 0x1a, 0xa5, 0xaf, 0xfb, 0x3a, 0x67,
+    0xa6, 0xe3, 0x28, 0xd9, 0xda, 0x1b, 0x82, 0x5d,
+    0x5e, 0x3b, 0x11, 0x0e, 0x02, 0xe0, 0xec, 0xc2,
+    0x1f, 0xeb, 0x3e, 0x8d, 0x54, 0x5d, 0xb7, 0x2e,
+    0x51, 0x29, 0x86, 0x31, 0xb1, 0x25, 0xfa, 0x4b,
+    0x97, 0x3d, 0xe3, 0xac, 0x78, 0x88, 0xbe, 0xef,
+    0xc8, 0x33, 0xa3, 0x79, 0xbb, 0xa5, 0x6d, 0xb1,
+    0x5b, 0xb4, 0xf2, 0xde, 0x87, 0x02, 0xbc, 0xcd,
+    0x72, 0xcc, 0x57, 0x32, 0xe7, 0xf4, 0x1e, 0x9d,
+    0xd9, 0x95, 0xcb, 0xa8, 0xff, 0x54, 0x33, 0x6b,
+    0x96, 0xa2, 0x4d, 0xc4, 0xb6, 0xe0, 0x1b, 0xa8,
+    0x91, 0x7b, 0x40, 0xf8, 0x3d, 0xf2, 0x92, 0xc0,
+    0x56, 0x1c, 0xaa, 0x4f, 0xe0, 0xba, 0x11, 0x9d,
+    0x73, 0xce, 0x44, 0x8d, 0x8f, 0x00, 0x7f, 0x0b,
+    0xd7, 0x50, 0x1c, 0x8c, 0xda, 0xe1, 0x85, 0xcb,
+    0x9e, 0xa5, 0xc2, 0x2f, 0xe3, 0xdf, 0x77, 0x2e,
+    0xa5, 0x67, 0x6b, 0xa5, 0x42, 0xc3, 0xb3, 0x6b,
+    0xce, 0xac, 0x52, 0xb8, 0x7d, 0xcd, 0xb5, 0x98,
+    0x90, 0xdf, 0xea, 0x28, 0x3f, 0x72, 0xeb, 0x83,
+    0x59, 0x56, 0xe4, 0x39, 0xfe, 0x91, 0x85, 0xd5,
+    0x6b, 0x67, 0xa7, 0x17, 0xf4, 0x12, 0xe9, 0x48,
+    0xb6, 0x59, 0x10, 0xd7, 0x67, 0xed, 0xf0, 0x86,
+    0x1f, 0xe1, 0xdf, 0xba, 0xb1, 0x8d, 0x9e, 0x4f,
+    0xbe, 0x4f, 0x0b, 0xfd, 0x11, 0x18, 0xb0, 0x9b,
+    0x3a, 0x1d, 0xa2, 0x27, 0x0f, 0x5c, 0x53, 0x52,
+    0x81, 0xc3, 0x62, 0xbc, 0x40, 0x7a, 0x0e, 0x14,
+    0x26, 0xae, 0xce, 0x6e, 0x97, 0x63, 0x4a, 0xbc,
+    0x09, 0xc2, 0xf4, 0x26, 0xe8, 0x99, 0x7b, 0xa5,
+    0x4c, 0x89, 0xfe, 0xda, 0xfa, 0x8c, 0x08, 0x80,
+    0x98, 0xf0, 0x14, 0xe0, 0x6d, 0xbb, 0x8c, 0x64,
+    0xd3, 0x82, 0x4e, 0x4c, 0x8a, 0xe0, 0x38, 0x57,
+    0x24, 0xc6, 0x92, 0xe6, 0xe4, 0x03, 0x83, 0x39,
+};
+
+static const struct hmac_drbg_test hmac_drbg_tests[] = {
+    {
+        .name = "HMAC_DRBG-SHA-256, no additional input",
+        .sha512 = false,
+        .entropy = hmac_drbg_entropy0,
+        .entropylen = sizeof(hmac_drbg_entropy0),
+        .nonce = hmac_drbg_nonce0,
+        .noncelen = sizeof(hmac_drbg_nonce0),
+        .output = hmac_drbg_output0,
+        .outputlen = sizeof(hmac_drbg_output0),
+    },
+    {
+        .name = "HMAC_DRBG-SHA-256, personalization and additional input",
+        .sha512 = false,
+        .entropy = hmac_drbg_entropy1,
+        .entropylen = sizeof(hmac_drbg_entropy1),
+        .nonce = hmac_drbg_nonce1,
+        .noncelen = sizeof(hmac_drbg_nonce1),
+        .pers = hmac_drbg_pers1,
+        .perslen = sizeof(hmac_drbg_pers1),
+        .additional1 = hmac_drbg_additional11,
+        .additional1len = sizeof(hmac_drbg_additional11),
+        .additional2 = hmac_drbg_additional21,
+        .additional2len = sizeof(hmac_drbg_additional21),
+        .output = hmac_drbg_output1,
+        .outputlen = sizeof(hmac_drbg_output1),
+    },
+    {
+        .name = "HMAC_DRBG-SHA-256, reseed",
+        .sha512 = false,
+        .entropy = hmac_drbg_entropy2,
+        .entropylen = sizeof(hmac_drbg_entropy2),
+        .nonce = hmac_drbg_nonce2,
+        .noncelen = sizeof(hmac_drbg_nonce2),
+        .pers = hmac_drbg_pers2,
+        .perslen = sizeof(hmac_drbg_pers2),
+        .reseed_entropy = hmac_drbg_reseed_entropy2,
+        .reseed_entropylen = sizeof(hmac_drbg_reseed_entropy2),
+        .reseed_additional = hmac_drbg_reseed_additional2,
+        .reseed_additionallen = sizeof(hmac_drbg_reseed_additional2),
+        .additional1 = hmac_drbg_additional12,
+        .additional1len = sizeof(hmac_drbg_additional12),
+        .additional2 = hmac_drbg_additional22,
+        .additional2len = sizeof(hmac_drbg_additional22),
+        .output = hmac_drbg_output2,
+        .outputlen = sizeof(hmac_drbg_output2),
+    },
+    {
+        .name = "HMAC_DRBG-SHA-256, 1000 bytes output",
+        .sha512 = false,
+        .entropy = hmac_drbg_entropy3,
+        .entropylen = sizeof(hmac_drbg_entropy3),
+        .nonce = hmac_drbg_nonce3,
+        .noncelen = sizeof(hmac_drbg_nonce3),
+        .output = hmac_drbg_output3,
+        .outputlen = sizeof(hmac_drbg_output3),
+    },
+    {
+        .name = "HMAC_DRBG-SHA-512, no additional input",
+        .sha512 = true,
+        .entropy = hmac_drbg_entropy4,
+        .entropylen = sizeof(hmac_drbg_entropy4),
+        .nonce = hmac_drbg_nonce4,
+        .noncelen = sizeof(hmac_drbg_nonce4),
+        .output = hmac_drbg_output4,
+        .outputlen = sizeof(hmac_drbg_output4),
+    },
+    {
+        .name = "HMAC_DRBG-SHA-512, reseed and additional input",
+        .sha512 = true,
+        .entropy = hmac_drbg_entropy5,
+        .entropylen = sizeof(hmac_drbg_entropy5),
+        .nonce = hmac_drbg_nonce5,
+        .noncelen = sizeof(hmac_drbg_nonce5),
+        .pers = hmac_drbg_pers5,
+        .perslen = sizeof(hmac_drbg_pers5),
+        .reseed_entropy = hmac_drbg_reseed_entropy5,
+        .reseed_entropylen = sizeof(hmac_drbg_reseed_entropy5),
+        .reseed_additional = hmac_drbg_reseed_additional5,
+        .reseed_additionallen = sizeof(hmac_drbg_reseed_additional5),
+        .additional1 = hmac_drbg_additional15,
+        .additional1len = sizeof(hmac_drbg_additional15),
+        .additional2 = hmac_drbg_additional25,
+        .additional2len = sizeof(hmac_drbg_additional25),
+        .output = hmac_drbg_output5,
+        .outputlen = sizeof(hmac_drbg_output5),
+    },
+};
+
+static const uint8_t rfc6979_h1_0[] = {
+    0xaf, 0x2b, 0xdb, 0xe1, 0xaa, 0x9b, 0x6e, 0xc1,
+    0xe2, 0xad, 0xe1, 0xd6, 0x94, 0xf4, 0x1f, 0xc7,
+    0x1a, 0x83, 0x1d, 0x02, 0x68, 0xe9, 0x89, 0x15,
+    0x62, 0x11, 0x3d, 0x8a, 0x62, 0xad, 0xd1, 0xbf,
+};
+
+static const uint8_t rfc6979_h1_1[] = {
+    0xaf, 0x2b, 0xdb, 0xe1, 0xaa, 0x9b, 0x6e, 0xc1,
+    0xe2, 0xad, 0xe1, 0xd6, 0x94, 0xf4, 0x1f, 0xc7,
+    0x1a, 0x83, 0x1d, 0x02, 0x68, 0xe9, 0x89, 0x15,
+    0x62, 0x11, 0x3d, 0x8a, 0x62, 0xad, 0xd1, 0xbf,
+};
+
+static const uint8_t rfc6979_h1_2[] = {
+    0xee, 0x26, 0xb0, 0xdd, 0x4a, 0xf7, 0xe7, 0x49,
+    0xaa, 0x1a, 0x8e, 0xe3, 0xc1, 0x0a, 0xe9, 0x92,
+    0x3f, 0x61, 0x89, 0x80, 0x77, 0x2e, 0x47, 0x3f,
+    0x88, 0x19, 0xa5, 0xd4, 0x94, 0x0e, 0x0d, 0xb2,
+    0x7a, 0xc1, 0x85, 0xf8, 0xa0, 0xe1, 0xd5, 0xf8,
+    0x4f, 0x88, 0xbc, 0x88, 0x7f, 0xd6, 0x7b, 0x14,
+    0x37, 0x32, 0xc3, 0x04, 0xcc, 0x5f, 0xa9, 0xad,
+    0x8e, 0x6f, 0x57, 0xf5, 0x00, 0x28, 0xa8, 0xff,
+};
+
+static const uint8_t rfc6979_h1_3[] = {
+    0xaf, 0x2b, 0xdb, 0xe1, 0xaa, 0x9b, 0x6e, 0xc1,
+    0xe2, 0xad, 0xe1, 0xd6, 0x94, 0xf4, 0x1f, 0xc7,
+    0x1a, 0x83, 0x1d, 0x02, 0x68, 0xe9, 0x89, 0x15,
+    0x62, 0x11, 0x3d, 0x8a, 0x62, 0xad, 0xd1, 0xbf,
+};
+
+static const uint8_t rfc6979_h1_4[] = {
+    0xee, 0x26, 0xb0, 0xdd, 0x4a, 0xf7, 0xe7, 0x49,
+    0xaa, 0x1a, 0x8e, 0xe3, 0xc1, 0x0a, 0xe9, 0x92,
+    0x3f, 0x61, 0x89, 0x80, 0x77, 0x2e, 0x47, 0x3f,
+    0x88, 0x19, 0xa5, 0xd4, 0x94, 0x0e, 0x0d, 0xb2,
+    0x7a, 0xc1, 0x85, 0xf8, 0xa0, 0xe1, 0xd5, 0xf8,
+    0x4f, 0x88, 0xbc, 0x88, 0x7f, 0xd6, 0x7b, 0x14,
+    0x37, 0x32, 0xc3, 0x04, 0xcc, 0x5f, 0xa9, 0xad,
+    0x8e, 0x6f, 0x57, 0xf5, 0x00, 0x28, 0xa8, 0xff,
+};
+
+static const uint8_t rfc6979_h1_5[] = {
+    0xa0, 0xdc, 0x65, 0xff, 0xca, 0x79, 0x98, 0x73,
+    0xcb, 0xea, 0x0a, 0xc2, 0x74, 0x01, 0x5b, 0x95,
+    0x26, 0x50, 0x5d, 0xaa, 0xae, 0xd3, 0x85, 0x15,
+    0x54, 0x25, 0xf7, 0x33, 0x77, 0x04, 0x88, 0x3e,
+};
+
+static const struct rfc6979_test rfc6979_tests[] = {
+    {
+        .name = "RFC 6979 A.1.2, qlen=163, SHA-256, 'sample'",
+        .sha512 = false,
+        .qlen = 163,
+        .q = {
+            0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x02, 0x01, 0x08, 0xa2, 0xe0, 0xcc,
+            0x0d, 0x99, 0xf8, 0xa5, 0xef,
+        },
+        .x = {
+            0x00, 0x9a, 0x4d, 0x67, 0x92, 0x29, 0x5a, 0x7f,
+            0x73, 0x0f, 0xc3, 0xf2, 0xb4, 0x9c, 0xbc, 0x0f,
+            0x62, 0xe8, 0x62, 0x27, 0x2f,
+        },
+        .h1 = rfc6979_h1_0,
+        .h1len = sizeof(rfc6979_h1_0),
+        .k = {
+            0x02, 0x3a, 0xf4, 0x07, 0x4c, 0x90, 0xa0, 0x2b,
+            0x3f, 0xe6, 0x1d, 0x28, 0x6d, 0x5c, 0x87, 0xf4,
+            0x25, 0xe6, 0xbd, 0xd8, 0x1b,
+        },
+    },
+    {
+        .name = "RFC 6979 A.2.3, P-192, SHA-256, 'sample'",
+        .sha512 = false,
+        .qlen = 192,
+        .q = {
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0x99, 0xde, 0xf8, 0x36,
+            0x14, 0x6b, 0xc9, 0xb1, 0xb4, 0xd2, 0x28, 0x31,
+        },
+        .x = {
+            0x6f, 0xab, 0x03, 0x49, 0x34, 0xe4, 0xc0, 0xfc,
+            0x9a, 0xe6, 0x7f, 0x5b, 0x56, 0x59, 0xa9, 0xd7,
+            0xd1, 0xfe, 0xfd, 0x18, 0x7e, 0xe0, 0x9f, 0xd4,
+        },
+        .h1 = rfc6979_h1_1,
+        .h1len = sizeof(rfc6979_h1_1),
+        .k = {
+            0x32, 0xb1, 0xb6, 0xd7, 0xd4, 0x2a, 0x05, 0xcb,
+            0x44, 0x90, 0x65, 0x72, 0x7a, 0x84, 0x80, 0x4f,
+            0xb1, 0xa3, 0xe3, 0x4d, 0x8f, 0x26, 0x14, 0x96,
+        },
+    },
+    {
+        .name = "RFC 6979 A.2.3, P-192, SHA-512, 'test'",
+        .sha512 = true,
+        .qlen = 192,
+        .q = {
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0x99, 0xde, 0xf8, 0x36,
+            0x14, 0x6b, 0xc9, 0xb1, 0xb4, 0xd2, 0x28, 0x31,
+        },
+        .x = {
+            0x6f, 0xab, 0x03, 0x49, 0x34, 0xe4, 0xc0, 0xfc,
+            0x9a, 0xe6, 0x7f, 0x5b, 0x56, 0x59, 0xa9, 0xd7,
+            0xd1, 0xfe, 0xfd, 0x18, 0x7e, 0xe0, 0x9f, 0xd4,
+        },
+        .h1 = rfc6979_h1_2,
+        .h1len = sizeof(rfc6979_h1_2),
+        .k = {
+            0x07, 0x58, 0x75, 0x3a, 0x52, 0x54, 0x75, 0x9c,
+            0x7c, 0xfb, 0xad, 0x2e, 0x2d, 0x9b, 0x07, 0x92,
+            0xee, 0xe4, 0x41, 0x36, 0xc9, 0x48, 0x05, 0x27,
+        },
+    },
+    {
+        .name = "RFC 6979 A.2.7, P-521, SHA-256, 'sample'",
+        .sha512 = false,
+        .qlen = 521,
+        .q = {
+            0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xfa, 0x51, 0x86, 0x87, 0x83, 0xbf, 0x2f,
+            0x96, 0x6b, 0x7f, 0xcc, 0x01, 0x48, 0xf7, 0x09,
+            0xa5, 0xd0, 0x3b, 0xb5, 0xc9, 0xb8, 0x89, 0x9c,
+            0x47, 0xae, 0xbb, 0x6f, 0xb7, 0x1e, 0x91, 0x38,
+            0x64, 0x09,
+        },
+        .x = {
+            0x00, 0xfa, 0xd0, 0x6d, 0xaa, 0x62, 0xba, 0x3b,
+            0x25, 0xd2, 0xfb, 0x40, 0x13, 0x3d, 0xa7, 0x57,
+            0x20, 0x5d, 0xe6, 0x7f, 0x5b, 0xb0, 0x01, 0x8f,
+            0xee, 0x8c, 0x86, 0xe1, 0xb6, 0x8c, 0x7e, 0x75,
+            0xca, 0xa8, 0x96, 0xeb, 0x32, 0xf1, 0xf4, 0x7c,
+            0x70, 0x85, 0x58, 0x36, 0xa6, 0xd1, 0x6f, 0xcc,
+            0x14, 0x66, 0xf6, 0xd8, 0xfb, 0xec, 0x67, 0xdb,
+            0x89, 0xec, 0x0c, 0x08, 0xb0, 0xe9, 0x96, 0xb8,
+            0x35, 0x38,
+        },
+        .h1 = rfc6979_h1_3,
+        .h1len = sizeof(rfc6979_h1_3),
+        .k = {
+            0x00, 0xed, 0xf3, 0x8a, 0xfc, 0xaa, 0xec, 0xab,
+            0x43, 0x83, 0x35, 0x8b, 0x34, 0xd6, 0x7c, 0x9f,
+            0x22, 0x16, 0xc8, 0x38, 0x2a, 0xae, 0xa4, 0x4a,
+            0x3d, 0xad, 0x5f, 0xdc, 0x9c, 0x32, 0x57, 0x57,
+            0x61, 0x79, 0x3f, 0xef, 0x24, 0xeb, 0x0f, 0xc2,
+            0x76, 0xdf, 0xc4, 0xf6, 0xe3, 0xec, 0x47, 0x67,
+            0x52, 0xf0, 0x43, 0xcf, 0x01, 0x41, 0x53, 0x87,
+            0x47, 0x0b, 0xcb, 0xd8, 0x67, 0x8e, 0xd2, 0xc7,
+            0xe1, 0xa0,
+        },
+    },
+    {
+        .name = "RFC 6979 A.2.7, P-521, SHA-512, 'test'",
+        .sha512 = true,
+        .qlen = 521,
+        .q = {
+            0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xfa, 0x51, 0x86, 0x87, 0x83, 0xbf, 0x2f,
+            0x96, 0x6b, 0x7f, 0xcc, 0x01, 0x48, 0xf7, 0x09,
+            0xa5, 0xd0, 0x3b, 0xb5, 0xc9, 0xb8, 0x89, 0x9c,
+            0x47, 0xae, 0xbb, 0x6f, 0xb7, 0x1e, 0x91, 0x38,
+            0x64, 0x09,
+        },
+        .x = {
+            0x00, 0xfa, 0xd0, 0x6d, 0xaa, 0x62, 0xba, 0x3b,
+            0x25, 0xd2, 0xfb, 0x40, 0x13, 0x3d, 0xa7, 0x57,
+            0x20, 0x5d, 0xe6, 0x7f, 0x5b, 0xb0, 0x01, 0x8f,
+            0xee, 0x8c, 0x86, 0xe1, 0xb6, 0x8c, 0x7e, 0x75,
+            0xca, 0xa8, 0x96, 0xeb, 0x32, 0xf1, 0xf4, 0x7c,
+            0x70, 0x85, 0x58, 0x36, 0xa6, 0xd1, 0x6f, 0xcc,
+            0x14, 0x66, 0xf6, 0xd8, 0xfb, 0xec, 0x67, 0xdb,
+            0x89, 0xec, 0x0c, 0x08, 0xb0, 0xe9, 0x96, 0xb8,
+            0x35, 0x38,
+        },
+        .h1 = rfc6979_h1_4,
+        .h1len = sizeof(rfc6979_h1_4),
+        .k = {
+            0x01, 0x62, 0x00, 0x81, 0x30, 0x20, 0xec, 0x98,
+            0x68, 0x63, 0xbe, 0xdf, 0xc1, 0xb1, 0x21, 0xf6,
+            0x05, 0xc1, 0x21, 0x56, 0x45, 0x01, 0x8a, 0xea,
+            0x1a, 0x7b, 0x21, 0x5a, 0x56, 0x4d, 0xe9, 0xeb,
+            0x1b, 0x38, 0xa6, 0x7a, 0xa1, 0x12, 0x8b, 0x80,
+            0xce, 0x39, 0x1c, 0x4f, 0xb7, 0x11, 0x87, 0x65,
+            0x4a, 0xaa, 0x34, 0x31, 0x02, 0x7b, 0xfc, 0x7f,
+            0x39, 0x57, 0x66, 0xca, 0x98, 0x8c, 0x96, 0x4d,
+            0xc5, 0x6d,
+        },
+    },
+    {
+        .name = "secp256k1, SHA-256, 'Satoshi Nakamoto'",
+        .sha512 = false,
+        .qlen = 256,
+        .q = {
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+            0xba, 0xae, 0xdc, 0xe6, 0xaf, 0x48, 0xa0, 0x3b,
+            0xbf, 0xd2, 0x5e, 0x8c, 0xd0, 0x36, 0x41, 0x41,
+        },
+        .x = {
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+            0xba, 0xae, 0xdc, 0xe6, 0xaf, 0x48, 0xa0, 0x3b,
+            0xbf, 0xd2, 0x5e, 0x8c, 0xd0, 0x36, 0x41, 0x40,
+        },
+        .h1 = rfc6979_h1_5,
+        .h1len = sizeof(rfc6979_h1_5),
+        .k = {
+            0x33, 0xa1, 0x9b, 0x60, 0xe2, 0x5f, 0xb6, 0xf4,
+            0x43, 0x5a, 0xf5, 0x3a, 0x3d, 0x42, 0xd4, 0x93,
+            0x64, 0x48, 0x27, 0x36, 0x7e, 0x64, 0x53, 0x92,
+            0x85, 0x54, 0xf4, 0x3e, 0x49, 0xaa, 0x6f, 0x90,
+        },
+    },
+};
+
+#endif  // _HMAC_DRBG_TEST_VECTORS_
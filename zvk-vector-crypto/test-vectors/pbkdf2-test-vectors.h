@@ -0,0 +1,168 @@
+#ifndef _PBKDF2_TEST_VECTORS_
+#define _PBKDF2_TEST_VECTORS_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * The first two PBKDF2-HMAC-SHA-256 test vectors come from RFC 7914,
+ * section 11. The other expected outputs were computed with Python's
+ * hashlib.pbkdf2_hmac().
+ */
+
+static const uint8_t pbkdf2_dk0[] = {
+    0x55, 0xac, 0x04, 0x6e, 0x56, 0xe3, 0x08, 0x9f,
+    0xec, 0x16, 0x91, 0xc2, 0x25, 0x44, 0xb6, 0x05,
+    0xf9, 0x41, 0x85, 0x21, 0x6d, 0xde, 0x04, 0x65,
+    0xe6, 0x8b, 0x9d, 0x57, 0xc2, 0x0d, 0xac, 0xbc,
+    0x49, 0xca, 0x9c, 0xcc, 0xf1, 0x79, 0xb6, 0x45,
+    0x99, 0x16, 0x64, 0xb3, 0x9d, 0x77, 0xef, 0x31,
+    0x7c, 0x71, 0xb8, 0x45, 0xb1, 0xe3, 0x0b, 0xd5,
+    0x09, 0x11, 0x20, 0x41, 0xd3, 0xa1, 0x97, 0x83,
+};
+
+static const uint8_t pbkdf2_dk1[] = {
+    0x4d, 0xdc, 0xd8, 0xf6, 0x0b, 0x98, 0xbe, 0x21,
+    0x83, 0x0c, 0xee, 0x5e, 0xf2, 0x27, 0x01, 0xf9,
+    0x64, 0x1a, 0x44, 0x18, 0xd0, 0x4c, 0x04, 0x14,
+    0xae, 0xff, 0x08, 0x87, 0x6b, 0x34, 0xab, 0x56,
+    0xa1, 0xd4, 0x25, 0xa1, 0x22, 0x58, 0x33, 0x54,
+    0x9a, 0xdb, 0x84, 0x1b, 0x51, 0xc9, 0xb3, 0x17,
+    0x6a, 0x27, 0x2b, 0xde, 0xbb, 0xa1, 0xd0, 0x78,
+    0x47, 0x8f, 0x62, 0xb3, 0x97, 0xf3, 0x3c, 0x8d,
+};
+
+static const uint8_t pbkdf2_dk2[] = {
+    0xc5, 0xe4, 0x78, 0xd5, 0x92, 0x88, 0xc8, 0x41,
+    0xaa, 0x53, 0x0d, 0xb6, 0x84, 0x5c, 0x4c, 0x8d,
+    0x96, 0x28, 0x93, 0xa0, 0x01, 0xce, 0x4e, 0x11,
+    0xa4, 0x96, 0x38, 0x73, 0xaa, 0x98, 0x13, 0x4a,
+};
+
+static const uint8_t pbkdf2_dk3[] = {
+    0x5c, 0x59, 0x3c, 0xc0, 0xbc, 0x69, 0xc5, 0x1c,
+    0x20, 0xc7, 0xba, 0x57, 0xb2, 0x9d, 0x3f, 0x16,
+    0x1f, 0xc6, 0x4c, 0x12, 0xdb, 0x6f, 0x91, 0x8b,
+    0xe8, 0x28, 0x5f, 0xb6, 0xd8, 0x77, 0x12, 0x1e,
+    0xbd, 0x34, 0x7e, 0xd6, 0x88, 0x69, 0x6b, 0x04,
+};
+
+static const uint8_t pbkdf2_dk4[] = {
+    0xc7, 0x43, 0x19, 0xd9, 0x94, 0x99, 0xfc, 0x3e,
+    0x90, 0x13, 0xac, 0xff, 0x59, 0x7c, 0x23, 0xc5,
+    0xba, 0xf0, 0xa0, 0xbe, 0xc5, 0x63, 0x4c, 0x46,
+    0xb8, 0x35, 0x2b, 0x79, 0x3e, 0x32, 0x47, 0x23,
+    0xd5, 0x5c, 0xaa, 0x76, 0xb2, 0xb2, 0x5c, 0x43,
+    0x40, 0x2d, 0xcf, 0xdc, 0x06, 0xcd, 0xcf, 0x66,
+    0xf9, 0x5b, 0x7d, 0x04, 0x29, 0x42, 0x0b, 0x39,
+    0x52, 0x00, 0x06, 0x74, 0x9c, 0x51, 0xa0, 0x4e,
+};
+
+static const uint8_t pbkdf2_dk5[] = {
+    0x77, 0x08, 0x48, 0xfb, 0x6d, 0x2d, 0xa0, 0xab,
+    0x07, 0x56, 0x35, 0xd1, 0x63, 0xe4, 0x9e, 0x6c,
+    0x00, 0x0d, 0x52, 0x38, 0x14, 0x1c, 0xc7, 0x8e,
+    0x70, 0x75, 0x1e, 0x4d, 0xfd, 0x20, 0x0e, 0x55,
+    0xf5, 0xa8, 0xac, 0x24, 0x4e, 0xd1, 0x18, 0x13,
+    0x8d, 0xad, 0x44, 0x85, 0x51, 0x53, 0x51, 0x8a,
+    0x24, 0x69, 0x92, 0x57, 0x54, 0xb0, 0xa6, 0x9a,
+    0x4b, 0x82, 0x13, 0xde, 0xf1, 0x42, 0x40, 0x5c,
+    0xb2, 0x0d, 0x76, 0x72, 0x1c, 0xf7, 0xcf, 0x36,
+    0xc1, 0x7a, 0x49, 0x8e, 0x94, 0xa6, 0xdd, 0x7a,
+    0x7c, 0x18, 0x1d, 0x89, 0x88, 0xa3, 0x15, 0x05,
+    0xa0, 0xa4, 0x1e, 0x63, 0xbe, 0xd9, 0xc3, 0x64,
+    0xc7, 0x94, 0x77, 0x0c,
+};
+
+static const uint8_t pbkdf2_dk6[] = {
+    0x3c, 0x7c, 0x2e, 0x4d, 0x6f, 0x32, 0xdf, 0xa0,
+    0x1e, 0x40, 0x56, 0x4b, 0x08, 0x6e, 0xac, 0x22,
+    0x82, 0xa0, 0xad, 0x24, 0x49, 0x2d, 0xf2, 0xa0,
+    0x8e, 0x50, 0x39, 0x79, 0x5e, 0x02, 0x16, 0x2b,
+    0xc5, 0x3d, 0x9c, 0x9d, 0x16, 0x50, 0x3e, 0x54,
+    0x27, 0xf8, 0x0a, 0x38, 0x23, 0x8f, 0xf8, 0x41,
+    0x47, 0xe5, 0x4d, 0x84, 0x99, 0x4c, 0xcd, 0xcb,
+    0xb7, 0xa7, 0xc9, 0x18, 0x5d, 0x24, 0x82, 0xd7,
+};
+
+static const struct pbkdf2_test pbkdf2_tests[] = {
+    {
+        .name = "RFC 7914 PBKDF2-HMAC-SHA-256 #1",
+        .sha512 = false,
+        .password = (const uint8_t*)"passwd",
+        .passwordlen = 6,
+        .salt = (const uint8_t*)"salt",
+        .saltlen = 4,
+        .iterations = 1,
+        .dk = pbkdf2_dk0,
+        .dklen = sizeof(pbkdf2_dk0),
+    },
+    {
+        .name = "RFC 7914 PBKDF2-HMAC-SHA-256 #2",
+        .sha512 = false,
+        .password = (const uint8_t*)"Password",
+        .passwordlen = 8,
+        .salt = (const uint8_t*)"NaCl",
+        .saltlen = 4,
+        .iterations = 80000,
+        .dk = pbkdf2_dk1,
+        .dklen = sizeof(pbkdf2_dk1),
+    },
+    {
+        .name = "PBKDF2-HMAC-SHA-256 4096 iterations",
+        .sha512 = false,
+        .password = (const uint8_t*)"password",
+        .passwordlen = 8,
+        .salt = (const uint8_t*)"salt",
+        .saltlen = 4,
+        .iterations = 4096,
+        .dk = pbkdf2_dk2,
+        .dklen = sizeof(pbkdf2_dk2),
+    },
+    {
+        .name = "PBKDF2-HMAC-SHA-256 long password and salt",
+        .sha512 = false,
+        .password = (const uint8_t*)"passwordPASSWORDpasswordpasswordPASSWORDpasswordpasswordPASSWORDpassword",
+        .passwordlen = 72,
+        .salt = (const uint8_t*)"saltSALTsaltSALTsaltSALTsaltSALTsaltsaltSALTsaltSALTsaltSALTsaltSALTsalt",
+        .saltlen = 72,
+        .iterations = 100,
+        .dk = pbkdf2_dk3,
+        .dklen = sizeof(pbkdf2_dk3),
+    },
+    {
+        .name = "PBKDF2-HMAC-SHA-512 #1",
+        .sha512 = true,
+        .password = (const uint8_t*)"passwd",
+        .passwordlen = 6,
+        .salt = (const uint8_t*)"salt",
+        .saltlen = 4,
+        .iterations = 1,
+        .dk = pbkdf2_dk4,
+        .dklen = sizeof(pbkdf2_dk4),
+    },
+    {
+        .name = "PBKDF2-HMAC-SHA-512 #2",
+        .sha512 = true,
+        .password = (const uint8_t*)"Password",
+        .passwordlen = 8,
+        .salt = (const uint8_t*)"NaCl",
+        .saltlen = 4,
+        .iterations = 1000,
+        .dk = pbkdf2_dk5,
+        .dklen = sizeof(pbkdf2_dk5),
+    },
+    {
+        .name = "PBKDF2-HMAC-SHA-512 long password",
+        .sha512 = true,
+        .password = (const uint8_t*)"passwordPASSWORDpasswordpasswordPASSWORDpasswordpasswordPASSWORDpasswordpasswordPASSWORDpasswordpasswordPASSWORDpasswordpasswordPASSWORDpassword",
+        .passwordlen = 144,
+        .salt = (const uint8_t*)"salt",
+        .saltlen = 4,
+        .iterations = 50,
+        .dk = pbkdf2_dk6,
+        .dklen = sizeof(pbkdf2_dk6),
+    },
+};
+
+#endif  // _PBKDF2_TEST_VECTORS_
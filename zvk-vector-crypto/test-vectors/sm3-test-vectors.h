@@ -542,4 +542,240 @@ static struct sm3_test_vector sm3_test_vectors[] = {
 
 };
 
+/*
+ * Digest of a 10000 bytes message, with message[i] = (31 * i + 7) & 0xff,
+ * computed with Python's hashlib. Used to check the streaming API on a
+ * message larger than the fixed size padding buffer.
+ */
+#define SM3_LONG_MESSAGE_LEN 10000
+
+static const uint8_t sm3_long_digest[32] = {
+    0xca, 0xd5, 0x2f, 0xb2, 0x4a, 0x1f, 0xa6, 0x82,
+    0x93, 0xec, 0xd2, 0x9e, 0x34, 0x9a, 0x69, 0xcb,
+    0xf2, 0xcd, 0x28, 0xe7, 0x1f, 0x94, 0x6e, 0xb0,
+    0x8d, 0xf6, 0xa1, 0xdd, 0xca, 0xba, 0x2c, 0x49,
+};
+
+/*
+ * HMAC-SM3 of the inputs of the RFC 4231 test cases (test case 5, a
+ * truncated MAC, is left out). There are no official HMAC-SM3 vectors,
+ * the MACs were computed with Python's hmac and hashlib modules.
+ */
+static const uint8_t hmac_sm3_key1[20] = {
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+};
+static const uint8_t hmac_sm3_data1[] = "Hi There";
+
+static const uint8_t hmac_sm3_key2[] = "Jefe";
+static const uint8_t hmac_sm3_data2[] = "what do ya want for nothing?";
+
+static const uint8_t hmac_sm3_key3[20] = {
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+};
+static const uint8_t hmac_sm3_data3[50] = {
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd,
+};
+
+static const uint8_t hmac_sm3_key4[25] = {
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+    0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14,
+    0x15, 0x16, 0x17, 0x18, 0x19,
+};
+static const uint8_t hmac_sm3_data4[50] = {
+    0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd,
+    0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd,
+    0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd,
+    0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd,
+    0xcd, 0xcd,
+};
+
+static const uint8_t hmac_sm3_key5[131] = {
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+};
+static const uint8_t hmac_sm3_data5[] =
+    "Test Using Larger Than Block-Size Key - Hash Key First";
+static const uint8_t hmac_sm3_data6[] =
+    "This is a test using a larger than block-size key and a larger than "
+    "block-size data. The key needs to be hashed before being used by the "
+    "HMAC algorithm.";
+
+static const struct hmac_sm3_test hmac_sm3_tests[] = {
+    {
+        .name = "RFC 4231 test case 1 inputs",
+        .key = hmac_sm3_key1,
+        .keylen = sizeof(hmac_sm3_key1),
+        .data = hmac_sm3_data1,
+        .datalen = sizeof(hmac_sm3_data1) - 1,
+        .mac = {
+            0x51, 0xb0, 0x0d, 0x1f, 0xb4, 0x98, 0x32, 0xbf,
+            0xb0, 0x1c, 0x3c, 0xe2, 0x78, 0x48, 0xe5, 0x9f,
+            0x87, 0x1d, 0x9b, 0xa9, 0x38, 0xdc, 0x56, 0x3b,
+            0x33, 0x8c, 0xa9, 0x64, 0x75, 0x5c, 0xce, 0x70,
+        },
+    },
+    {
+        .name = "RFC 4231 test case 2 inputs",
+        .key = hmac_sm3_key2,
+        .keylen = sizeof(hmac_sm3_key2) - 1,
+        .data = hmac_sm3_data2,
+        .datalen = sizeof(hmac_sm3_data2) - 1,
+        .mac = {
+            0x2e, 0x87, 0xf1, 0xd1, 0x68, 0x62, 0xe6, 0xd9,
+            0x64, 0xb5, 0x0a, 0x52, 0x00, 0xbf, 0x2b, 0x10,
+            0xb7, 0x64, 0xfa, 0xa9, 0x68, 0x0a, 0x29, 0x6a,
+            0x24, 0x05, 0xf2, 0x4b, 0xec, 0x39, 0xf8, 0x82,
+        },
+    },
+    {
+        .name = "RFC 4231 test case 3 inputs",
+        .key = hmac_sm3_key3,
+        .keylen = sizeof(hmac_sm3_key3),
+        .data = hmac_sm3_data3,
+        .datalen = sizeof(hmac_sm3_data3),
+        .mac = {
+            0xdd, 0x94, 0x21, 0xe1, 0xc7, 0x25, 0xbd, 0xf5,
+            0x2e, 0xc1, 0xaa, 0x34, 0xed, 0xad, 0xb3, 0xc9,
+            0x7f, 0x59, 0x51, 0xa8, 0x3a, 0x2f, 0xa9, 0x3f,
+            0x73, 0xa7, 0x90, 0x2b, 0xc1, 0xdc, 0xc7, 0x77,
+        },
+    },
+    {
+        .name = "RFC 4231 test case 4 inputs",
+        .key = hmac_sm3_key4,
+        .keylen = sizeof(hmac_sm3_key4),
+        .data = hmac_sm3_data4,
+        .datalen = sizeof(hmac_sm3_data4),
+        .mac = {
+            0xb5, 0x7c, 0x79, 0xbe, 0x03, 0x47, 0x2a, 0xeb,
+            0x8c, 0xad, 0xa5, 0x81, 0xde, 0xa3, 0x32, 0xcb,
+            0x2b, 0xa8, 0x3d, 0x19, 0xcb, 0x1b, 0x05, 0x2d,
+            0xd0, 0x71, 0x94, 0xde, 0xf7, 0x5f, 0xb8, 0xcd,
+        },
+    },
+    {
+        .name = "RFC 4231 test case 6 inputs",
+        .key = hmac_sm3_key5,
+        .keylen = sizeof(hmac_sm3_key5),
+        .data = hmac_sm3_data5,
+        .datalen = sizeof(hmac_sm3_data5) - 1,
+        .mac = {
+            0xb4, 0xfd, 0x84, 0x4e, 0x13, 0x34, 0x20, 0x02,
+            0xf0, 0xb2, 0xe0, 0x69, 0x0e, 0xa7, 0x74, 0x1f,
+            0x14, 0x97, 0xd9, 0x93, 0xa7, 0x04, 0x94, 0xce,
+            0xa6, 0x01, 0xe6, 0x57, 0xbe, 0xdf, 0x67, 0xa0,
+        },
+    },
+    {
+        .name = "RFC 4231 test case 7 inputs",
+        .key = hmac_sm3_key5,
+        .keylen = sizeof(hmac_sm3_key5),
+        .data = hmac_sm3_data6,
+        .datalen = sizeof(hmac_sm3_data6) - 1,
+        .mac = {
+            0x5a, 0xcb, 0xde, 0xb0, 0xc8, 0xc1, 0xef, 0x3a,
+            0x99, 0x08, 0x8f, 0xe5, 0x1c, 0x0a, 0x1d, 0x5f,
+            0x4e, 0x1c, 0x17, 0x59, 0x35, 0xf0, 0x16, 0xae,
+            0xe7, 0x4e, 0xb8, 0x05, 0x6d, 0xb1, 0x8a, 0xcb,
+        },
+    },
+};
+
+/*
+ * SM2 KDF outputs, computed with a Python implementation of
+ * GB/T 32918.4-2016 5.4.3 on top of hashlib. The Z lengths cover a partial
+ * block, a full block and a block plus a partial block, the output lengths
+ * a partial digest and several multi-buffer batches.
+ */
+static const uint8_t sm2_kdf_out_19_19[19] = {
+    0xcf, 0x6e, 0x23, 0x87, 0xc8, 0xef, 0xab, 0x41,
+    0x69, 0x2b, 0x2a, 0x33, 0x14, 0x59, 0x46, 0x8c,
+    0xee, 0x11, 0x1f,
+};
+
+static const uint8_t sm2_kdf_out_64_300[300] = {
+    0x68, 0xc0, 0x10, 0x8a, 0x73, 0x81, 0x16, 0x41,
+    0xe9, 0x05, 0xbb, 0x89, 0xb5, 0x1d, 0xe9, 0x65,
+    0xc2, 0xcc, 0x66, 0xa7, 0xc2, 0x99, 0x3b, 0xc1,
+    0x68, 0x70, 0x9f, 0x50, 0xf7, 0x30, 0x3d, 0x3d,
+    0xa0, 0xa1, 0xd2, 0x35, 0xb3, 0xd3, 0xdc, 0x93,
+    0xe0, 0xa0, 0xad, 0xea, 0x5f, 0x9c, 0x20, 0x58,
+    0xe4, 0xcc, 0x04, 0xeb, 0x9a, 0x38, 0x49, 0xda,
+    0xc6, 0xf1, 0x56, 0x0f, 0x92, 0x35, 0x8f, 0xe8,
+    0x8f, 0xa3, 0xb6, 0x01, 0xd0, 0x3d, 0x76, 0x80,
+    0xde, 0x5c, 0xf2, 0x6f, 0xc4, 0x1e, 0xfd, 0xd0,
+    0xd5, 0x80, 0xc8, 0x21, 0x48, 0x30, 0x5b, 0x57,
+    0x26, 0x6b, 0x64, 0x1e, 0x5b, 0x69, 0xf8, 0x21,
+    0x82, 0x80, 0x81, 0x6a, 0x1e, 0x8e, 0xb2, 0xd7,
+    0x64, 0xe0, 0x05, 0x39, 0x2b, 0xf6, 0x15, 0xa2,
+    0xc5, 0x19, 0x12, 0x96, 0x8a, 0x59, 0x52, 0xcf,
+    0x82, 0x1c, 0xc9, 0x4b, 0x64, 0x07, 0xe0, 0x20,
+    0xc4, 0x23, 0x5e, 0xd6, 0xe9, 0xa2, 0x80, 0x44,
+    0x9e, 0x8f, 0x64, 0xca, 0x5c, 0x5f, 0x08, 0x5e,
+    0x11, 0x31, 0x00, 0x39, 0x82, 0x0e, 0x47, 0x30,
+    0x3c, 0x84, 0x6d, 0xf4, 0xe7, 0xa7, 0x2c, 0x63,
+    0x6c, 0xde, 0x0b, 0xa0, 0x04, 0xf5, 0x89, 0xf8,
+    0x1f, 0xe3, 0xa2, 0x7f, 0x4c, 0x68, 0x1f, 0x4c,
+    0x9d, 0x1b, 0xaa, 0x94, 0x4d, 0x88, 0x16, 0xc1,
+    0x6b, 0xf5, 0x8c, 0xfe, 0xa6, 0x56, 0x5b, 0x1d,
+    0xf8, 0x57, 0x71, 0xb0, 0xa5, 0xfb, 0xff, 0x3d,
+    0x83, 0x9f, 0xa6, 0x37, 0xbd, 0x8f, 0xf7, 0xc1,
+    0x58, 0xf7, 0x89, 0x5a, 0xa0, 0x8a, 0x82, 0xe2,
+    0x8e, 0x7c, 0xaa, 0x34, 0xbe, 0x6e, 0xb6, 0xfa,
+    0x0d, 0x98, 0xfe, 0xe9, 0x92, 0x15, 0x1c, 0xfa,
+    0x78, 0xc5, 0xa9, 0x91, 0xfe, 0xa1, 0xab, 0xa7,
+    0x58, 0xe1, 0x15, 0xfe, 0x42, 0x21, 0x1c, 0x19,
+    0x33, 0xe1, 0xe0, 0x24, 0xf7, 0x48, 0x9b, 0x0d,
+    0x39, 0x78, 0x3b, 0x31, 0xe3, 0x8c, 0x68, 0x3d,
+    0xc9, 0xa5, 0x9f, 0x65, 0xbb, 0x0e, 0x9a, 0x02,
+    0x14, 0x82, 0x04, 0x6b, 0xa9, 0x0b, 0xab, 0x3b,
+    0x9d, 0x07, 0x79, 0x3f, 0xa3, 0xc6, 0xe1, 0x78,
+    0xe8, 0x9a, 0x0b, 0x6c, 0x6b, 0x88, 0x68, 0x77,
+    0x23, 0xd5, 0xc9, 0x38,
+};
+
+static const uint8_t sm2_kdf_out_100_157[157] = {
+    0x81, 0xb8, 0x17, 0x62, 0x45, 0x23, 0xdb, 0xad,
+    0x93, 0xa8, 0x7e, 0x5d, 0x7e, 0x04, 0xb2, 0x83,
+    0xd7, 0x42, 0x24, 0x4f, 0x4b, 0x87, 0x1a, 0xd4,
+    0x19, 0xf0, 0xa8, 0x71, 0x39, 0x13, 0x39, 0x2a,
+    0x78, 0x9e, 0xcc, 0xd9, 0x19, 0xec, 0x92, 0xb4,
+    0x5b, 0x46, 0x25, 0x4a, 0xf9, 0xd2, 0x71, 0x32,
+    0x1c, 0x4e, 0xfa, 0xc3, 0x86, 0x03, 0x78, 0x8b,
+    0x6f, 0xa9, 0xd2, 0xce, 0xed, 0xa7, 0xac, 0xcd,
+    0xc0, 0xcd, 0xcc, 0xca, 0xd3, 0xf0, 0x90, 0x14,
+    0x93, 0x9b, 0x3a, 0x51, 0x19, 0x33, 0xdc, 0xbe,
+    0xbc, 0x5d, 0x91, 0xeb, 0xeb, 0x15, 0xbf, 0x0c,
+    0x45, 0x8a, 0xd3, 0x3b, 0xc2, 0x8c, 0x6b, 0x80,
+    0x22, 0xd2, 0xe1, 0x45, 0xe0, 0x81, 0x4c, 0x28,
+    0xaf, 0xd1, 0xef, 0x7c, 0xdc, 0x99, 0x82, 0xa6,
+    0xe5, 0xfd, 0xc4, 0x5f, 0xae, 0xda, 0x34, 0x3e,
+    0x99, 0x71, 0x6d, 0x79, 0x3d, 0x2d, 0x53, 0x1b,
+    0x71, 0xd7, 0xff, 0xe9, 0x81, 0xe7, 0x6c, 0xb5,
+    0x55, 0x22, 0xdc, 0xaf, 0x70, 0x95, 0x21, 0xc9,
+    0x9e, 0x8c, 0x59, 0xcb, 0x74, 0xf5, 0x24, 0xc2,
+    0xe7, 0x7c, 0x06, 0x92, 0xcd,
+};
+
+static const struct sm2_kdf_test sm2_kdf_tests[] = {
+    { 19, sm2_kdf_out_19_19, sizeof(sm2_kdf_out_19_19) },
+    { 64, sm2_kdf_out_64_300, sizeof(sm2_kdf_out_64_300) },
+    { 100, sm2_kdf_out_100_157, sizeof(sm2_kdf_out_100_157) },
+};
+
 #endif
@@ -0,0 +1,178 @@
+#ifndef _SM4_GCM_TEST_VECTORS_
+#define _SM4_GCM_TEST_VECTORS_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../sm4-test.h"
+
+/*
+ * Test vector 0 is the SM4-GCM example of RFC 8998, appendix A.1. The
+ * others were computed with a Python implementation of GCM over SM4, the
+ * same implementation reproducing the RFC 8998 example. Test vector 1
+ * uses a 20 bytes IV and a partial last block, test vector 2 has no text
+ * (GMAC).
+ */
+
+static const uint8_t sm4_gcm_key0[] = {
+    0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+    0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+};
+
+static const uint8_t sm4_gcm_iv0[] = {
+    0x00, 0x00, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00,
+    0x00, 0x00, 0xab, 0xcd,
+};
+
+static const uint8_t sm4_gcm_aad0[] = {
+    0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+    0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+    0xab, 0xad, 0xda, 0xd2,
+};
+
+static const uint8_t sm4_gcm_pt0[] = {
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+};
+
+static const uint8_t sm4_gcm_ct0[] = {
+    0x17, 0xf3, 0x99, 0xf0, 0x8c, 0x67, 0xd5, 0xee,
+    0x19, 0xd0, 0xdc, 0x99, 0x69, 0xc4, 0xbb, 0x7d,
+    0x5f, 0xd4, 0x6f, 0xd3, 0x75, 0x64, 0x89, 0x06,
+    0x91, 0x57, 0xb2, 0x82, 0xbb, 0x20, 0x07, 0x35,
+    0xd8, 0x27, 0x10, 0xca, 0x5c, 0x22, 0xf0, 0xcc,
+    0xfa, 0x7c, 0xbf, 0x93, 0xd4, 0x96, 0xac, 0x15,
+    0xa5, 0x68, 0x34, 0xcb, 0xcf, 0x98, 0xc3, 0x97,
+    0xb4, 0x02, 0x4a, 0x26, 0x91, 0x23, 0x3b, 0x8d,
+};
+
+static const uint8_t sm4_gcm_tag0[] = {
+    0x83, 0xde, 0x35, 0x41, 0xe4, 0xc2, 0xb5, 0x81,
+    0x77, 0xe0, 0x65, 0xa9, 0xbf, 0x7b, 0x62, 0xec,
+};
+
+static const uint8_t sm4_gcm_key1[] = {
+    0xfd, 0x0e, 0xa9, 0x1a, 0xbd, 0x70, 0x52, 0x89,
+    0x6c, 0xb6, 0xa4, 0x29, 0x65, 0x25, 0x99, 0x41,
+};
+
+static const uint8_t sm4_gcm_iv1[] = {
+    0xca, 0x5b, 0xa5, 0xff, 0x40, 0x44, 0x58, 0xbf,
+    0x81, 0x6c, 0x5e, 0x29, 0x9f, 0x7b, 0x4b, 0xe3,
+    0xa1, 0x37, 0x63, 0x15,
+};
+
+static const uint8_t sm4_gcm_aad1[] = {
+    0x81, 0xf4, 0xf5, 0x1e, 0x85, 0x7a, 0xe6, 0x51,
+    0x30, 0x45, 0xce, 0xa9, 0x7f, 0xaa, 0xc5, 0xd1,
+    0xb6, 0x00, 0x60, 0xff, 0x7b, 0x13, 0x5c, 0x54,
+    0xf8, 0x43, 0x28, 0xdb, 0xbb, 0x19, 0x58, 0xd3,
+    0x32, 0x8f, 0x60, 0x3e, 0x3e,
+};
+
+static const uint8_t sm4_gcm_pt1[] = {
+    0xfa, 0xc5, 0xee, 0x9c, 0x33, 0xbf, 0xb6, 0x3d,
+    0x5f, 0x95, 0x88, 0xec, 0x02, 0xf5, 0x6d, 0x11,
+    0x84, 0xc1, 0x56, 0x57, 0x1d, 0x64, 0xe6, 0xe0,
+    0xac, 0xf0, 0xbd, 0xcc, 0x2c, 0x33, 0x3e, 0xc2,
+    0x9b, 0x40, 0x5b, 0xe2, 0x6a, 0x84, 0x38, 0xc7,
+    0xf2, 0xd4, 0x58, 0x61, 0x64, 0xa9, 0xfa, 0xee,
+    0x11, 0xfe, 0x77, 0x2a, 0x32, 0x29, 0x80, 0xb7,
+    0x46, 0x40, 0x17, 0x5e, 0xf5, 0x8c, 0x0e, 0x8d,
+    0xab, 0xbc, 0x54, 0x49, 0x13, 0x8f, 0x39, 0x75,
+    0xcc, 0xa7, 0x13, 0x54, 0x95,
+};
+
+static const uint8_t sm4_gcm_ct1[] = {
+    0x58, 0x94, 0xa4, 0x89, 0xc6, 0x3c, 0xce, 0x63,
+    0x89, 0x5f, 0x67, 0x57, 0xfc, 0xc7, 0x1b, 0x64,
+    0x2b, 0x45, 0xac, 0x85, 0x58, 0xb9, 0x29, 0x38,
+    0x9e, 0x28, 0xfe, 0x0d, 0x39, 0x6b, 0x49, 0x21,
+    0xe4, 0x65, 0xe4, 0xcd, 0x2d, 0xc9, 0x96, 0xc0,
+    0x15, 0x8f, 0x3d, 0x8a, 0xd3, 0x75, 0xd1, 0xb8,
+    0x74, 0x9b, 0xe4, 0xd6, 0x74, 0xab, 0x01, 0xe2,
+    0x2e, 0xa8, 0x87, 0xef, 0x61, 0x11, 0x61, 0xae,
+    0xee, 0x93, 0xe9, 0x1f, 0x6b, 0xa5, 0x17, 0xc5,
+    0x7c, 0x0b, 0x46, 0xbd, 0xd0,
+};
+
+static const uint8_t sm4_gcm_tag1[] = {
+    0xc0, 0x4f, 0x22, 0x74, 0x27, 0xe6, 0xc1, 0xc8,
+    0x06, 0x46, 0xe3, 0x7a, 0x98, 0x36, 0x93, 0x4b,
+};
+
+static const uint8_t sm4_gcm_key2[] = {
+    0x7e, 0x2c, 0xe5, 0x75, 0x5e, 0x3a, 0xef, 0xcf,
+    0x43, 0x44, 0x4c, 0x39, 0x5e, 0xa6, 0xdb, 0xd9,
+};
+
+static const uint8_t sm4_gcm_iv2[] = {
+    0x23, 0x9b, 0x83, 0x3c, 0x2c, 0x5b, 0xc2, 0x6f,
+    0x79, 0xe4, 0x12, 0xcf,
+};
+
+static const uint8_t sm4_gcm_aad2[] = {
+    0xef, 0x6c, 0x4e, 0xd2, 0xc4, 0xe5, 0x2a, 0xdf,
+    0xa7, 0xff, 0x6e, 0x32, 0xa8, 0x26, 0xf8, 0xe6,
+    0x3f, 0xd5, 0xba, 0x1b,
+};
+
+static const uint8_t sm4_gcm_tag2[] = {
+    0x3c, 0x9a, 0x20, 0x07, 0x4a, 0xe0, 0x1e, 0x8c,
+    0x59, 0x7e, 0x38, 0x12, 0xf3, 0xfb, 0x55, 0x88,
+};
+
+static const struct sm4_gcm_test sm4_gcm_tests[] = {
+    {
+        .key = sm4_gcm_key0,
+        .iv = sm4_gcm_iv0,
+        .ivlen = sizeof(sm4_gcm_iv0),
+        .aad = sm4_gcm_aad0,
+        .aadlen = sizeof(sm4_gcm_aad0),
+        .pt = sm4_gcm_pt0,
+        .ct = sm4_gcm_ct0,
+        .len = sizeof(sm4_gcm_pt0),
+        .tag = sm4_gcm_tag0,
+    },
+    {
+        .key = sm4_gcm_key1,
+        .iv = sm4_gcm_iv1,
+        .ivlen = sizeof(sm4_gcm_iv1),
+        .aad = sm4_gcm_aad1,
+        .aadlen = sizeof(sm4_gcm_aad1),
+        .pt = sm4_gcm_pt1,
+        .ct = sm4_gcm_ct1,
+        .len = sizeof(sm4_gcm_pt1),
+        .tag = sm4_gcm_tag1,
+    },
+    {
+        .key = sm4_gcm_key2,
+        .iv = sm4_gcm_iv2,
+        .ivlen = sizeof(sm4_gcm_iv2),
+        .aad = sm4_gcm_aad2,
+        .aadlen = sizeof(sm4_gcm_aad2),
+        .pt = NULL,
+        .ct = NULL,
+        .len = 0,
+        .tag = sm4_gcm_tag2,
+    },
+};
+
+/*
+ * Tag of a 5000 bytes message spanning several chunks, with
+ *   key[i] = i, iv[i] = 0x10 + i (12 bytes),
+ *   aad[i] = (13 * i + 1) mod 256 (100 bytes),
+ *   pt[i] = (31 * i + 7) mod 256.
+ */
+static const uint8_t sm4_gcm_long_tag[] = {
+    0x09, 0xa9, 0xd3, 0xa2, 0x73, 0x25, 0x22, 0x16,
+    0x33, 0x74, 0x3f, 0x0c, 0xa9, 0xeb, 0xee, 0x4a,
+};
+
+#endif  // _SM4_GCM_TEST_VECTORS_
@@ -66,4 +66,195 @@ static struct sm4_test_suite sm4_suites[] = {
     }
 };
 
+/*
+ * SM4-CBC and SM4-CFB examples of the SM4 IETF draft (section A.2), and
+ * longer messages computed with a Python implementation of both modes,
+ * the same implementation reproducing those examples.
+ */
+
+static const uint8_t sm4_mode_key1[] = {
+    0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+    0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+};
+
+static const uint8_t sm4_mode_key2[] = {
+    0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+    0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+};
+
+static const uint8_t sm4_mode_iv[] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+};
+
+static const uint8_t sm4_mode_pt[] = {
+    0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb,
+};
+
+static const uint8_t sm4_cbc_ct1[] = {
+    0x78, 0xeb, 0xb1, 0x1c, 0xc4, 0x0b, 0x0a, 0x48,
+    0x31, 0x2a, 0xae, 0xb2, 0x04, 0x02, 0x44, 0xcb,
+    0x4c, 0xb7, 0x01, 0x69, 0x51, 0x90, 0x92, 0x26,
+    0x97, 0x9b, 0x0d, 0x15, 0xdc, 0x6a, 0x8f, 0x6d,
+};
+
+static const uint8_t sm4_cbc_ct2[] = {
+    0x0d, 0x3a, 0x6d, 0xdc, 0x2d, 0x21, 0xc6, 0x98,
+    0x85, 0x72, 0x15, 0x58, 0x7b, 0x7b, 0xb5, 0x9a,
+    0x91, 0xf2, 0xc1, 0x47, 0x91, 0x1a, 0x41, 0x44,
+    0x66, 0x5e, 0x1f, 0xa1, 0xd4, 0x0b, 0xae, 0x38,
+};
+
+static const uint8_t sm4_cfb_ct1[] = {
+    0xac, 0x32, 0x36, 0xcb, 0x86, 0x1d, 0xd3, 0x16,
+    0xe6, 0x41, 0x3b, 0x4e, 0x3c, 0x75, 0x24, 0xb7,
+    0x69, 0xd4, 0xc5, 0x4e, 0xd4, 0x33, 0xb9, 0xa0,
+    0x34, 0x60, 0x09, 0xbe, 0xb3, 0x7b, 0x2b, 0x3f,
+};
+
+static const uint8_t sm4_cfb_ct2[] = {
+    0x5d, 0xcc, 0xcd, 0x25, 0xa8, 0x4b, 0xa1, 0x65,
+    0x60, 0xd7, 0xf2, 0x65, 0x88, 0x70, 0x68, 0x49,
+    0x0d, 0x9b, 0x86, 0xff, 0x20, 0xc3, 0xbf, 0xe1,
+    0x15, 0xff, 0xa0, 0x2c, 0xa6, 0x19, 0x2c, 0xc5,
+};
+
+static const struct sm4_chain_test sm4_chain_tests[] = {
+    {
+        .key = sm4_mode_key1,
+        .iv = sm4_mode_iv,
+        .pt = sm4_mode_pt,
+        .ct = sm4_cbc_ct1,
+        .len = sizeof(sm4_mode_pt),
+        .cfb = false,
+    },
+    {
+        .key = sm4_mode_key2,
+        .iv = sm4_mode_iv,
+        .pt = sm4_mode_pt,
+        .ct = sm4_cbc_ct2,
+        .len = sizeof(sm4_mode_pt),
+        .cfb = false,
+    },
+    {
+        .key = sm4_mode_key1,
+        .iv = sm4_mode_iv,
+        .pt = sm4_mode_pt,
+        .ct = sm4_cfb_ct1,
+        .len = sizeof(sm4_mode_pt),
+        .cfb = true,
+    },
+    {
+        .key = sm4_mode_key2,
+        .iv = sm4_mode_iv,
+        .pt = sm4_mode_pt,
+        .ct = sm4_cfb_ct2,
+        .len = sizeof(sm4_mode_pt),
+        .cfb = true,
+    },
+};
+
+// 368 bytes (23 blocks) messages, with key[i] = 0x40 + i,
+// iv[i] = 0xf0 - i and pt[i] = (5 * i + 1) & 0xff.
+static const uint8_t sm4_cbc_long_ct[] = {
+    0xfc, 0x09, 0x34, 0x38, 0xc1, 0xb3, 0x99, 0x31,
+    0x55, 0xe5, 0x13, 0x9d, 0x72, 0x4e, 0xde, 0x9d,
+    0x91, 0x4a, 0x5f, 0x2f, 0x43, 0xe4, 0x91, 0x5d,
+    0x6e, 0xf0, 0xa1, 0x5b, 0x14, 0xc8, 0x7b, 0x86,
+    0xfd, 0xe8, 0x8d, 0x50, 0x9d, 0x41, 0x3c, 0xdc,
+    0x23, 0x31, 0xfe, 0xb3, 0x7d, 0x3f, 0x68, 0xac,
+    0x76, 0xa1, 0xc1, 0x87, 0x4b, 0x4e, 0x80, 0x93,
+    0x37, 0x8a, 0x0b, 0x12, 0x56, 0x53, 0x8c, 0xd1,
+    0xf4, 0x70, 0x91, 0x92, 0xf2, 0x49, 0xe6, 0x94,
+    0x9e, 0xc7, 0xa4, 0xf9, 0xc1, 0x75, 0xa6, 0xb4,
+    0x2d, 0x16, 0xeb, 0xca, 0xa5, 0x0e, 0x80, 0x5b,
+    0xba, 0xaf, 0x74, 0x40, 0xe5, 0x4b, 0xa4, 0xb7,
+    0x0d, 0x34, 0x0f, 0x39, 0x8a, 0x99, 0x81, 0xaa,
+    0x1a, 0xac, 0x1d, 0xcd, 0xfc, 0x6a, 0x5c, 0x1f,
+    0x78, 0x90, 0x42, 0xc3, 0xe0, 0x5a, 0x38, 0x65,
+    0x37, 0x7f, 0xf8, 0x65, 0xff, 0xa6, 0x34, 0xe0,
+    0x9d, 0x92, 0x36, 0xf9, 0x96, 0x5b, 0x6b, 0x7a,
+    0x6c, 0xf1, 0xb5, 0x0a, 0x4c, 0xbf, 0x94, 0x94,
+    0xaa, 0x26, 0xe9, 0xfa, 0x1f, 0x63, 0x11, 0xa0,
+    0xe8, 0x4f, 0xe1, 0x59, 0xf3, 0x43, 0x7d, 0x7d,
+    0xfa, 0x32, 0x34, 0x7c, 0x65, 0x18, 0x8c, 0x79,
+    0x69, 0x39, 0x0a, 0xaa, 0x62, 0x8b, 0x2e, 0x88,
+    0x85, 0xe9, 0x6b, 0x43, 0x4f, 0x9f, 0xea, 0xb2,
+    0xfb, 0x12, 0x64, 0x93, 0x73, 0xb9, 0xaf, 0xa7,
+    0x1f, 0xaa, 0x32, 0xf9, 0x5f, 0xd1, 0x28, 0x07,
+    0xf5, 0x1d, 0x44, 0x38, 0x60, 0xd7, 0x3e, 0xdf,
+    0x43, 0x66, 0x71, 0xb9, 0x00, 0xeb, 0x79, 0x28,
+    0xf1, 0x85, 0x5c, 0xea, 0x33, 0x36, 0xd0, 0x41,
+    0x96, 0x41, 0x82, 0x5e, 0x19, 0xa0, 0xde, 0xa5,
+    0xca, 0xfb, 0x3f, 0xd6, 0x96, 0x87, 0xaa, 0x46,
+    0x7c, 0x2b, 0x1f, 0x1b, 0xd7, 0xdc, 0x86, 0x14,
+    0xaf, 0xaf, 0xa8, 0x38, 0x3a, 0xeb, 0xdd, 0xd9,
+    0xe4, 0x56, 0x41, 0xd1, 0x59, 0x19, 0x24, 0x89,
+    0xd4, 0xfc, 0x10, 0x0b, 0x8e, 0x3f, 0x17, 0x5d,
+    0xb4, 0x20, 0x51, 0x8e, 0x57, 0xcc, 0xa6, 0x78,
+    0xd5, 0x44, 0x4d, 0x3d, 0x0d, 0xdb, 0xc6, 0x86,
+    0xa0, 0xb2, 0x8a, 0x83, 0x4f, 0xd9, 0xf9, 0xdc,
+    0xa4, 0x43, 0xbd, 0x44, 0x59, 0x0f, 0xa8, 0x9b,
+    0xc1, 0x61, 0xde, 0xef, 0x28, 0x9c, 0x63, 0xbe,
+    0x2a, 0xa6, 0x1f, 0xed, 0xad, 0xce, 0x29, 0x3a,
+    0x03, 0x28, 0x86, 0xca, 0x65, 0x0a, 0x04, 0xbb,
+    0x8a, 0x83, 0x4c, 0x0a, 0xd9, 0xff, 0xa1, 0x6c,
+    0xcd, 0x19, 0xc2, 0x86, 0xb6, 0x4a, 0xee, 0x4f,
+    0xb4, 0x7f, 0x1e, 0x06, 0x51, 0xbe, 0xfe, 0x04,
+    0xa5, 0x6f, 0x37, 0x96, 0x30, 0x1b, 0xd6, 0x6b,
+    0x9a, 0x8a, 0x8b, 0xa9, 0xc0, 0xd0, 0x79, 0x21,
+};
+
+static const uint8_t sm4_cfb_long_ct[] = {
+    0xf2, 0xe5, 0xfa, 0xe6, 0x58, 0x3a, 0xbd, 0x90,
+    0x52, 0xa0, 0xec, 0x9e, 0x8b, 0x7c, 0x3b, 0xc2,
+    0x17, 0xbc, 0x38, 0x06, 0x1d, 0xdd, 0x60, 0xa9,
+    0xe3, 0xc2, 0xb5, 0x21, 0x02, 0xc2, 0x42, 0xe3,
+    0x5f, 0xb5, 0xe2, 0x47, 0xc5, 0x19, 0xae, 0xbf,
+    0x66, 0xf7, 0x73, 0xba, 0x2f, 0xfa, 0x64, 0x5b,
+    0xc0, 0x4f, 0xb5, 0x57, 0xb8, 0x5f, 0xf1, 0xd6,
+    0x2e, 0x3f, 0xcc, 0xa5, 0xed, 0x16, 0x13, 0x52,
+    0x80, 0xa6, 0x47, 0x1a, 0x3c, 0x60, 0xfe, 0x13,
+    0x92, 0x1f, 0x4b, 0x77, 0xe6, 0x58, 0xa0, 0x6d,
+    0xda, 0xbd, 0x64, 0xf1, 0x3c, 0x61, 0xc0, 0xc4,
+    0x58, 0x5a, 0x99, 0x95, 0xf6, 0xe7, 0x71, 0xe9,
+    0xf0, 0xfa, 0x63, 0xa4, 0xf2, 0xc5, 0x96, 0x54,
+    0x88, 0xbb, 0x49, 0xcb, 0x11, 0x8f, 0x57, 0xff,
+    0x96, 0x94, 0x97, 0xfc, 0xa3, 0x62, 0xcc, 0xce,
+    0x30, 0xd7, 0xd4, 0xac, 0x8f, 0xc1, 0x87, 0xfd,
+    0x0c, 0x23, 0xe7, 0xf8, 0x89, 0x5a, 0xa0, 0xcf,
+    0xdb, 0xf6, 0x4d, 0x50, 0x2b, 0xe8, 0xa9, 0xde,
+    0xc5, 0xa2, 0x39, 0xe1, 0xa6, 0xfe, 0x2d, 0xa8,
+    0x4a, 0x31, 0x5b, 0xf0, 0x4d, 0xdc, 0x3c, 0x15,
+    0xfc, 0xe1, 0xf0, 0x35, 0x71, 0x69, 0xcf, 0x5e,
+    0xef, 0x8d, 0xf0, 0x0b, 0x4c, 0x3b, 0xa0, 0x9f,
+    0xbc, 0xee, 0x67, 0xff, 0xbe, 0xad, 0x2f, 0x2f,
+    0x63, 0x39, 0x36, 0xbb, 0x57, 0xe2, 0xe1, 0x36,
+    0x81, 0x1f, 0x97, 0xb6, 0x09, 0x73, 0xb7, 0x55,
+    0xa9, 0xac, 0xc6, 0x6c, 0x07, 0x1e, 0x54, 0x37,
+    0x52, 0x9b, 0x1b, 0x1a, 0xf5, 0xb1, 0x7a, 0xbd,
+    0x7f, 0x0a, 0xaa, 0x52, 0x99, 0xc1, 0x3c, 0x32,
+    0xa3, 0x0f, 0xb9, 0x3d, 0xbe, 0x62, 0x32, 0x78,
+    0xc7, 0xa6, 0x94, 0x0c, 0x01, 0x02, 0x7b, 0xcb,
+    0x6a, 0x1a, 0x19, 0x9c, 0x18, 0x41, 0x8a, 0xf7,
+    0x28, 0xfc, 0x7b, 0x2f, 0xd6, 0x08, 0x2f, 0x34,
+    0x84, 0x0e, 0x49, 0x21, 0xcb, 0x01, 0x90, 0x3d,
+    0x67, 0xec, 0xb6, 0x8e, 0x75, 0xbb, 0x5f, 0xd9,
+    0x6a, 0x9f, 0x4d, 0x2b, 0x38, 0x64, 0x61, 0xf9,
+    0x7e, 0x64, 0x6f, 0x36, 0x17, 0x24, 0xe1, 0x43,
+    0x6a, 0x21, 0x91, 0xd7, 0x8b, 0xca, 0xa4, 0xf0,
+    0xcd, 0xea, 0x74, 0x6f, 0x5c, 0x27, 0xd7, 0x7d,
+    0x6c, 0x78, 0x02, 0xd8, 0xf9, 0x02, 0xe0, 0x0a,
+    0x39, 0x54, 0x10, 0xdc, 0xfc, 0x58, 0x2c, 0x76,
+    0x64, 0x62, 0x49, 0x8c, 0x95, 0x8e, 0x72, 0xba,
+    0xb3, 0xcf, 0xbe, 0x48, 0xd9, 0xde, 0x3a, 0x86,
+    0x8b, 0x77, 0xf8, 0xb2, 0x77, 0x7c, 0x4c, 0x1c,
+    0x57, 0xeb, 0xd4, 0x05, 0x7f, 0xbd, 0x38, 0xa9,
+    0x12, 0xc4, 0x74, 0x4b, 0xc2, 0xce, 0x5b, 0xd9,
+    0x32, 0xed, 0x0e, 0x6a, 0x50, 0x02, 0x9a, 0x11,
+};
+
 #endif
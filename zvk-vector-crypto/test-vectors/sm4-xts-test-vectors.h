@@ -0,0 +1,163 @@
+#ifndef _SM4_XTS_TEST_VECTORS_
+#define _SM4_XTS_TEST_VECTORS_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../sm4-test.h"
+
+/*
+ * The GB/T 17964 cipher text of test vector 0 is the SM4-XTS example of
+ * the OpenSSL test suite, which covers ciphertext stealing. The other
+ * cipher texts were computed with a Python implementation of XTS over
+ * SM4, the same implementation reproducing that example.
+ */
+
+static const uint8_t sm4_xts_key0[] = {
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+    0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+};
+
+static const uint8_t sm4_xts_iv0[] = {
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff,
+};
+
+static const uint8_t sm4_xts_pt0[] = {
+    0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96,
+    0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+    0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+    0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+    0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11,
+    0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+    0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17,
+};
+
+static const uint8_t sm4_xts_ct0_gb[] = {
+    0xe9, 0x53, 0x82, 0x51, 0xc7, 0x1d, 0x7b, 0x80,
+    0xbb, 0xe4, 0x48, 0x3f, 0xef, 0x49, 0x7b, 0xd1,
+    0x2c, 0x5c, 0x58, 0x1b, 0xd6, 0x24, 0x2f, 0xc5,
+    0x1e, 0x08, 0x96, 0x4f, 0xb4, 0xf6, 0x0f, 0xdb,
+    0x0b, 0xa4, 0x2f, 0x63, 0x49, 0x92, 0x79, 0x21,
+    0x3d, 0x31, 0x8d, 0x2c, 0x11, 0xf6, 0x88, 0x6e,
+    0x90, 0x3b, 0xe7, 0xf9, 0x3a, 0x1b, 0x34, 0x79,
+};
+
+static const uint8_t sm4_xts_ct0_ieee[] = {
+    0xe9, 0x53, 0x82, 0x51, 0xc7, 0x1d, 0x7b, 0x80,
+    0xbb, 0xe4, 0x48, 0x3f, 0xef, 0x49, 0x7b, 0xd1,
+    0xb3, 0xdb, 0x1a, 0x3e, 0x60, 0x40, 0x8c, 0x57,
+    0x5d, 0x63, 0xff, 0x7d, 0xb3, 0x9f, 0x83, 0x26,
+    0x08, 0x69, 0xf9, 0xe2, 0x58, 0x5f, 0xec, 0x9f,
+    0x0b, 0x86, 0x3b, 0xf8, 0xfd, 0x78, 0x4b, 0x86,
+    0x27, 0xd1, 0x6c, 0x0d, 0xb6, 0xd2, 0xcf, 0xc7,
+};
+
+/*
+ * Cipher texts of a 300 bytes (IEEE 1619) and a 277 bytes (GB/T 17964)
+ * data unit, spanning several register groups, with
+ *   key[i] = 0x20 + i (32 bytes), iv[i] = 15 - i,
+ *   pt[i] = (7 * i + 3) mod 256.
+ */
+static const uint8_t sm4_xts_long_ct_ieee[] = {
+    0x42, 0x39, 0xda, 0xc4, 0xd8, 0x2f, 0x7a, 0x78,
+    0xa7, 0xf6, 0xb4, 0xcb, 0x17, 0x5c, 0x50, 0x8a,
+    0xd3, 0x40, 0x21, 0xf0, 0xa8, 0x49, 0xc7, 0xa4,
+    0xeb, 0x75, 0x11, 0xd2, 0x68, 0x6b, 0x61, 0xd2,
+    0x0b, 0x29, 0x34, 0x4a, 0x0c, 0xa4, 0x9b, 0xc5,
+    0x0c, 0x42, 0x0c, 0xfd, 0x16, 0x14, 0xd6, 0xd6,
+    0xe4, 0x80, 0x70, 0xfb, 0x8b, 0x1d, 0x4f, 0x74,
+    0xe9, 0xac, 0x29, 0xb9, 0x6c, 0x29, 0xbf, 0x7c,
+    0xa4, 0xd6, 0xfd, 0xda, 0x8f, 0x61, 0xcb, 0x21,
+    0xbd, 0xc7, 0x9f, 0xf2, 0xcc, 0x16, 0x2f, 0x06,
+    0x10, 0x2f, 0xfe, 0xad, 0x04, 0xca, 0x20, 0xfa,
+    0x91, 0x74, 0x1f, 0x5d, 0xce, 0x0c, 0x4b, 0xe9,
+    0x24, 0x7b, 0xc3, 0x39, 0x22, 0x6e, 0xd4, 0x4d,
+    0x0c, 0xbc, 0x03, 0x2d, 0xd5, 0x39, 0xfd, 0xe3,
+    0x10, 0xc3, 0x94, 0x36, 0x7a, 0x71, 0x7b, 0x9f,
+    0x6d, 0x39, 0xda, 0x0a, 0xec, 0xe2, 0x7a, 0x05,
+    0xf1, 0xd4, 0x0f, 0xc9, 0x7e, 0x91, 0x51, 0x48,
+    0xf6, 0x38, 0x55, 0xdb, 0xc2, 0xc6, 0xd6, 0xd6,
+    0xf8, 0xcd, 0xe2, 0x55, 0x48, 0x4a, 0x17, 0x79,
+    0xdf, 0x3a, 0x6e, 0x86, 0x3b, 0x12, 0x05, 0xa8,
+    0x25, 0x6d, 0x44, 0x59, 0x03, 0xf8, 0x14, 0xcd,
+    0xbc, 0x59, 0x3b, 0xec, 0xff, 0xf3, 0xd2, 0x9c,
+    0x05, 0x73, 0xcf, 0x6e, 0x9c, 0x7f, 0x71, 0x41,
+    0xbb, 0xaa, 0x48, 0x31, 0x3d, 0x36, 0xdf, 0xe1,
+    0x35, 0x04, 0xb1, 0x99, 0x33, 0xad, 0x3d, 0xdb,
+    0xcc, 0xd0, 0xeb, 0x30, 0x60, 0xf0, 0xf8, 0x60,
+    0x95, 0xb0, 0xf9, 0xc2, 0x3a, 0x7a, 0x46, 0x3e,
+    0xd2, 0x64, 0x0e, 0x16, 0x83, 0xdc, 0xa0, 0x63,
+    0xa1, 0xcf, 0xda, 0xe8, 0xea, 0x2a, 0xb1, 0x52,
+    0x3c, 0x1a, 0x07, 0xf7, 0xde, 0x67, 0x4d, 0x35,
+    0x39, 0x3f, 0x7b, 0xc4, 0xdf, 0xb9, 0xec, 0xd8,
+    0x2f, 0x4b, 0xd7, 0x4a, 0xef, 0x68, 0xd7, 0x25,
+    0x98, 0xca, 0x03, 0x13, 0xcf, 0x01, 0xc8, 0xfe,
+    0x6a, 0x28, 0x94, 0x27, 0xf1, 0x52, 0xe2, 0x97,
+    0x51, 0x8f, 0x60, 0xb9, 0xd4, 0xc4, 0x54, 0xe2,
+    0x6a, 0xe5, 0xde, 0xd3, 0x0c, 0x1b, 0x96, 0xac,
+    0x2d, 0x1c, 0x5f, 0x68, 0x9e, 0x6b, 0x9a, 0x0d,
+    0xa8, 0xc8, 0x84, 0x2e,
+};
+
+static const uint8_t sm4_xts_long_ct_gb[] = {
+    0x42, 0x39, 0xda, 0xc4, 0xd8, 0x2f, 0x7a, 0x78,
+    0xa7, 0xf6, 0xb4, 0xcb, 0x17, 0x5c, 0x50, 0x8a,
+    0x97, 0xbd, 0xe5, 0x08, 0x74, 0x09, 0xca, 0x7f,
+    0x86, 0x42, 0x96, 0x2e, 0x33, 0x61, 0xf2, 0x11,
+    0x9d, 0x2f, 0x03, 0xf8, 0xe6, 0x71, 0xad, 0x77,
+    0x8d, 0x9e, 0x2e, 0x9a, 0x14, 0xb9, 0xe9, 0x0d,
+    0xfd, 0x55, 0x30, 0x90, 0x9b, 0x87, 0xd3, 0xe3,
+    0x3d, 0x69, 0x1f, 0x37, 0x76, 0x37, 0x15, 0x00,
+    0xad, 0x23, 0xd4, 0x08, 0xe3, 0x11, 0x15, 0xfd,
+    0x93, 0x04, 0xbd, 0x1a, 0xa9, 0x04, 0x0a, 0x13,
+    0x2a, 0xfe, 0x73, 0xef, 0x0e, 0xbe, 0x83, 0xab,
+    0x04, 0xb4, 0x77, 0x33, 0x15, 0xf9, 0x17, 0x86,
+    0xa0, 0x31, 0xf1, 0x0a, 0x9c, 0xfc, 0xc9, 0x84,
+    0x3c, 0xfa, 0x5b, 0x06, 0x37, 0x66, 0xdd, 0xb4,
+    0x75, 0xa9, 0x05, 0xdd, 0xab, 0xc2, 0xa4, 0x28,
+    0x70, 0x93, 0xef, 0x50, 0xb5, 0x1f, 0x3d, 0x3a,
+    0x2e, 0x12, 0x71, 0x48, 0xa7, 0x50, 0x2c, 0xee,
+    0x56, 0xa5, 0x82, 0x9b, 0x71, 0x78, 0x42, 0x22,
+    0xa5, 0x73, 0xed, 0xcf, 0xd5, 0x8e, 0x0d, 0x29,
+    0x02, 0x1a, 0x1c, 0x8a, 0x1b, 0x5b, 0x77, 0x63,
+    0x78, 0x5b, 0x3f, 0xec, 0x4f, 0xb7, 0x20, 0xdf,
+    0x54, 0x6a, 0x38, 0xb1, 0xc4, 0xb6, 0x3a, 0x02,
+    0x1c, 0xfe, 0x19, 0xca, 0x3a, 0x4a, 0xa6, 0x86,
+    0xfc, 0xa0, 0x6e, 0xe3, 0xf6, 0x3f, 0x4a, 0xe1,
+    0xac, 0x71, 0xf0, 0xe1, 0xfe, 0xae, 0xbd, 0x3a,
+    0x4f, 0xb8, 0x8d, 0x8e, 0xce, 0x84, 0xcd, 0x6c,
+    0x30, 0xa2, 0x45, 0xf0, 0x48, 0x91, 0x85, 0xe9,
+    0x30, 0x29, 0x45, 0x68, 0x89, 0xd6, 0x1c, 0x09,
+    0x6e, 0x13, 0xa1, 0x78, 0xe3, 0xb7, 0x17, 0xef,
+    0xe1, 0xd6, 0x61, 0x21, 0x5f, 0xa6, 0xd2, 0x3d,
+    0xab, 0xa9, 0x80, 0xab, 0xad, 0xba, 0x0e, 0x39,
+    0x5e, 0x37, 0xf2, 0xa5, 0x0b, 0x20, 0xd2, 0x38,
+    0x56, 0x4f, 0x15, 0xf5, 0x1a, 0xfb, 0x4f, 0x4b,
+    0x21, 0x93, 0x9d, 0x40, 0x06, 0x29, 0xee, 0x06,
+    0x5c, 0x7c, 0x18, 0x49, 0x03,
+};
+
+static const struct sm4_xts_test sm4_xts_tests[] = {
+    {
+        .key = sm4_xts_key0,
+        .iv = sm4_xts_iv0,
+        .pt = sm4_xts_pt0,
+        .ct = sm4_xts_ct0_gb,
+        .len = sizeof(sm4_xts_pt0),
+        .gb = true,
+    },
+    {
+        .key = sm4_xts_key0,
+        .iv = sm4_xts_iv0,
+        .pt = sm4_xts_pt0,
+        .ct = sm4_xts_ct0_ieee,
+        .len = sizeof(sm4_xts_pt0),
+        .gb = false,
+    },
+};
+
+#endif  // _SM4_XTS_TEST_VECTORS_
@@ -22,9 +22,12 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "chacha20.h"
 #include "log.h"
 #include "vlen-bits.h"
 
+#include "test-vectors/chacha20-test-vectors.h"
+
 //
 // Assembly routine signatures.
 //
@@ -926,6 +929,126 @@ test_rand_vbrev8(void)
     return 0;
 }
 
+static uint32_t
+rol32(uint32_t x, unsigned shift)
+{
+    return (x << shift) | (x >> (32 - shift));
+}
+
+#define CHACHA20_QR(a, b, c, d) \
+    do { \
+        a += b; d ^= a; d = rol32(d, 16); \
+        c += d; b ^= c; b = rol32(b, 12); \
+        a += b; d ^= a; d = rol32(d, 8); \
+        c += d; b ^= c; b = rol32(b, 7); \
+    } while (0)
+
+// @brief Scalar ChaCha20 block function (RFC 8439, 2.3), used as a
+// reference for the vectorized keystream.
+//
+// @param key: The 256-bit key
+// @param nonce: The 96-bit nonce
+// @param counter: The block counter
+// @param out: The 64 bytes keystream block
+//
+void
+chacha20_block_ref(const uint8_t* key, const uint8_t* nonce, uint32_t counter,
+                   uint8_t* out)
+{
+    uint32_t state[16] = { 0x61707865, 0x3320646e, 0x79622d32, 0x6b206574 };
+    uint32_t x[16];
+
+    memcpy(&state[4], key, 32);
+    state[12] = counter;
+    memcpy(&state[13], nonce, 12);
+    memcpy(x, state, sizeof(x));
+    for (int i = 0; i < 10; ++i) {
+        CHACHA20_QR(x[0], x[4], x[8], x[12]);
+        CHACHA20_QR(x[1], x[5], x[9], x[13]);
+        CHACHA20_QR(x[2], x[6], x[10], x[14]);
+        CHACHA20_QR(x[3], x[7], x[11], x[15]);
+        CHACHA20_QR(x[0], x[5], x[10], x[15]);
+        CHACHA20_QR(x[1], x[6], x[11], x[12]);
+        CHACHA20_QR(x[2], x[7], x[8], x[13]);
+        CHACHA20_QR(x[3], x[4], x[9], x[14]);
+    }
+    for (int i = 0; i < 16; ++i) {
+        x[i] += state[i];
+    }
+    memcpy(out, x, sizeof(x));
+}
+
+// @brief Tests the ChaCha20 keystream routine against the RFC 8439 example,
+// then against the scalar reference with random keys, nonces and lengths.
+// The counters start close to 2^32 to check their wrap around.
+//
+// @return int 0 if the routine worked, 1 if it failed
+//
+int
+test_chacha20(void)
+{
+#define kChaChaMaxLen 1100
+#define kChaChaRounds 40
+
+    static uint8_t src[kChaChaMaxLen];
+    static uint8_t expected[kChaChaMaxLen];
+    static uint8_t actual[kChaChaMaxLen + 1];
+
+    LOG("Running ChaCha20 test suite... ");
+    const size_t ptlen = sizeof(chacha20_rfc8439_pt) - 1;
+    chacha20_xor(actual, (const uint8_t*)chacha20_rfc8439_pt, ptlen,
+                 chacha20_rfc8439_key, chacha20_rfc8439_nonce,
+                 chacha20_rfc8439_counter);
+    if (memcmp(actual, chacha20_rfc8439_ct, ptlen) != 0) {
+        LOG("failure, RFC 8439 example");
+        return 1;
+    }
+
+    size_t round = 0;
+    for (; round < kChaChaRounds; ++round) {
+        uint8_t key[CHACHA20_KEY_SIZE];
+        uint8_t nonce[CHACHA20_NONCE_SIZE];
+        const size_t len = rand() % kChaChaMaxLen;
+        const uint32_t counter = (uint32_t)-(rand() % 40);
+
+        for (size_t i = 0; i < sizeof(key); ++i) {
+            key[i] = rand8();
+        }
+        for (size_t i = 0; i < sizeof(nonce); ++i) {
+            nonce[i] = rand8();
+        }
+        for (size_t i = 0; i < len; ++i) {
+            src[i] = rand8();
+        }
+        for (size_t off = 0; off < len; off += CHACHA20_BLOCK_SIZE) {
+            uint8_t block[CHACHA20_BLOCK_SIZE];
+            chacha20_block_ref(key, nonce,
+                               counter + off / CHACHA20_BLOCK_SIZE, block);
+            for (size_t i = off; i < len && i < off + CHACHA20_BLOCK_SIZE; ++i) {
+                expected[i] = src[i] ^ block[i - off];
+            }
+        }
+
+        // Out of place, checking that nothing is written past the end.
+        memset(actual, 0xa5, sizeof(actual));
+        chacha20_xor(actual, src, len, key, nonce, counter);
+        if (memcmp(actual, expected, len) != 0 || actual[len] != 0xa5) {
+            LOG("failure, round=%zu, len=%zu, counter=0x%08" PRIx32,
+                round, len, counter);
+            return 1;
+        }
+
+        // In place.
+        chacha20_xor(src, src, len, key, nonce, counter);
+        if (memcmp(src, expected, len) != 0) {
+            LOG("failure (in place), round=%zu, len=%zu", round, len);
+            return 1;
+        }
+    }
+    LOG("success, %zu test rounds were run.", round);
+    return 0;
+}
+
 // @brief Calls test functions for our intrinsics
 //
 // @return int
@@ -988,5 +1111,10 @@ main()
         return res;
     }
 
+    res = test_chacha20();
+    if (res != 0) {
+        return res;
+    }
+
     return 0;
 }
@@ -15,10 +15,22 @@
 #ifndef ZVKB_H_
 #define ZVKB_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 extern void zvkb_ghash_init(uint64_t* H);
 
 extern void zvkb_ghash(uint64_t* X, uint64_t* H);
 
+// XORs 'nblocks' 64 bytes blocks with the ChaCha20 keystream, VLEN/32
+// blocks at a time, block 'i' using the block counter 'counter + i'.
+extern void zvkb_chacha20_xor_blocks(
+    uint8_t* dest,
+    const uint8_t* src,
+    size_t nblocks,
+    const uint32_t key[8],
+    const uint32_t nonce[3],
+    uint32_t counter
+);
+
 #endif  // ZVKB_H_
@@ -750,6 +750,256 @@ zvkb_ghash:
     vsse64.v v2, (a0), t4
     ret
 
+######################################################################
+# ChaCha20
+######################################################################
+
+# zvkb_chacha20_xor_blocks
+#
+# XORs 'nblocks' 64 bytes blocks of 'src' with the ChaCha20 (RFC 8439)
+# keystream and writes the result to 'dest'. Block 'i' uses the block
+# counter 'counter + i' (modulo 2^32).
+#
+# Each iteration computes VL = VLEN/32 blocks, one block per 32-bit element:
+# v0-v15 hold the 16 state words, word 'j' of all the blocks in 'vj'. The
+# rotations of the quarter round (left by 16, 12, 8, 7) are vror.vi by 16,
+# 20, 24 and 25, and the four quarter rounds of a column (resp. diagonal)
+# round are interleaved. The initial state words are the same for all the
+# blocks, except for the counter, and are added back from scalar registers
+# (vadd.vx) before the input is XORed in. The input and output blocks are
+# transposed by strided segment loads and stores, 8 words at a time.
+#
+# 'src' and 'dest' may be equal. 'key' and 'nonce' are the little-endian
+# words of the 256-bit key and 96-bit nonce.
+#
+# C Signature
+#   extern "C" void
+#   zvkb_chacha20_xor_blocks(
+#       uint8_t* dest,            // a0
+#       const uint8_t* src,       // a1
+#       uint64_t nblocks,         // a2
+#       const uint32_t key[8],    // a3
+#       const uint32_t nonce[3],  // a4
+#       uint32_t counter          // a5
+#   );
+#  a0=dest, a1=src, a2=nblocks, a3=key, a4=nonce, a5=counter
+#
+.balign 4
+.global zvkb_chacha20_xor_blocks
+zvkb_chacha20_xor_blocks:
+    beqz a2, 3f
+    li t6, 64  # Stride between the words of two consecutive blocks.
+1:
+    vsetvli t0, a2, e32, m1, ta, ma
+
+    # Initial state: "expand 32-byte k", key, counter, nonce.
+    li t1, 0x61707865
+    vmv.v.x v0, t1
+    li t1, 0x3320646e
+    vmv.v.x v1, t1
+    li t1, 0x79622d32
+    vmv.v.x v2, t1
+    li t1, 0x6b206574
+    vmv.v.x v3, t1
+    lw t1, 0(a3)
+    vmv.v.x v4, t1
+    lw t1, 4(a3)
+    vmv.v.x v5, t1
+    lw t1, 8(a3)
+    vmv.v.x v6, t1
+    lw t1, 12(a3)
+    vmv.v.x v7, t1
+    lw t1, 16(a3)
+    vmv.v.x v8, t1
+    lw t1, 20(a3)
+    vmv.v.x v9, t1
+    lw t1, 24(a3)
+    vmv.v.x v10, t1
+    lw t1, 28(a3)
+    vmv.v.x v11, t1
+    vid.v v12
+    vadd.vx v12, v12, a5
+    lw t1, 0(a4)
+    vmv.v.x v13, t1
+    lw t1, 4(a4)
+    vmv.v.x v14, t1
+    lw t1, 8(a4)
+    vmv.v.x v15, t1
+
+    li t2, 10  # 10 double rounds.
+2:
+    # Column rounds.
+    vadd.vv v0, v0, v4
+    vadd.vv v1, v1, v5
+    vadd.vv v2, v2, v6
+    vadd.vv v3, v3, v7
+    vxor.vv v12, v12, v0
+    vxor.vv v13, v13, v1
+    vxor.vv v14, v14, v2
+    vxor.vv v15, v15, v3
+    vror.vi v12, v12, 16
+    vror.vi v13, v13, 16
+    vror.vi v14, v14, 16
+    vror.vi v15, v15, 16
+    vadd.vv v8, v8, v12
+    vadd.vv v9, v9, v13
+    vadd.vv v10, v10, v14
+    vadd.vv v11, v11, v15
+    vxor.vv v4, v4, v8
+    vxor.vv v5, v5, v9
+    vxor.vv v6, v6, v10
+    vxor.vv v7, v7, v11
+    vror.vi v4, v4, 20
+    vror.vi v5, v5, 20
+    vror.vi v6, v6, 20
+    vror.vi v7, v7, 20
+    vadd.vv v0, v0, v4
+    vadd.vv v1, v1, v5
+    vadd.vv v2, v2, v6
+    vadd.vv v3, v3, v7
+    vxor.vv v12, v12, v0
+    vxor.vv v13, v13, v1
+    vxor.vv v14, v14, v2
+    vxor.vv v15, v15, v3
+    vror.vi v12, v12, 24
+    vror.vi v13, v13, 24
+    vror.vi v14, v14, 24
+    vror.vi v15, v15, 24
+    vadd.vv v8, v8, v12
+    vadd.vv v9, v9, v13
+    vadd.vv v10, v10, v14
+    vadd.vv v11, v11, v15
+    vxor.vv v4, v4, v8
+    vxor.vv v5, v5, v9
+    vxor.vv v6, v6, v10
+    vxor.vv v7, v7, v11
+    vror.vi v4, v4, 25
+    vror.vi v5, v5, 25
+    vror.vi v6, v6, 25
+    vror.vi v7, v7, 25
+
+    # Diagonal rounds.
+    vadd.vv v0, v0, v5
+    vadd.vv v1, v1, v6
+    vadd.vv v2, v2, v7
+    vadd.vv v3, v3, v4
+    vxor.vv v15, v15, v0
+    vxor.vv v12, v12, v1
+    vxor.vv v13, v13, v2
+    vxor.vv v14, v14, v3
+    vror.vi v15, v15, 16
+    vror.vi v12, v12, 16
+    vror.vi v13, v13, 16
+    vror.vi v14, v14, 16
+    vadd.vv v10, v10, v15
+    vadd.vv v11, v11, v12
+    vadd.vv v8, v8, v13
+    vadd.vv v9, v9, v14
+    vxor.vv v5, v5, v10
+    vxor.vv v6, v6, v11
+    vxor.vv v7, v7, v8
+    vxor.vv v4, v4, v9
+    vror.vi v5, v5, 20
+    vror.vi v6, v6, 20
+    vror.vi v7, v7, 20
+    vror.vi v4, v4, 20
+    vadd.vv v0, v0, v5
+    vadd.vv v1, v1, v6
+    vadd.vv v2, v2, v7
+    vadd.vv v3, v3, v4
+    vxor.vv v15, v15, v0
+    vxor.vv v12, v12, v1
+    vxor.vv v13, v13, v2
+    vxor.vv v14, v14, v3
+    vror.vi v15, v15, 24
+    vror.vi v12, v12, 24
+    vror.vi v13, v13, 24
+    vror.vi v14, v14, 24
+    vadd.vv v10, v10, v15
+    vadd.vv v11, v11, v12
+    vadd.vv v8, v8, v13
+    vadd.vv v9, v9, v14
+    vxor.vv v5, v5, v10
+    vxor.vv v6, v6, v11
+    vxor.vv v7, v7, v8
+    vxor.vv v4, v4, v9
+    vror.vi v5, v5, 25
+    vror.vi v6, v6, 25
+    vror.vi v7, v7, 25
+    vror.vi v4, v4, 25
+
+    addi t2, t2, -1
+    bnez t2, 2b
+
+    # Feed-forward of the initial state.
+    li t1, 0x61707865
+    vadd.vx v0, v0, t1
+    li t1, 0x3320646e
+    vadd.vx v1, v1, t1
+    li t1, 0x79622d32
+    vadd.vx v2, v2, t1
+    li t1, 0x6b206574
+    vadd.vx v3, v3, t1
+    lw t1, 0(a3)
+    vadd.vx v4, v4, t1
+    lw t1, 4(a3)
+    vadd.vx v5, v5, t1
+    lw t1, 8(a3)
+    vadd.vx v6, v6, t1
+    lw t1, 12(a3)
+    vadd.vx v7, v7, t1
+    lw t1, 16(a3)
+    vadd.vx v8, v8, t1
+    lw t1, 20(a3)
+    vadd.vx v9, v9, t1
+    lw t1, 24(a3)
+    vadd.vx v10, v10, t1
+    lw t1, 28(a3)
+    vadd.vx v11, v11, t1
+    vid.v v16
+    vadd.vx v16, v16, a5
+    vadd.vv v12, v12, v16
+    lw t1, 0(a4)
+    vadd.vx v13, v13, t1
+    lw t1, 4(a4)
+    vadd.vx v14, v14, t1
+    lw t1, 8(a4)
+    vadd.vx v15, v15, t1
+
+    # XOR with the input, words 0-7 then 8-15 of each block.
+    vlsseg8e32.v v16, (a1), t6
+    vxor.vv v16, v16, v0
+    vxor.vv v17, v17, v1
+    vxor.vv v18, v18, v2
+    vxor.vv v19, v19, v3
+    vxor.vv v20, v20, v4
+    vxor.vv v21, v21, v5
+    vxor.vv v22, v22, v6
+    vxor.vv v23, v23, v7
+    vssseg8e32.v v16, (a0), t6
+    addi t3, a1, 32
+    addi t4, a0, 32
+    vlsseg8e32.v v16, (t3), t6
+    vxor.vv v16, v16, v8
+    vxor.vv v17, v17, v9
+    vxor.vv v18, v18, v10
+    vxor.vv v19, v19, v11
+    vxor.vv v20, v20, v12
+    vxor.vv v21, v21, v13
+    vxor.vv v22, v22, v14
+    vxor.vv v23, v23, v15
+    vssseg8e32.v v16, (t4), t6
+
+    # Bump the counter by VL, and the addresses by VL*64 bytes.
+    add a5, a5, t0
+    sub a2, a2, t0
+    slli t0, t0, 6
+    add a1, a1, t0
+    add a0, a0, t0
+    bnez a2, 1b
+3:
+    ret
+
 .align  16
 polymod:
         .dword 0x0000000000000001
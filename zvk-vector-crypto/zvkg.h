@@ -29,4 +29,38 @@ zvkg_vghsh(
     const void* H
 );
 
+// Y, X, and H point to arrays of 128 bits values, n is their size in
+// bytes. Each value of Y is updated independently, with its own hash
+// subkey:
+//
+//   Y[i] <- (Y[i] xor X[i]) o H[i]
+extern void
+zvkg_vghsh_multi_vv(
+    void* Y,
+    const void* X,
+    const void* H,
+    uint64_t n
+);
+
+// Y and H point to 128 bits values.
+//
+//   Y <- Y o H
+extern void
+zvkg_vgmul(
+    void* Y,
+    const void* H
+);
+
+// Applies GHASH to the n/16 blocks at X, updating Y, processing multiple
+// blocks per instruction. 'Htable' holds 'table_size' powers of H,
+// from the highest to the lowest, i.e., Htable[i] = H^(table_size - i).
+extern void
+zvkg_ghash_aggregated_lmul4(
+    void* Y,
+    const void* X,
+    uint64_t n,
+    const void* Htable,
+    uint64_t table_size
+);
+
 #endif  // ZVKG_H_
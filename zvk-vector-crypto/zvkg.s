@@ -51,3 +51,200 @@ zvkg_vghsh:
     vghsh.vv v0, v8, v4
     vse32.v v0, (a0)
     ret
+
+# zvkg_vghsh_multi_vv
+#
+# Performs one step of GHASH for multiple independent hashes at once,
+# one per element group, each with its own hash subkey.
+#
+# For each 16 bytes block 'i' in [0, n/16):
+#   Y[i] <- (Y[i] xor X[i]) o H[i]
+#
+# 'n' should be a multiple of 16 bytes (128b).
+#
+#   void zvkg_vghsh_multi_vv(
+#       uint64_t* Y,        // a0
+#       const uint64_t* X,  // a1
+#       const uint64_t* H,  // a2
+#       uint64_t n          // a3
+#   );
+#
+.balign 4
+.global zvkg_vghsh_multi_vv
+zvkg_vghsh_multi_vv:
+    # t3 <- number of 4B elements, rounded down to full groups.
+    andi t3, a3, -16
+    srli t3, t3, 2
+    beqz t3, 2f
+
+1:
+    # We use LMUL=4 to enable runs with VLEN=32, as a proof of concept.
+    vsetvli t2, t3, e32, m4, ta, ma
+
+    vle32.v v0, (a0)
+    vle32.v v4, (a1)
+    vle32.v v8, (a2)
+
+    vghsh.vv v0, v8, v4
+    vse32.v v0, (a0)
+
+    sub t3, t3, t2              # Decrement count (4B elements)
+    slli t2, t2, 2              # t2 (#bytes) <- t2 (#4B) * 4
+    add a0, a0, t2
+    add a1, a1, t2
+    add a2, a2, t2
+    bnez t3, 1b
+
+2:
+    ret
+
+# zvkg_vgmul
+#
+# Galois Field multiplication, a thin wrapper around the vgmul instruction
+# from the Zvkg extension.
+#
+#   Y <- Y o H
+#
+#   void zvkg_vgmul(
+#       uint64_t Y[2],       // a0
+#       const uint64_t H[2]  // a1
+#   );
+#
+.balign 4
+.global zvkg_vgmul
+zvkg_vgmul:
+    # We use LMUL=4 to enable runs with VLEN=32, as a proof of concept.
+    vsetivli x0, 4, e32, m4, ta, ma
+
+    vle32.v v0, (a0)
+    vle32.v v4, (a1)
+
+    vgmul.vv v0, v4
+    vse32.v v0, (a0)
+    ret
+
+# zvkg_ghash_aggregated_lmul4
+#
+# Applies GHASH to 'n' bytes of data (n/16 blocks), updating the hash
+# value Y, i.e., this is equivalent to
+#   for (i = 0; i < n / 16; i++)
+#     Y <- (Y xor X[i]) o H
+# but processes 'k' blocks per vghsh instruction, where 'k' is the number
+# of element groups in a LMUL=4 register group, capped to 'table_size'.
+#
+# The blocks are accumulated in 'k' independent lanes, lane 'j' accumulating
+# blocks j, j+k, j+2k, ... Each lane is multiplied by H^k for every new
+# chunk of 'k' blocks, and the last chunk is multiplied by [H^k, ..., H^1],
+# which aligns all the lanes with the serial definition of GHASH. The lanes
+# are then XOR-ed together to produce the new Y value.
+#
+# When the number of blocks is not a multiple of 'k', the first chunk is
+# shifted up by 'z' lanes, and the 'z' first lanes are zero. Y is folded
+# in the first lane holding data.
+#
+# 'Htable' holds the powers of H, from the highest to the lowest one,
+# i.e., Htable[i] = H^(table_size - i), H^1 being the last entry.
+#
+# 'n' should be a multiple of 16 bytes (128b).
+#
+#   void zvkg_ghash_aggregated_lmul4(
+#       uint64_t Y[2],          // a0
+#       const void* X,          // a1
+#       uint64_t n,             // a2
+#       const void* Htable,     // a3
+#       uint64_t table_size     // a4
+#   );
+#
+.balign 4
+.global zvkg_ghash_aggregated_lmul4
+zvkg_ghash_aggregated_lmul4:
+    # t0 <- m, number of blocks.
+    srli t0, a2, 4
+    beqz t0, 4f
+
+    # t2 <- k = min(VLMAX/4, table_size), the number of lanes.
+    vsetvli t1, x0, e32, m4, ta, ma
+    srli t2, t1, 2
+    bleu t2, a4, 1f
+    mv t2, a4
+1:
+    # t1 <- 4*k, number of 4B elements in a chunk of 'k' blocks.
+    slli t1, t2, 2
+    vsetvli x0, t1, e32, m4, ta, ma
+
+    # v16 <- [H^k, ..., H^1], the last 'k' entries of the table.
+    sub t3, a4, t2
+    slli t3, t3, 4
+    add t3, a3, t3
+    vle32.v v16, (t3)
+
+    # v20 <- H^k in all element groups, by replicating the first group.
+    vid.v v4
+    vand.vi v4, v4, 3
+    vrgather.vv v20, v16, v4
+
+    # t3 <- z, number of leading lanes without data in the first chunk.
+    remu t3, t0, t2
+    beqz t3, 2f
+    sub t3, t2, t3
+2:
+    # t4 <- k - z, number of blocks in the first chunk.
+    sub t4, t2, t3
+    # t5 <- 4*z, lane shift in 4B elements.
+    slli t5, t3, 2
+
+    # v4 <- Y moved to lane 'z', zeroes elsewhere.
+    vmv.v.i v4, 0
+    vmv.v.i v8, 0
+    vmv.v.i v12, 0
+    vsetivli x0, 4, e32, m4, tu, ma
+    vle32.v v12, (a0)
+    vsetvli x0, t1, e32, m4, ta, ma
+    vslideup.vx v4, v12, t5
+
+    # v8 <- first chunk, moved up by 'z' lanes, zeroes elsewhere.
+    slli t6, t4, 2
+    vsetvli x0, t6, e32, m4, ta, ma
+    vle32.v v12, (a1)
+    vsetvli x0, t1, e32, m4, ta, ma
+    vslideup.vx v8, v12, t5
+
+    slli t6, t4, 4
+    add a1, a1, t6
+    sub t0, t0, t4
+    # t6 <- chunk size in bytes
+    slli t6, t2, 4
+
+3:
+    # Last chunk?
+    beqz t0, 5f
+    # v4 <- (v4 xor v8) o H^k
+    vghsh.vv v4, v20, v8
+    vle32.v v8, (a1)
+    add a1, a1, t6
+    sub t0, t0, t2
+    j 3b
+
+5:
+    # v4 <- (v4 xor v8) o [H^k, ..., H^1]
+    vghsh.vv v4, v16, v8
+
+    # XOR the lanes together. Using 64b elements, the even (resp. odd)
+    # elements hold the low (resp. high) half of the lanes.
+    srli t1, t1, 1
+    vsetvli x0, t1, e64, m4, ta, ma
+    vid.v v8
+    vand.vi v8, v8, 1
+    vmseq.vi v0, v8, 0
+    vmv.s.x v12, x0
+    vredxor.vs v24, v4, v12, v0.t
+    vmnot.m v0, v0
+    vredxor.vs v28, v4, v12, v0.t
+
+    vsetivli x0, 1, e64, m4, ta, ma
+    vse64.v v24, (a0)
+    addi a0, a0, 8
+    vse64.v v28, (a0)
+
+4:
+    ret
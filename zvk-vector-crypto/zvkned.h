@@ -154,4 +154,47 @@ zvkned_aes256_decode_vv_lmul1(
    const uint32_t* expanded_key
 );
 
+// AES-128/256 Multi-Key Counter Mode
+//
+// Each 16 bytes block 'i' is XORed with the encryption of counters[i]
+// under its own key, and counters[i] is incremented (32 bits, big-endian).
+// The round keys are stored round-major, i.e., round key 'r' of block 'i'
+// is at 'round_keys + r * stride + i * 16' (in bytes).
+// 'rounds' is 10 for AES-128, 14 for AES-256.
+
+extern uint64_t
+zvkned_aes_ctr32_multikey_vv_lmul4(
+   void* dest,
+   const void* src,
+   void* counters,
+   uint64_t n,
+   const uint32_t* round_keys,
+   uint64_t stride,
+   uint64_t rounds
+);
+
+// AES-128/256 Counter Mode
+//
+// Each 16 bytes block 'i' is XORed with the encryption of the i-th
+// increment (32 bits, big-endian) of counter_block, which is updated
+// to the counter block following the last one used.
+
+extern uint64_t
+zvkned_aes128_ctr32_vs_lmul4(
+   void* dest,
+   const void* src,
+   uint64_t n,
+   const uint32_t* expanded_key,
+   void* counter_block
+);
+
+extern uint64_t
+zvkned_aes256_ctr32_vs_lmul4(
+   void* dest,
+   const void* src,
+   uint64_t n,
+   const uint32_t* expanded_key,
+   void* counter_block
+);
+
 #endif  // ZVKNED_H_
@@ -2006,3 +2006,379 @@ zvkned_aes256_decode_vv_lmul1:
     mv a0, t0  # 'n' bytes result, computed on entry.
     ret
 # zvkned_aes256_decode_vv_lmul1
+
+
+######################################################################
+# AES-128/256 Multi-Key Counter Mode Routines
+######################################################################
+
+# zvkned_aes_ctr32_multikey_vv_lmul4
+#
+# Counter mode (CTR) keystream generation where each element group
+# uses its own key and its own counter block. This is the building
+# block for processing independent messages (e.g., a burst of packets,
+# each with its own key and IV) in lockstep, one 128b block per message.
+#
+# For each 16 bytes block 'i' in [0, n/16):
+#   dest[i] = src[i] ^ AES_Encrypt(counters[i], key_i)
+#   counters[i] = inc32(counters[i])
+# where inc32 increments the 32 bit big-endian counter held in the last
+# 4 bytes of the counter block, as in GCM.
+#
+# The round keys are laid out "round-major": round key 'r' for block 'i'
+# is found at 'round_keys + r * stride + i * 16' (bytes). This layout
+# allows to load the round keys for all element groups with a single vle32,
+# as required by the ".vv" variants of vaesem/vaesef. 'stride' is
+# typically the size of the full set of blocks, allowing callers to pass
+# a smaller 'n' when trailing blocks are not needed (e.g., when the
+# corresponding messages are exhausted).
+#
+# 'rounds' is the number of AES rounds, 10 for AES-128, 14 for AES-256,
+# i.e., there are (rounds + 1) round keys per block.
+#
+# 'n' should be a multiple of 16 bytes (128b). The counters are updated
+# in place, allowing to call this routine repeatedly to generate the
+# successive keystream blocks.
+#
+# Returns the number of bytes processed, which is 'n' when 'n'
+# is a multiple of 16, and floor(n/16)*16 otherwise.
+#
+# This routine uses vrev8 from Zvkb to increment the big-endian counters.
+#
+# We use LMUL=4 to enable runs with VLEN=32. Since the round keys are
+# distinct for each element group, they cannot be held in registers across
+# iterations and are (re-)loaded from memory every round.
+#
+# C/C++ Signature
+#   extern "C" uint64_t
+#   zvkned_aes_ctr32_multikey_vv_lmul4(
+#       void* dest,                  // a0
+#       const void* src,             // a1
+#       void* counters,              // a2
+#       uint64_t n,                  // a3
+#       const uint32_t* round_keys,  // a4
+#       uint64_t stride,             // a5
+#       uint64_t rounds              // a6
+#   );
+#  a0=dest, a1=src, a2=counters, a3=n, a4=round_keys, a5=stride, a6=rounds
+#
+.balign 4
+.global zvkned_aes_ctr32_multikey_vv_lmul4
+zvkned_aes_ctr32_multikey_vv_lmul4:
+    # a3 on input is number of bytes of the plaintext. We round it down
+    # to a multiple of 16 bytes (128b), keep that in t0 that we return.
+    andi t0, a3, -16
+    beqz t0, 2f  # Early exit in the "0 bytes to process" case
+    # t3 <- t0 / 4, number of remaining 4B elements
+    srli t3, t0, 2
+    # t1 <- number of middle rounds (vaesem)
+    addi t1, a6, -1
+
+1:
+    # mu: mask undisturbed, the counter increment below is masked
+    # to the last word of each element group.
+    vsetvli t2, t3, e32, m4, ta, mu
+
+    # v4 <- counter blocks
+    vle32.v v4, (a2)
+
+    # Initial AddRoundKey, with per-group round keys.
+    # t4 walks through the round keys for the current groups.
+    mv t4, a4
+    vle32.v v12, (t4)
+    vxor.vv v8, v4, v12
+
+    # Middle rounds, vaesem performs
+    # SubBytes+ShiftRows+MixColumns+AddRoundKey
+    mv t5, t1
+3:
+    add t4, t4, a5              # Next round key, 'stride' bytes further
+    vle32.v v12, (t4)
+    vaesem.vv v8, v12
+    addi t5, t5, -1
+    bnez t5, 3b
+
+    # Final round, vaesef does SubBytes+ShiftRows+AddRoundKey
+    add t4, t4, a5
+    vle32.v v12, (t4)
+    vaesef.vv v8, v12
+
+    # XOR the keystream with the source and store the result.
+    vle32.v v16, (a1)
+    vxor.vv v8, v8, v16
+    vse32.v v8, (a0)
+
+    # Increment the counters, i.e., the last 32b word of each group,
+    # which is stored in big-endian format.
+    vid.v v20
+    vand.vi v20, v20, 3
+    vmseq.vi v0, v20, 3
+    vrev8.v v4, v4, v0.t
+    vadd.vi v4, v4, 1, v0.t
+    vrev8.v v4, v4, v0.t
+    vse32.v v4, (a2)
+
+    # t2 contains the number of 32b/4B elements processed
+    sub t3, t3, t2              # Decrement count (4B elements)
+
+    slli t2, t2, 2              # t2 (#bytes) <- t2 (#4B) * 4
+    add a0, a0, t2              # Increment target address (bytes)
+    add a1, a1, t2              # Increment source address (bytes)
+    add a2, a2, t2              # Increment counters address (bytes)
+    add a4, a4, t2              # Round keys of the next groups
+
+    bnez t3, 1b                 # Continue the loop?
+
+2:
+    # Return the number of bytes actually processed
+    mv a0, t0  # 'n' bytes result, computed on entry.
+    ret
+# zvkned_aes_ctr32_multikey_vv_lmul4
+
+#
+# AES-128/256 Counter Mode Routines
+#
+
+# Counter mode (CTR) keystream generation with a single key, where the
+# counter blocks are generated in registers from a single counter block.
+#
+# For each 16 bytes block 'i' in [0, n/16):
+#   dest[i] = src[i] ^ AES_Encrypt(inc32^i(counter_block), key)
+# where inc32 increments the 32 bit big-endian counter held in the last
+# 4 bytes of the counter block, as in GCM. On return 'counter_block'
+# holds the counter block following the last one used, allowing to
+# call this routine repeatedly on consecutive parts of a message.
+#
+# The counter words are kept in v4 in native (little-endian) format,
+# group 'j' holding the counter of block 'j' of the current iteration.
+# They are byte-swapped back into counter blocks before every encryption,
+# and incremented by the number of groups processed after it.
+#
+# 'n' should be a multiple of 16 bytes (128b).
+#
+# Returns the number of bytes processed, which is 'n' when 'n'
+# is a multiple of 16, and floor(n/16)*16 otherwise.
+#
+# This routine uses vrev8 from Zvkb to convert the big-endian counters.
+#
+# C/C++ Signature
+#   extern "C" uint64_t
+#   zvkned_aes128_ctr32_vs_lmul4(
+#       void* dest,             // a0
+#       const void* src,        // a1
+#       uint64_t n,             // a2
+#       const char key[16],     // a3
+#       char counter_block[16]  // a4
+#   );
+#  a0=dest, a1=src, a2=n, a3=&key[0], a4=&counter_block[0]
+#
+.balign 4
+.global zvkned_aes128_ctr32_vs_lmul4
+zvkned_aes128_ctr32_vs_lmul4:
+    # a2 on input is number of bytes of the plaintext. We round it down
+    # to a multiple of 16 bytes (128b), keep that in t0 that we return.
+    andi t0, a2, -16
+    beqz t0, 2f  # Early exit in the "0 bytes to process" case
+    # t3 <- t0 / 4, number of remaining 4B elements
+    srli t3, t0, 2
+
+    # The round keys are expanded anew on every iteration, from the
+    # initial key in v16.
+    vsetivli x0, 4, e32, m4, ta, mu
+    vle32.v v16, (a3)
+    vle32.v v12, (a4)
+
+    # Replicate the counter block across all element groups, and add
+    # the group index to the (native) counters.
+    vsetvli t1, x0, e32, m4, ta, mu
+    vid.v v8
+    vand.vi v20, v8, 3
+    vmseq.vi v0, v20, 3         # v0 <- last word of each group
+    vrgather.vv v4, v12, v20
+    vsrl.vi v8, v8, 2           # v8 <- group index
+    vrev8.v v4, v4, v0.t
+    vadd.vv v4, v4, v8, v0.t
+
+1:
+    # mu: mask undisturbed, the counter updates below are masked
+    # to the last word of each element group.
+    vsetvli t2, t3, e32, m4, ta, mu
+
+    # v8 <- counter blocks, with the counters back in big-endian format.
+    vmv.v.v v8, v4
+    vrev8.v v8, v8, v0.t
+
+    # Initial AddRoundKey
+    vaesz.vs v8, v16   # with round key w[ 0, 4]
+
+    # Middle rounds, vaesem performs
+    # SubBytes+ShiftRows+MixColumns+AddRoundKey
+    vaeskf1.vi v20, v16,  1  # v20 <- w[ 4,  7]
+    vaesem.vs v8, v20   # with round key w[ 4, 7]
+    vaeskf1.vi v20, v20,  2  # v20 <- w[ 8, 11]
+    vaesem.vs v8, v20   # with round key w[ 8,11]
+    vaeskf1.vi v20, v20,  3  # v20 <- w[12, 15]
+    vaesem.vs v8, v20   # with round key w[12,15]
+    vaeskf1.vi v20, v20,  4  # v20 <- w[16, 19]
+    vaesem.vs v8, v20   # with round key w[16,19]
+    vaeskf1.vi v20, v20,  5  # v20 <- w[20, 23]
+    vaesem.vs v8, v20   # with round key w[20,23]
+    vaeskf1.vi v20, v20,  6  # v20 <- w[24, 27]
+    vaesem.vs v8, v20   # with round key w[24,27]
+    vaeskf1.vi v20, v20,  7  # v20 <- w[28, 31]
+    vaesem.vs v8, v20   # with round key w[28,31]
+    vaeskf1.vi v20, v20,  8  # v20 <- w[32, 35]
+    vaesem.vs v8, v20   # with round key w[32,35]
+    vaeskf1.vi v20, v20,  9  # v20 <- w[36, 39]
+    vaesem.vs v8, v20   # with round key w[36,39]
+    # Final round, vaesef does SubBytes+ShiftRows+AddRoundKey
+    vaeskf1.vi v20, v20, 10  # v20 <- w[40, 43]
+    vaesef.vs v8, v20   # with round key w[40,43]
+
+    # XOR the keystream with the source and store the result.
+    vle32.v v12, (a1)
+    vxor.vv v8, v8, v12
+    vse32.v v8, (a0)
+
+    # Advance the counters by the number of groups processed.
+    srli t4, t2, 2
+    vadd.vx v4, v4, t4, v0.t
+
+    # t2 contains the number of 32b/4B elements processed
+    sub t3, t3, t2              # Decrement count (4B elements)
+
+    slli t2, t2, 2              # t2 (#bytes) <- t2 (#4B) * 4
+    add a1, a1, t2              # Increment source address (bytes)
+    add a0, a0, t2              # Increment target address (bytes)
+
+    bnez t3, 1b                 # Continue the loop?
+
+    # Store the next counter block, held in group 0.
+    vsetivli x0, 4, e32, m4, ta, mu
+    vrev8.v v4, v4, v0.t
+    vse32.v v4, (a4)
+
+2:
+    # Return the number of bytes actually processed
+    mv a0, t0  # 'n' bytes result, computed on entry.
+    ret
+# zvkned_aes128_ctr32_vs_lmul4
+
+
+# zvkned_aes256_ctr32_vs_lmul4
+#
+# AES-256 variant of zvkned_aes128_ctr32_vs_lmul4, see above.
+#
+# C/C++ Signature
+#   extern "C" uint64_t
+#   zvkned_aes256_ctr32_vs_lmul4(
+#       void* dest,             // a0
+#       const void* src,        // a1
+#       uint64_t n,             // a2
+#       const char key[32],     // a3
+#       char counter_block[16]  // a4
+#   );
+#  a0=dest, a1=src, a2=n, a3=&key[0], a4=&counter_block[0]
+#
+.balign 4
+.global zvkned_aes256_ctr32_vs_lmul4
+zvkned_aes256_ctr32_vs_lmul4:
+    # a2 on input is number of bytes of the plaintext. We round it down
+    # to a multiple of 16 bytes (128b), keep that in t0 that we return.
+    andi t0, a2, -16
+    beqz t0, 2f  # Early exit in the "0 bytes to process" case
+    # t3 <- t0 / 4, number of remaining 4B elements
+    srli t3, t0, 2
+
+    # The round keys are expanded anew on every iteration, from the
+    # initial 32B key in v16 and v20.
+    vsetivli x0, 4, e32, m4, ta, mu
+    vle32.v v16, (a3)
+    addi t1, a3, 16
+    vle32.v v20, (t1)
+    vle32.v v12, (a4)
+
+    # Replicate the counter block across all element groups, and add
+    # the group index to the (native) counters.
+    vsetvli t1, x0, e32, m4, ta, mu
+    vid.v v8
+    vand.vi v24, v8, 3
+    vmseq.vi v0, v24, 3         # v0 <- last word of each group
+    vrgather.vv v4, v12, v24
+    vsrl.vi v8, v8, 2           # v8 <- group index
+    vrev8.v v4, v4, v0.t
+    vadd.vv v4, v4, v8, v0.t
+
+1:
+    # mu: mask undisturbed, the counter updates below are masked
+    # to the last word of each element group.
+    vsetvli t2, t3, e32, m4, ta, mu
+
+    # v8 <- counter blocks, with the counters back in big-endian format.
+    vmv.v.v v8, v4
+    vrev8.v v8, v8, v0.t
+
+    vmv.v.v v24, v16  # v24 <- w[ 0,  3]
+    vmv.v.v v28, v20  # v28 <- w[ 4,  7]
+
+    # Initial AddRoundKey
+    vaesz.vs v8, v24  # with round key w[ 0, 3]
+    # Middle rounds, vaesem performs
+    # SubBytes+ShiftRows+MixColumns+AddRoundKey
+    vaesem.vs v8, v28    # with round key w[ 4, 7]
+    vaeskf2.vi v24, v28,  2  # v24 <- w[ 8, 11]
+    vaesem.vs v8, v24    # with round key w[ 8,11]
+    vaeskf2.vi v28, v24,  3  # v28 <- w[12, 15]
+    vaesem.vs v8, v28    # with round key w[12,15]
+    vaeskf2.vi v24, v28,  4  # v24 <- w[16, 19]
+    vaesem.vs v8, v24    # with round key w[16,19]
+    vaeskf2.vi v28, v24,  5  # v28 <- w[20, 23]
+    vaesem.vs v8, v28    # with round key w[20,23]
+    vaeskf2.vi v24, v28,  6  # v24 <- w[24, 27]
+    vaesem.vs v8, v24    # with round key w[24,27]
+    vaeskf2.vi v28, v24,  7  # v28 <- w[28, 31]
+    vaesem.vs v8, v28    # with round key w[28,31]
+    vaeskf2.vi v24, v28,  8  # v24 <- w[32, 35]
+    vaesem.vs v8, v24    # with round key w[32,35]
+    vaeskf2.vi v28, v24,  9  # v28 <- w[36, 39]
+    vaesem.vs v8, v28    # with round key w[36,39]
+    vaeskf2.vi v24, v28, 10  # v24 <- w[40, 43]
+    vaesem.vs v8, v24    # with round key w[40,43]
+    vaeskf2.vi v28, v24, 11  # v28 <- w[44, 47]
+    vaesem.vs v8, v28    # with round key w[44,47]
+    vaeskf2.vi v24, v28, 12  # v24 <- w[48, 51]
+    vaesem.vs v8, v24    # with round key w[48,51]
+    vaeskf2.vi v28, v24, 13  # v28 <- w[52, 55]
+    vaesem.vs v8, v28    # with round key w[52,55]
+    # Final round, vaesef does SubBytes+ShiftRows+AddRoundKey
+    vaeskf2.vi v24, v28, 14  # v24 <- w[56, 59]
+    vaesef.vs v8, v24    # with round key w[56,59]
+
+    # XOR the keystream with the source and store the result.
+    vle32.v v12, (a1)
+    vxor.vv v8, v8, v12
+    vse32.v v8, (a0)
+
+    # Advance the counters by the number of groups processed.
+    srli t4, t2, 2
+    vadd.vx v4, v4, t4, v0.t
+
+    # t2 contains the number of 32b/4B elements processed
+    sub t3, t3, t2              # Decrement count (4B elements)
+
+    slli t2, t2, 2              # t2 (#bytes) <- t2 (#4B) * 4
+    add a1, a1, t2              # Increment source address (bytes)
+    add a0, a0, t2              # Increment target address (bytes)
+
+    bnez t3, 1b                 # Continue the loop?
+
+    # Store the next counter block, held in group 0.
+    vsetivli x0, 4, e32, m4, ta, mu
+    vrev8.v v4, v4, v0.t
+    vse32.v v4, (a4)
+
+2:
+    # Return the number of bytes actually processed
+    mv a0, t0  # 'n' bytes result, computed on entry.
+    ret
+# zvkned_aes256_ctr32_vs_lmul4
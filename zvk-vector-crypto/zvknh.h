@@ -53,6 +53,22 @@ static const uint32_t kSha256InitialHash[8] = {
     0x3c6ef372,  // [7]: H2 = c
 };
 
+// SHA-224 uses the SHA-256 compression with its own initial hash value,
+// in the same native order, and truncates the digest to H0..H6.
+#define SHA224_DIGEST_SIZE 28
+
+static const uint32_t kSha224InitialHash[8] = {
+    0x68581511,  // [0]: H5 = f
+    0xffc00b31,  // [1]: H4 = e
+    0x367cd507,  // [2]: H1 = b
+    0xc1059ed8,  // [3]: H0 = a
+
+    0xbefa4fa4,  // [4]: H7 = h
+    0x64f98fa7,  // [5]: H6 = g
+    0xf70e5939,  // [6]: H3 = d
+    0x3070dd17,  // [7]: H2 = c
+};
+
 #define SHA512_DIGEST_SIZE 64
 #define SHA512_BLOCK_SIZE 128
 
@@ -89,6 +105,49 @@ static const uint64_t kSha512InitialHash[SHA512_DIGEST_SIZE / sizeof(uint64_t)]
     0x3c6ef372fe94f82b,  // [7]: H2 = c
 };
 
+// SHA-384, SHA-512/224 and SHA-512/256 use the SHA-512 compression with
+// their own initial hash values, in the same native order, and truncate
+// the digest to its first 48, 28 and 32 bytes respectively.
+#define SHA384_DIGEST_SIZE 48
+#define SHA512_224_DIGEST_SIZE 28
+#define SHA512_256_DIGEST_SIZE 32
+
+static const uint64_t kSha384InitialHash[SHA512_DIGEST_SIZE / sizeof(uint64_t)] = {
+    0x8eb44a8768581511,  // [0]: H5 = f
+    0x67332667ffc00b31,  // [1]: H4 = e
+    0x629a292a367cd507,  // [2]: H1 = b
+    0xcbbb9d5dc1059ed8,  // [3]: H0 = a
+
+    0x47b5481dbefa4fa4,  // [4]: H7 = h
+    0xdb0c2e0d64f98fa7,  // [5]: H6 = g
+    0x152fecd8f70e5939,  // [6]: H3 = d
+    0x9159015a3070dd17,  // [7]: H2 = c
+};
+
+static const uint64_t kSha512_224InitialHash[SHA512_DIGEST_SIZE / sizeof(uint64_t)] = {
+    0x77e36f7304c48942,  // [0]: H5 = f
+    0x0f6d2b697bd44da8,  // [1]: H4 = e
+    0x73e1996689dcd4d6,  // [2]: H1 = b
+    0x8c3d37c819544da2,  // [3]: H0 = a
+
+    0x1112e6ad91d692a1,  // [4]: H7 = h
+    0x3f9d85a86a1d36c8,  // [5]: H6 = g
+    0x679dd514582f9fcf,  // [6]: H3 = d
+    0x1dfab7ae32ff9c82,  // [7]: H2 = c
+};
+
+static const uint64_t kSha512_256InitialHash[SHA512_DIGEST_SIZE / sizeof(uint64_t)] = {
+    0xbe5e1e2553863992,  // [0]: H5 = f
+    0x96283ee2a88effe3,  // [1]: H4 = e
+    0x9f555fa3c84c64c2,  // [2]: H1 = b
+    0x22312194fc2bf72c,  // [3]: H0 = a
+
+    0x0eb72ddc81c52ca2,  // [4]: H7 = h
+    0x2b0199fc2c85b8aa,  // [5]: H6 = g
+    0x963877195940eabd,  // [6]: H3 = d
+    0x2393b86b6f53b151,  // [7]: H2 = c
+};
+
 extern void
 sha256_block_lmul1(
     uint8_t* hash,
@@ -113,4 +172,125 @@ sha512_block_lmul2(
     const void* block
 );
 
+// LMUL>1 variants for VLEN values below the element group width (128 bits
+// for SHA-256, 256 bits for SHA-512): sha256_block_lmul2 requires VLEN >= 64,
+// sha512_block_lmul4 requires VLEN >= 64.
+
+extern void
+sha256_block_lmul2(
+    uint8_t* hash,
+    const void* block
+);
+
+extern void
+sha512_block_lmul4(
+    uint8_t* hash,
+    const void* block
+);
+
+// Multi-block variants, hashing 'nblocks' consecutive blocks with
+// the hash value (and round constants when they fit) kept in registers.
+
+extern void
+sha256_blocks_lmul1(
+    uint8_t* hash,
+    const void* data,
+    uint64_t nblocks
+);
+
+extern void
+sha512_blocks_lmul1(
+    uint8_t* hash,
+    const void* data,
+    uint64_t nblocks
+);
+
+extern void
+sha512_blocks_lmul2(
+    uint8_t* hash,
+    const void* data,
+    uint64_t nblocks
+);
+
+extern void
+sha256_blocks_lmul2(
+    uint8_t* hash,
+    const void* data,
+    uint64_t nblocks
+);
+
+extern void
+sha512_blocks_lmul4(
+    uint8_t* hash,
+    const void* data,
+    uint64_t nblocks
+);
+
+// Multi-buffer variants, hashing independent messages in lockstep, one
+// message per element group. 'states' holds 'nlanes' hash values in the
+// native representation, message 'i' has counts[i] blocks at ptrs[i].
+
+extern void
+sha256_multi_blocks_lmul1(
+    uint32_t* states,
+    const void* const* ptrs,
+    const uint32_t* counts,
+    uint64_t nlanes
+);
+
+extern void
+sha512_multi_blocks_lmul1(
+    uint64_t* states,
+    const void* const* ptrs,
+    const uint64_t* counts,
+    uint64_t nlanes
+);
+
+// PBKDF2 variants, running 'iterations' HMAC iterations for independent
+// lanes in lockstep, one lane per element group. Each lane holds four hash
+// values in the native representation: the inner and outer HMAC midstates,
+// the last HMAC output U, and the accumulated T. U and T are updated.
+
+extern void
+sha256_pbkdf2_lmul1(
+    uint32_t* lanes,
+    uint64_t iterations,
+    uint64_t nlanes
+);
+
+extern void
+sha512_pbkdf2_lmul1(
+    uint64_t* lanes,
+    uint64_t iterations,
+    uint64_t nlanes
+);
+
+// Double SHA-256 of 'count' 80 bytes headers differing only in their
+// little-endian nonce (last 4 bytes), one header per element group.
+// 'params' holds the hash value after the first 64 bytes of the header,
+// the SHA-256 initial hash value (both native), and the big-endian words
+// of header bytes 64 to 75 (plus one ignored word). 'hashes' receives
+// 'count' final hash values in the native representation.
+
+extern void
+sha256d_sweep_lmul1(
+    uint32_t* hashes,
+    const uint32_t* params,
+    uint64_t nonce,
+    uint64_t count
+);
+
+// Inner nodes of a SHA-256 Merkle tree, one node per element group.
+// 'children' holds 2 * 'nparents' hash values in the native
+// representation, parent i being the hash of the digests of children 2i
+// and 2i+1. 'parents' receives the 'nparents' hash values in the same
+// representation.
+
+extern void
+sha256_merkle_nodes_lmul1(
+    uint32_t* parents,
+    const uint32_t* children,
+    uint64_t nparents
+);
+
 #endif  // ZVKNH_H_
@@ -1696,3 +1696,3951 @@ sha512_block_lmul2:
     ret
 
 # sha512_block_lmul2
+
+# sha256_block_lmul2
+#
+# Pretty much identical to sha256_block_lmul1 but using LMUL=2, so that
+# an element group of four 32 bits words spans two registers when
+# VLEN=64. Register groups are at even indices, see sha512_block_lmul2
+# for the same layout with 64 bits words.
+#
+# Minimum VLEN: 64 bits.
+#
+.balign 4
+.global sha256_block_lmul2
+sha256_block_lmul2:
+
+    # Register use in this function:
+    #  v10 - v16: message schedule words (Wt), register groups v10, v12,
+    #             v14, v16
+    #  v18 - v20: working state variables, {a,b,e,f} and {c,d,g,h}
+    #  v28 - v30: the hash value at the start of the block
+    #  v24: round constants Kt
+    #  v22: temporary, Wt+Kt
+    #  v0: mask for vmerge
+    #  t1: address of the second half of `hash`
+
+    vsetivli x0, 4, e32, m2, ta, ma
+
+    # Load the 512-bits of the message block in v10-v16 and perform
+    # an endian swap on each 4 bytes element.
+    vle32.v v10, (a1)
+    vrev8.v v10, v10
+    addi a1, a1, 16
+    vle32.v v12, (a1)
+    vrev8.v v12, v12
+    addi a1, a1, 16
+    vle32.v v14, (a1)
+    vrev8.v v14, v14
+    addi a1, a1, 16
+    vle32.v v16, (a1)
+    vrev8.v v16, v16
+
+    # Load H, as {f,e,b,a} and {h,g,d,c}.
+    vle32.v v18, (a0)
+    addi t1, a0, 16
+    vle32.v v20, (t1)
+
+    # Set v0 up for the vmerge that replaces the first word (idx==0)
+    vid.v v0
+    vmseq.vi v0, v0, 0x0    # v0.mask[i] = (i == 0 ? 1 : 0)
+
+    # Capture the H values at the start of the block, H' = H+{a',b',...,h'}.
+    vmv.v.v v28, v18
+    vmv.v.v v30, v20
+
+    # t0 tracks round constants.
+    la t0, SHA256_ROUND_CONSTANTS
+
+    #--------------------------------------------------------------------------------
+    # Quad-round 0 (+0, v10->v12->v14->v16)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v10
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v14, v12, v0
+    vsha2ms.vv v10, v22, v16  # Generate W[19:16]
+    #--------------------------------------------------------------------------------
+    # Quad-round 1 (+1, v12->v14->v16->v10)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v12
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v16, v14, v0
+    vsha2ms.vv v12, v22, v10  # Generate W[23:20]
+    #--------------------------------------------------------------------------------
+    # Quad-round 2 (+2, v14->v16->v10->v12)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v14
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v10, v16, v0
+    vsha2ms.vv v14, v22, v12  # Generate W[27:24]
+    #--------------------------------------------------------------------------------
+    # Quad-round 3 (+3, v16->v10->v12->v14)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v16
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v12, v10, v0
+    vsha2ms.vv v16, v22, v14  # Generate W[31:28]
+    #--------------------------------------------------------------------------------
+    # Quad-round 4 (+0, v10->v12->v14->v16)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v10
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v14, v12, v0
+    vsha2ms.vv v10, v22, v16  # Generate W[35:32]
+    #--------------------------------------------------------------------------------
+    # Quad-round 5 (+1, v12->v14->v16->v10)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v12
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v16, v14, v0
+    vsha2ms.vv v12, v22, v10  # Generate W[39:36]
+    #--------------------------------------------------------------------------------
+    # Quad-round 6 (+2, v14->v16->v10->v12)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v14
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v10, v16, v0
+    vsha2ms.vv v14, v22, v12  # Generate W[43:40]
+    #--------------------------------------------------------------------------------
+    # Quad-round 7 (+3, v16->v10->v12->v14)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v16
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v12, v10, v0
+    vsha2ms.vv v16, v22, v14  # Generate W[47:44]
+    #--------------------------------------------------------------------------------
+    # Quad-round 8 (+0, v10->v12->v14->v16)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v10
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v14, v12, v0
+    vsha2ms.vv v10, v22, v16  # Generate W[51:48]
+    #--------------------------------------------------------------------------------
+    # Quad-round 9 (+1, v12->v14->v16->v10)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v12
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v16, v14, v0
+    vsha2ms.vv v12, v22, v10  # Generate W[55:52]
+    #--------------------------------------------------------------------------------
+    # Quad-round 10 (+2, v14->v16->v10->v12)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v14
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v10, v16, v0
+    vsha2ms.vv v14, v22, v12  # Generate W[59:56]
+    #--------------------------------------------------------------------------------
+    # Quad-round 11 (+3, v16->v10->v12->v14)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v16
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v12, v10, v0
+    vsha2ms.vv v16, v22, v14  # Generate W[63:60]
+    #--------------------------------------------------------------------------------
+    # Quad-round 12 (+0, v10->v12->v14->v16)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v10
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    #--------------------------------------------------------------------------------
+    # Quad-round 13 (+1, v12->v14->v16->v10)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v12
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    #--------------------------------------------------------------------------------
+    # Quad-round 14 (+2, v14->v16->v10->v12)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v14
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    #--------------------------------------------------------------------------------
+    # Quad-round 15 (+3, v16->v10->v12->v14)
+    vle32.v v24, (t0)
+    vadd.vv v22, v24, v16
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+
+    #--------------------------------------------------------------------------------
+    # H' = H+{a',b',c',...,h'}
+    vadd.vv v18, v28, v18
+    vadd.vv v20, v30, v20
+
+    # Save the hash
+    vse32.v v18, (a0)   # {a',b',e',f'}
+    vse32.v v20, (t1)   # {c',d',g',h'}
+
+    ret
+
+# sha256_block_lmul2
+
+# sha512_block_lmul4
+#
+# Pretty much identical to sha512_block_lmul2 but using LMUL=4, so that
+# an element group of four 64 bits words spans four registers when
+# VLEN=64.
+#
+# With LMUL=4 only 8 register groups are available (v0, v4, ..., v28),
+# and v0 holds the vmerge mask. The four message schedule groups, the
+# two working state groups and a temporary use the remaining ones: the
+# round constants are loaded in the temporary before adding Wt to them,
+# and the initial hash value is re-read from `hash` to compute H'.
+#
+# Minimum VLEN: 64 bits.
+#
+.balign 4
+.global sha512_block_lmul4
+sha512_block_lmul4:
+
+    # Register use in this function:
+    #  v4 - v16: message schedule words (Wt), register groups v4, v8,
+    #            v12, v16
+    #  v20 - v24: working state variables, {a,b,e,f} and {c,d,g,h}
+    #  v28: temporary, Kt then Wt+Kt, and the vmerge result
+    #  v0: mask for vmerge
+    #  t1: address of the second half of `hash`
+
+    vsetivli x0, 4, e64, m4, ta, ma
+
+    addi t1, a0, 32
+
+    # Set v0 up for the vmerge that replaces the first word (idx==0)
+    vid.v v0
+    vmseq.vi v0, v0, 0x0    # v0.mask[i] = (i == 0 ? 1 : 0)
+
+    # Load the 1024-bits of the message block in v4-v16 and perform
+    # an endian swap on each 8 bytes element.
+    vle64.v v4, (a1)
+    vrev8.v v4, v4
+    addi a1, a1, 32
+    vle64.v v8, (a1)
+    vrev8.v v8, v8
+    addi a1, a1, 32
+    vle64.v v12, (a1)
+    vrev8.v v12, v12
+    addi a1, a1, 32
+    vle64.v v16, (a1)
+    vrev8.v v16, v16
+
+    # Load H, as {f,e,b,a} and {h,g,d,c}.
+    vle64.v v20, (a0)
+    vle64.v v24, (t1)
+
+    # t0 tracks round constants.
+    la t0, SHA512_ROUND_CONSTANTS
+
+    #--------------------------------------------------------------------------------
+    # Quad-round 0 (+0, v4->v8->v12->v16)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v4
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v12, v8, v0
+    vsha2ms.vv v4, v28, v16  # Generate W[19:16]
+    #--------------------------------------------------------------------------------
+    # Quad-round 1 (+1, v8->v12->v16->v4)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v8
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v16, v12, v0
+    vsha2ms.vv v8, v28, v4  # Generate W[23:20]
+    #--------------------------------------------------------------------------------
+    # Quad-round 2 (+2, v12->v16->v4->v8)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v12
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v4, v16, v0
+    vsha2ms.vv v12, v28, v8  # Generate W[27:24]
+    #--------------------------------------------------------------------------------
+    # Quad-round 3 (+3, v16->v4->v8->v12)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v16
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v8, v4, v0
+    vsha2ms.vv v16, v28, v12  # Generate W[31:28]
+    #--------------------------------------------------------------------------------
+    # Quad-round 4 (+0, v4->v8->v12->v16)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v4
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v12, v8, v0
+    vsha2ms.vv v4, v28, v16  # Generate W[35:32]
+    #--------------------------------------------------------------------------------
+    # Quad-round 5 (+1, v8->v12->v16->v4)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v8
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v16, v12, v0
+    vsha2ms.vv v8, v28, v4  # Generate W[39:36]
+    #--------------------------------------------------------------------------------
+    # Quad-round 6 (+2, v12->v16->v4->v8)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v12
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v4, v16, v0
+    vsha2ms.vv v12, v28, v8  # Generate W[43:40]
+    #--------------------------------------------------------------------------------
+    # Quad-round 7 (+3, v16->v4->v8->v12)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v16
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v8, v4, v0
+    vsha2ms.vv v16, v28, v12  # Generate W[47:44]
+    #--------------------------------------------------------------------------------
+    # Quad-round 8 (+0, v4->v8->v12->v16)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v4
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v12, v8, v0
+    vsha2ms.vv v4, v28, v16  # Generate W[51:48]
+    #--------------------------------------------------------------------------------
+    # Quad-round 9 (+1, v8->v12->v16->v4)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v8
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v16, v12, v0
+    vsha2ms.vv v8, v28, v4  # Generate W[55:52]
+    #--------------------------------------------------------------------------------
+    # Quad-round 10 (+2, v12->v16->v4->v8)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v12
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v4, v16, v0
+    vsha2ms.vv v12, v28, v8  # Generate W[59:56]
+    #--------------------------------------------------------------------------------
+    # Quad-round 11 (+3, v16->v4->v8->v12)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v16
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v8, v4, v0
+    vsha2ms.vv v16, v28, v12  # Generate W[63:60]
+    #--------------------------------------------------------------------------------
+    # Quad-round 12 (+0, v4->v8->v12->v16)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v4
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v12, v8, v0
+    vsha2ms.vv v4, v28, v16  # Generate W[67:64]
+    #--------------------------------------------------------------------------------
+    # Quad-round 13 (+1, v8->v12->v16->v4)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v8
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v16, v12, v0
+    vsha2ms.vv v8, v28, v4  # Generate W[71:68]
+    #--------------------------------------------------------------------------------
+    # Quad-round 14 (+2, v12->v16->v4->v8)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v12
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v4, v16, v0
+    vsha2ms.vv v12, v28, v8  # Generate W[75:72]
+    #--------------------------------------------------------------------------------
+    # Quad-round 15 (+3, v16->v4->v8->v12)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v16
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v8, v4, v0
+    vsha2ms.vv v16, v28, v12  # Generate W[79:76]
+    #--------------------------------------------------------------------------------
+    # Quad-round 16 (+0, v4->v8->v12->v16)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v4
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    #--------------------------------------------------------------------------------
+    # Quad-round 17 (+1, v8->v12->v16->v4)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v8
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    #--------------------------------------------------------------------------------
+    # Quad-round 18 (+2, v12->v16->v4->v8)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v12
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    #--------------------------------------------------------------------------------
+    # Quad-round 19 (+3, v16->v4->v8->v12)
+    vle64.v v28, (t0)
+    vadd.vv v28, v28, v16
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+
+    #--------------------------------------------------------------------------------
+    # H' = H+{a',b',c',...,h'}, with H re-read from memory.
+    vle64.v v28, (a0)
+    vadd.vv v20, v28, v20
+    vle64.v v28, (t1)
+    vadd.vv v24, v28, v24
+
+    # Save the hash
+    vse64.v v20, (a0)   # {a',b',e',f'}
+    vse64.v v24, (t1)   # {c',d',g',h'}
+
+    ret
+
+# sha512_block_lmul4
+
+# sha256_blocks_lmul1
+#
+# Hashes 'nblocks' consecutive 64 bytes blocks, updating 'hash'.
+#
+# hash: current H value in "native" representation, with every uint32_t
+#       word in little-endian order, see sha256_block_lmul1.
+# data: pointer to the bytes to be hashed, nblocks * 64 bytes.
+#
+# Unlike sha256_block_lmul1, which is called once per block, the hash value
+# is loaded once and kept in v16/v17 across blocks, and the 64 round
+# constants are loaded once in v1-v8 and v18-v25. The hash value is written
+# back once, after the last block.
+#
+# Minimum VLEN: 128 bits.
+#
+# C/C++ Signature
+#  extern "C" void
+#  sha256_blocks_lmul1(
+#      uint32_t hash[8],   // a0
+#      const void* data,   // a1
+#      uint64_t nblocks    // a2
+#  );
+#
+.balign 4
+.global sha256_blocks_lmul1
+sha256_blocks_lmul1:
+
+    # Register use in this function, see sha256_block_lmul1 for details:
+    #  v10 - v13: message schedule words (Wt)
+    #  v16 - v17: working state variables, {a,b,e,f} and {c,d,g,h}
+    #  v26 - v27: the hash value at the start of the current block
+    #  v1 - v8, v18 - v25: round constants, 4 per register
+    #  v14: temporary, Wt+Kt
+    #  v0: mask for vmerge
+    #  t1: address of the second half of `hash`
+
+    beqz a2, 2f
+
+    vsetivli x0, 4, e32, m1, ta, ma
+
+    # Load the round constants, once for all blocks.
+    la t0, SHA256_ROUND_CONSTANTS
+    vle32.v v1, (t0)
+    addi t0, t0, 16
+    vle32.v v2, (t0)
+    addi t0, t0, 16
+    vle32.v v3, (t0)
+    addi t0, t0, 16
+    vle32.v v4, (t0)
+    addi t0, t0, 16
+    vle32.v v5, (t0)
+    addi t0, t0, 16
+    vle32.v v6, (t0)
+    addi t0, t0, 16
+    vle32.v v7, (t0)
+    addi t0, t0, 16
+    vle32.v v8, (t0)
+    addi t0, t0, 16
+    vle32.v v18, (t0)
+    addi t0, t0, 16
+    vle32.v v19, (t0)
+    addi t0, t0, 16
+    vle32.v v20, (t0)
+    addi t0, t0, 16
+    vle32.v v21, (t0)
+    addi t0, t0, 16
+    vle32.v v22, (t0)
+    addi t0, t0, 16
+    vle32.v v23, (t0)
+    addi t0, t0, 16
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vle32.v v25, (t0)
+
+    # Load H, as {f,e,b,a} and {h,g,d,c}.
+    vle32.v v16, (a0)
+    addi t1, a0, 16
+    vle32.v v17, (t1)
+
+    # Set v0 up for the vmerge that replaces the first word (idx==0)
+    vid.v v0
+    vmseq.vi v0, v0, 0x0    # v0.mask[i] = (i == 0 ? 1 : 0)
+
+1:
+    # Load the 512-bits of the message block in v10-v13 and perform
+    # an endian swap on each 4 bytes element.
+    vle32.v v10, (a1)
+    vrev8.v v10, v10
+    addi a1, a1, 16
+    vle32.v v11, (a1)
+    vrev8.v v11, v11
+    addi a1, a1, 16
+    vle32.v v12, (a1)
+    vrev8.v v12, v12
+    addi a1, a1, 16
+    vle32.v v13, (a1)
+    vrev8.v v13, v13
+    addi a1, a1, 16
+
+    # Capture the H values at the start of the block, H' = H+{a',b',...,h'}.
+    vmv.v.v v26, v16
+    vmv.v.v v27, v17
+
+    #--------------------------------------------------------------------------------
+    # Quad-round 0 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v1, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13  # Generate W[19:16]
+    #--------------------------------------------------------------------------------
+    # Quad-round 1 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v2, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10  # Generate W[23:20]
+    #--------------------------------------------------------------------------------
+    # Quad-round 2 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v3, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11  # Generate W[27:24]
+    #--------------------------------------------------------------------------------
+    # Quad-round 3 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v4, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12  # Generate W[31:28]
+    #--------------------------------------------------------------------------------
+    # Quad-round 4 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v5, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13  # Generate W[35:32]
+    #--------------------------------------------------------------------------------
+    # Quad-round 5 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v6, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10  # Generate W[39:36]
+    #--------------------------------------------------------------------------------
+    # Quad-round 6 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v7, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11  # Generate W[43:40]
+    #--------------------------------------------------------------------------------
+    # Quad-round 7 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v8, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12  # Generate W[47:44]
+    #--------------------------------------------------------------------------------
+    # Quad-round 8 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v18, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13  # Generate W[51:48]
+    #--------------------------------------------------------------------------------
+    # Quad-round 9 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v19, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10  # Generate W[55:52]
+    #--------------------------------------------------------------------------------
+    # Quad-round 10 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v20, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11  # Generate W[59:56]
+    #--------------------------------------------------------------------------------
+    # Quad-round 11 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v21, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12  # Generate W[63:60]
+    #--------------------------------------------------------------------------------
+    # Quad-round 12 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v22, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    #--------------------------------------------------------------------------------
+    # Quad-round 13 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v23, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    #--------------------------------------------------------------------------------
+    # Quad-round 14 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v24, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    #--------------------------------------------------------------------------------
+    # Quad-round 15 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v25, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+
+    #--------------------------------------------------------------------------------
+    # H' = H+{a',b',c',...,h'}
+    vadd.vv v16, v26, v16
+    vadd.vv v17, v27, v17
+
+    addi a2, a2, -1
+    bnez a2, 1b
+
+    # Save the hash
+    vse32.v v16, (a0)   # {a',b',e',f'}
+    vse32.v v17, (t1)   # {c',d',g',h'}
+
+2:
+    ret
+
+# sha256_blocks_lmul1
+
+
+# sha512_blocks_lmul1
+#
+# Hashes 'nblocks' consecutive 128 bytes blocks, updating 'hash'.
+#
+# hash: current H value in "native" representation, with every uint64_t
+#       word in little-endian order, see sha512_block_lmul1.
+# data: pointer to the bytes to be hashed, nblocks * 128 bytes.
+#
+# Unlike sha512_block_lmul1, which is called once per block, the hash value
+# is loaded once and kept in v16/v17 across blocks, and the 80 round
+# constants are loaded once in v1-v9, v18-v25 and v28-v30. The hash value
+# is written back once, after the last block.
+#
+# Minimum VLEN: 256 bits.
+#
+# C/C++ Signature
+#  extern "C" void
+#  sha512_blocks_lmul1(
+#      uint64_t hash[8],   // a0
+#      const void* data,   // a1
+#      uint64_t nblocks    // a2
+#  );
+#
+.balign 4
+.global sha512_blocks_lmul1
+sha512_blocks_lmul1:
+
+    # Register use in this function, see sha512_block_lmul1 for details:
+    #  v10 - v13: message schedule words (Wt)
+    #  v16 - v17: working state variables, {a,b,e,f} and {c,d,g,h}
+    #  v26 - v27: the hash value at the start of the current block
+    #  v1 - v9, v18 - v25, v28 - v30: round constants, 4 per register
+    #  v14: temporary, Wt+Kt
+    #  v0: mask for vmerge
+    #  t1: address of the second half of `hash`
+
+    beqz a2, 2f
+
+    vsetivli x0, 4, e64, m1, ta, ma
+
+    # Load the round constants, once for all blocks.
+    la t0, SHA512_ROUND_CONSTANTS
+    vle64.v v1, (t0)
+    addi t0, t0, 32
+    vle64.v v2, (t0)
+    addi t0, t0, 32
+    vle64.v v3, (t0)
+    addi t0, t0, 32
+    vle64.v v4, (t0)
+    addi t0, t0, 32
+    vle64.v v5, (t0)
+    addi t0, t0, 32
+    vle64.v v6, (t0)
+    addi t0, t0, 32
+    vle64.v v7, (t0)
+    addi t0, t0, 32
+    vle64.v v8, (t0)
+    addi t0, t0, 32
+    vle64.v v9, (t0)
+    addi t0, t0, 32
+    vle64.v v18, (t0)
+    addi t0, t0, 32
+    vle64.v v19, (t0)
+    addi t0, t0, 32
+    vle64.v v20, (t0)
+    addi t0, t0, 32
+    vle64.v v21, (t0)
+    addi t0, t0, 32
+    vle64.v v22, (t0)
+    addi t0, t0, 32
+    vle64.v v23, (t0)
+    addi t0, t0, 32
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vle64.v v25, (t0)
+    addi t0, t0, 32
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vle64.v v29, (t0)
+    addi t0, t0, 32
+    vle64.v v30, (t0)
+
+    # Load H, as {f,e,b,a} and {h,g,d,c}.
+    vle64.v v16, (a0)
+    addi t1, a0, 32
+    vle64.v v17, (t1)
+
+    # Set v0 up for the vmerge that replaces the first word (idx==0)
+    vid.v v0
+    vmseq.vi v0, v0, 0x0    # v0.mask[i] = (i == 0 ? 1 : 0)
+
+1:
+    # Load the 1024-bits of the message block in v10-v13 and perform
+    # an endian swap on each 8 bytes element.
+    vle64.v v10, (a1)
+    vrev8.v v10, v10
+    addi a1, a1, 32
+    vle64.v v11, (a1)
+    vrev8.v v11, v11
+    addi a1, a1, 32
+    vle64.v v12, (a1)
+    vrev8.v v12, v12
+    addi a1, a1, 32
+    vle64.v v13, (a1)
+    vrev8.v v13, v13
+    addi a1, a1, 32
+
+    # Capture the H values at the start of the block, H' = H+{a',b',...,h'}.
+    vmv.v.v v26, v16
+    vmv.v.v v27, v17
+
+    #--------------------------------------------------------------------------------
+    # Quad-round 0 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v1, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13  # Generate W[19:16]
+    #--------------------------------------------------------------------------------
+    # Quad-round 1 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v2, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10  # Generate W[23:20]
+    #--------------------------------------------------------------------------------
+    # Quad-round 2 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v3, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11  # Generate W[27:24]
+    #--------------------------------------------------------------------------------
+    # Quad-round 3 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v4, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12  # Generate W[31:28]
+    #--------------------------------------------------------------------------------
+    # Quad-round 4 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v5, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13  # Generate W[35:32]
+    #--------------------------------------------------------------------------------
+    # Quad-round 5 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v6, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10  # Generate W[39:36]
+    #--------------------------------------------------------------------------------
+    # Quad-round 6 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v7, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11  # Generate W[43:40]
+    #--------------------------------------------------------------------------------
+    # Quad-round 7 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v8, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12  # Generate W[47:44]
+    #--------------------------------------------------------------------------------
+    # Quad-round 8 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v9, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13  # Generate W[51:48]
+    #--------------------------------------------------------------------------------
+    # Quad-round 9 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v18, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10  # Generate W[55:52]
+    #--------------------------------------------------------------------------------
+    # Quad-round 10 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v19, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11  # Generate W[59:56]
+    #--------------------------------------------------------------------------------
+    # Quad-round 11 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v20, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12  # Generate W[63:60]
+    #--------------------------------------------------------------------------------
+    # Quad-round 12 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v21, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13  # Generate W[67:64]
+    #--------------------------------------------------------------------------------
+    # Quad-round 13 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v22, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10  # Generate W[71:68]
+    #--------------------------------------------------------------------------------
+    # Quad-round 14 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v23, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11  # Generate W[75:72]
+    #--------------------------------------------------------------------------------
+    # Quad-round 15 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v24, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12  # Generate W[79:76]
+    #--------------------------------------------------------------------------------
+    # Quad-round 16 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v25, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    #--------------------------------------------------------------------------------
+    # Quad-round 17 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v28, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    #--------------------------------------------------------------------------------
+    # Quad-round 18 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v29, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    #--------------------------------------------------------------------------------
+    # Quad-round 19 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v30, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+
+    #--------------------------------------------------------------------------------
+    # H' = H+{a',b',c',...,h'}
+    vadd.vv v16, v26, v16
+    vadd.vv v17, v27, v17
+
+    addi a2, a2, -1
+    bnez a2, 1b
+
+    # Save the hash
+    vse64.v v16, (a0)   # {a',b',e',f'}
+    vse64.v v17, (t1)   # {c',d',g',h'}
+
+2:
+    ret
+
+# sha512_blocks_lmul1
+
+
+# sha512_blocks_lmul2
+#
+# Hashes 'nblocks' consecutive 128 bytes blocks, updating 'hash'.
+#
+# hash: current H value in "native" representation, with every uint64_t
+#       word in little-endian order, see sha512_block_lmul2.
+# data: pointer to the bytes to be hashed, nblocks * 128 bytes.
+#
+# Unlike sha512_block_lmul2, which is called once per block, the hash value
+# is loaded once and kept in v18/v20 across blocks, and written back once,
+# after the last block. With LMUL=2 the 20 register groups needed for the
+# round constants do not fit in the register file, they are still loaded
+# from memory (and the cache) for every block.
+#
+# Minimum VLEN: 128 bits.
+#
+# C/C++ Signature
+#  extern "C" void
+#  sha512_blocks_lmul2(
+#      uint64_t hash[8],   // a0
+#      const void* data,   // a1
+#      uint64_t nblocks    // a2
+#  );
+#
+.balign 4
+.global sha512_blocks_lmul2
+sha512_blocks_lmul2:
+
+    # Register use in this function, see sha512_block_lmul2 for details:
+    #  v10 - v16: message schedule words (Wt), register groups v10, v12,
+    #             v14, v16
+    #  v18 - v20: working state variables, {a,b,e,f} and {c,d,g,h}
+    #  v28 - v30: the hash value at the start of the current block
+    #  v24: round constants Kt
+    #  v22: temporary, Wt+Kt
+    #  v0: mask for vmerge
+    #  t1: address of the second half of `hash`
+
+    beqz a2, 2f
+
+    vsetivli x0, 4, e64, m2, ta, ma
+
+    # Load H, as {f,e,b,a} and {h,g,d,c}.
+    vle64.v v18, (a0)
+    addi t1, a0, 32
+    vle64.v v20, (t1)
+
+    # Set v0 up for the vmerge that replaces the first word (idx==0)
+    vid.v v0
+    vmseq.vi v0, v0, 0x0    # v0.mask[i] = (i == 0 ? 1 : 0)
+
+1:
+    # Load the 1024-bits of the message block in v10-v16 and perform
+    # an endian swap on each 8 bytes element.
+    vle64.v v10, (a1)
+    vrev8.v v10, v10
+    addi a1, a1, 32
+    vle64.v v12, (a1)
+    vrev8.v v12, v12
+    addi a1, a1, 32
+    vle64.v v14, (a1)
+    vrev8.v v14, v14
+    addi a1, a1, 32
+    vle64.v v16, (a1)
+    vrev8.v v16, v16
+    addi a1, a1, 32
+
+    # Capture the H values at the start of the block, H' = H+{a',b',...,h'}.
+    vmv.v.v v28, v18
+    vmv.v.v v30, v20
+
+    # t0 tracks round constants.
+    la t0, SHA512_ROUND_CONSTANTS
+
+    #--------------------------------------------------------------------------------
+    # Quad-round 0 (+0, v10->v12->v14->v16)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v10
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v14, v12, v0
+    vsha2ms.vv v10, v22, v16  # Generate W[19:16]
+    #--------------------------------------------------------------------------------
+    # Quad-round 1 (+1, v12->v14->v16->v10)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v12
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v16, v14, v0
+    vsha2ms.vv v12, v22, v10  # Generate W[23:20]
+    #--------------------------------------------------------------------------------
+    # Quad-round 2 (+2, v14->v16->v10->v12)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v14
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v10, v16, v0
+    vsha2ms.vv v14, v22, v12  # Generate W[27:24]
+    #--------------------------------------------------------------------------------
+    # Quad-round 3 (+3, v16->v10->v12->v14)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v16
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v12, v10, v0
+    vsha2ms.vv v16, v22, v14  # Generate W[31:28]
+    #--------------------------------------------------------------------------------
+    # Quad-round 4 (+0, v10->v12->v14->v16)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v10
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v14, v12, v0
+    vsha2ms.vv v10, v22, v16  # Generate W[35:32]
+    #--------------------------------------------------------------------------------
+    # Quad-round 5 (+1, v12->v14->v16->v10)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v12
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v16, v14, v0
+    vsha2ms.vv v12, v22, v10  # Generate W[39:36]
+    #--------------------------------------------------------------------------------
+    # Quad-round 6 (+2, v14->v16->v10->v12)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v14
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v10, v16, v0
+    vsha2ms.vv v14, v22, v12  # Generate W[43:40]
+    #--------------------------------------------------------------------------------
+    # Quad-round 7 (+3, v16->v10->v12->v14)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v16
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v12, v10, v0
+    vsha2ms.vv v16, v22, v14  # Generate W[47:44]
+    #--------------------------------------------------------------------------------
+    # Quad-round 8 (+0, v10->v12->v14->v16)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v10
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v14, v12, v0
+    vsha2ms.vv v10, v22, v16  # Generate W[51:48]
+    #--------------------------------------------------------------------------------
+    # Quad-round 9 (+1, v12->v14->v16->v10)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v12
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v16, v14, v0
+    vsha2ms.vv v12, v22, v10  # Generate W[55:52]
+    #--------------------------------------------------------------------------------
+    # Quad-round 10 (+2, v14->v16->v10->v12)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v14
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v10, v16, v0
+    vsha2ms.vv v14, v22, v12  # Generate W[59:56]
+    #--------------------------------------------------------------------------------
+    # Quad-round 11 (+3, v16->v10->v12->v14)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v16
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v12, v10, v0
+    vsha2ms.vv v16, v22, v14  # Generate W[63:60]
+    #--------------------------------------------------------------------------------
+    # Quad-round 12 (+0, v10->v12->v14->v16)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v10
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v14, v12, v0
+    vsha2ms.vv v10, v22, v16  # Generate W[67:64]
+    #--------------------------------------------------------------------------------
+    # Quad-round 13 (+1, v12->v14->v16->v10)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v12
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v16, v14, v0
+    vsha2ms.vv v12, v22, v10  # Generate W[71:68]
+    #--------------------------------------------------------------------------------
+    # Quad-round 14 (+2, v14->v16->v10->v12)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v14
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v10, v16, v0
+    vsha2ms.vv v14, v22, v12  # Generate W[75:72]
+    #--------------------------------------------------------------------------------
+    # Quad-round 15 (+3, v16->v10->v12->v14)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v16
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v12, v10, v0
+    vsha2ms.vv v16, v22, v14  # Generate W[79:76]
+    #--------------------------------------------------------------------------------
+    # Quad-round 16 (+0, v10->v12->v14->v16)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v10
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    #--------------------------------------------------------------------------------
+    # Quad-round 17 (+1, v12->v14->v16->v10)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v12
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    #--------------------------------------------------------------------------------
+    # Quad-round 18 (+2, v14->v16->v10->v12)
+    vle64.v v24, (t0)
+    addi t0, t0, 32
+    vadd.vv v22, v24, v14
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    #--------------------------------------------------------------------------------
+    # Quad-round 19 (+3, v16->v10->v12->v14)
+    vle64.v v24, (t0)
+    vadd.vv v22, v24, v16
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+
+    #--------------------------------------------------------------------------------
+    # H' = H+{a',b',c',...,h'}
+    vadd.vv v18, v28, v18
+    vadd.vv v20, v30, v20
+
+    addi a2, a2, -1
+    bnez a2, 1b
+
+    # Save the hash
+    vse64.v v18, (a0)   # {a',b',e',f'}
+    vse64.v v20, (t1)   # {c',d',g',h'}
+
+2:
+    ret
+
+# sha512_blocks_lmul2
+
+# sha256_blocks_lmul2
+#
+# Pretty much identical to sha256_blocks_lmul1 but using LMUL=2, see
+# sha256_block_lmul2. The round constants do not fit in the register file
+# with LMUL=2, they are loaded from memory (and the cache) for every block.
+#
+# Minimum VLEN: 64 bits.
+#
+# C/C++ Signature
+#  extern "C" void
+#  sha256_blocks_lmul2(
+#      uint32_t hash[8],   // a0
+#      const void* data,   // a1
+#      uint64_t nblocks    // a2
+#  );
+#
+.balign 4
+.global sha256_blocks_lmul2
+sha256_blocks_lmul2:
+
+    # Register use in this function:
+    #  v10 - v16: message schedule words (Wt), register groups v10, v12,
+    #             v14, v16
+    #  v18 - v20: working state variables, {a,b,e,f} and {c,d,g,h}
+    #  v28 - v30: the hash value at the start of the current block
+    #  v24: round constants Kt
+    #  v22: temporary, Wt+Kt
+    #  v0: mask for vmerge
+    #  t1: address of the second half of `hash`
+
+    beqz a2, 2f
+
+    vsetivli x0, 4, e32, m2, ta, ma
+
+    # Load H, as {f,e,b,a} and {h,g,d,c}.
+    vle32.v v18, (a0)
+    addi t1, a0, 16
+    vle32.v v20, (t1)
+
+    # Set v0 up for the vmerge that replaces the first word (idx==0)
+    vid.v v0
+    vmseq.vi v0, v0, 0x0    # v0.mask[i] = (i == 0 ? 1 : 0)
+
+1:
+    # Load the 512-bits of the message block in v10-v16 and perform
+    # an endian swap on each 4 bytes element.
+    vle32.v v10, (a1)
+    vrev8.v v10, v10
+    addi a1, a1, 16
+    vle32.v v12, (a1)
+    vrev8.v v12, v12
+    addi a1, a1, 16
+    vle32.v v14, (a1)
+    vrev8.v v14, v14
+    addi a1, a1, 16
+    vle32.v v16, (a1)
+    vrev8.v v16, v16
+    addi a1, a1, 16
+
+    # Capture the H values at the start of the block, H' = H+{a',b',...,h'}.
+    vmv.v.v v28, v18
+    vmv.v.v v30, v20
+
+    # t0 tracks round constants.
+    la t0, SHA256_ROUND_CONSTANTS
+
+    #--------------------------------------------------------------------------------
+    # Quad-round 0 (+0, v10->v12->v14->v16)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v10
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v14, v12, v0
+    vsha2ms.vv v10, v22, v16  # Generate W[19:16]
+    #--------------------------------------------------------------------------------
+    # Quad-round 1 (+1, v12->v14->v16->v10)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v12
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v16, v14, v0
+    vsha2ms.vv v12, v22, v10  # Generate W[23:20]
+    #--------------------------------------------------------------------------------
+    # Quad-round 2 (+2, v14->v16->v10->v12)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v14
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v10, v16, v0
+    vsha2ms.vv v14, v22, v12  # Generate W[27:24]
+    #--------------------------------------------------------------------------------
+    # Quad-round 3 (+3, v16->v10->v12->v14)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v16
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v12, v10, v0
+    vsha2ms.vv v16, v22, v14  # Generate W[31:28]
+    #--------------------------------------------------------------------------------
+    # Quad-round 4 (+0, v10->v12->v14->v16)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v10
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v14, v12, v0
+    vsha2ms.vv v10, v22, v16  # Generate W[35:32]
+    #--------------------------------------------------------------------------------
+    # Quad-round 5 (+1, v12->v14->v16->v10)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v12
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v16, v14, v0
+    vsha2ms.vv v12, v22, v10  # Generate W[39:36]
+    #--------------------------------------------------------------------------------
+    # Quad-round 6 (+2, v14->v16->v10->v12)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v14
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v10, v16, v0
+    vsha2ms.vv v14, v22, v12  # Generate W[43:40]
+    #--------------------------------------------------------------------------------
+    # Quad-round 7 (+3, v16->v10->v12->v14)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v16
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v12, v10, v0
+    vsha2ms.vv v16, v22, v14  # Generate W[47:44]
+    #--------------------------------------------------------------------------------
+    # Quad-round 8 (+0, v10->v12->v14->v16)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v10
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v14, v12, v0
+    vsha2ms.vv v10, v22, v16  # Generate W[51:48]
+    #--------------------------------------------------------------------------------
+    # Quad-round 9 (+1, v12->v14->v16->v10)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v12
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v16, v14, v0
+    vsha2ms.vv v12, v22, v10  # Generate W[55:52]
+    #--------------------------------------------------------------------------------
+    # Quad-round 10 (+2, v14->v16->v10->v12)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v14
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v10, v16, v0
+    vsha2ms.vv v14, v22, v12  # Generate W[59:56]
+    #--------------------------------------------------------------------------------
+    # Quad-round 11 (+3, v16->v10->v12->v14)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v16
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    vmerge.vvm v22, v12, v10, v0
+    vsha2ms.vv v16, v22, v14  # Generate W[63:60]
+    #--------------------------------------------------------------------------------
+    # Quad-round 12 (+0, v10->v12->v14->v16)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v10
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    #--------------------------------------------------------------------------------
+    # Quad-round 13 (+1, v12->v14->v16->v10)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v12
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    #--------------------------------------------------------------------------------
+    # Quad-round 14 (+2, v14->v16->v10->v12)
+    vle32.v v24, (t0)
+    addi t0, t0, 16
+    vadd.vv v22, v24, v14
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+    #--------------------------------------------------------------------------------
+    # Quad-round 15 (+3, v16->v10->v12->v14)
+    vle32.v v24, (t0)
+    vadd.vv v22, v24, v16
+    vsha2cl.vv v20, v18, v22
+    vsha2ch.vv v18, v20, v22
+
+    #--------------------------------------------------------------------------------
+    # H' = H+{a',b',c',...,h'}
+    vadd.vv v18, v28, v18
+    vadd.vv v20, v30, v20
+
+    addi a2, a2, -1
+    bnez a2, 1b
+
+    # Save the hash
+    vse32.v v18, (a0)   # {a',b',e',f'}
+    vse32.v v20, (t1)   # {c',d',g',h'}
+
+2:
+    ret
+
+# sha256_blocks_lmul2
+
+# sha512_blocks_lmul4
+#
+# Pretty much identical to sha512_blocks_lmul2 but using LMUL=4, see
+# sha512_block_lmul4. As there is no room for the hash value at the
+# start of the block, the running hash value is written back to `hash`
+# after every block and re-read from there to compute H'.
+#
+# Minimum VLEN: 64 bits.
+#
+# C/C++ Signature
+#  extern "C" void
+#  sha512_blocks_lmul4(
+#      uint64_t hash[8],   // a0
+#      const void* data,   // a1
+#      uint64_t nblocks    // a2
+#  );
+#
+.balign 4
+.global sha512_blocks_lmul4
+sha512_blocks_lmul4:
+
+    # Register use in this function:
+    #  v4 - v16: message schedule words (Wt), register groups v4, v8,
+    #            v12, v16
+    #  v20 - v24: working state variables, {a,b,e,f} and {c,d,g,h}
+    #  v28: temporary, Kt then Wt+Kt, and the vmerge result
+    #  v0: mask for vmerge
+    #  t1: address of the second half of `hash`
+
+    beqz a2, 2f
+
+    vsetivli x0, 4, e64, m4, ta, ma
+
+    addi t1, a0, 32
+
+    # Set v0 up for the vmerge that replaces the first word (idx==0)
+    vid.v v0
+    vmseq.vi v0, v0, 0x0    # v0.mask[i] = (i == 0 ? 1 : 0)
+
+1:
+    # Load the 1024-bits of the message block in v4-v16 and perform
+    # an endian swap on each 8 bytes element.
+    vle64.v v4, (a1)
+    vrev8.v v4, v4
+    addi a1, a1, 32
+    vle64.v v8, (a1)
+    vrev8.v v8, v8
+    addi a1, a1, 32
+    vle64.v v12, (a1)
+    vrev8.v v12, v12
+    addi a1, a1, 32
+    vle64.v v16, (a1)
+    vrev8.v v16, v16
+    addi a1, a1, 32
+
+    # Load H, as {f,e,b,a} and {h,g,d,c}.
+    vle64.v v20, (a0)
+    vle64.v v24, (t1)
+
+    # t0 tracks round constants.
+    la t0, SHA512_ROUND_CONSTANTS
+
+    #--------------------------------------------------------------------------------
+    # Quad-round 0 (+0, v4->v8->v12->v16)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v4
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v12, v8, v0
+    vsha2ms.vv v4, v28, v16  # Generate W[19:16]
+    #--------------------------------------------------------------------------------
+    # Quad-round 1 (+1, v8->v12->v16->v4)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v8
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v16, v12, v0
+    vsha2ms.vv v8, v28, v4  # Generate W[23:20]
+    #--------------------------------------------------------------------------------
+    # Quad-round 2 (+2, v12->v16->v4->v8)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v12
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v4, v16, v0
+    vsha2ms.vv v12, v28, v8  # Generate W[27:24]
+    #--------------------------------------------------------------------------------
+    # Quad-round 3 (+3, v16->v4->v8->v12)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v16
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v8, v4, v0
+    vsha2ms.vv v16, v28, v12  # Generate W[31:28]
+    #--------------------------------------------------------------------------------
+    # Quad-round 4 (+0, v4->v8->v12->v16)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v4
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v12, v8, v0
+    vsha2ms.vv v4, v28, v16  # Generate W[35:32]
+    #--------------------------------------------------------------------------------
+    # Quad-round 5 (+1, v8->v12->v16->v4)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v8
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v16, v12, v0
+    vsha2ms.vv v8, v28, v4  # Generate W[39:36]
+    #--------------------------------------------------------------------------------
+    # Quad-round 6 (+2, v12->v16->v4->v8)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v12
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v4, v16, v0
+    vsha2ms.vv v12, v28, v8  # Generate W[43:40]
+    #--------------------------------------------------------------------------------
+    # Quad-round 7 (+3, v16->v4->v8->v12)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v16
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v8, v4, v0
+    vsha2ms.vv v16, v28, v12  # Generate W[47:44]
+    #--------------------------------------------------------------------------------
+    # Quad-round 8 (+0, v4->v8->v12->v16)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v4
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v12, v8, v0
+    vsha2ms.vv v4, v28, v16  # Generate W[51:48]
+    #--------------------------------------------------------------------------------
+    # Quad-round 9 (+1, v8->v12->v16->v4)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v8
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v16, v12, v0
+    vsha2ms.vv v8, v28, v4  # Generate W[55:52]
+    #--------------------------------------------------------------------------------
+    # Quad-round 10 (+2, v12->v16->v4->v8)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v12
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v4, v16, v0
+    vsha2ms.vv v12, v28, v8  # Generate W[59:56]
+    #--------------------------------------------------------------------------------
+    # Quad-round 11 (+3, v16->v4->v8->v12)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v16
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v8, v4, v0
+    vsha2ms.vv v16, v28, v12  # Generate W[63:60]
+    #--------------------------------------------------------------------------------
+    # Quad-round 12 (+0, v4->v8->v12->v16)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v4
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v12, v8, v0
+    vsha2ms.vv v4, v28, v16  # Generate W[67:64]
+    #--------------------------------------------------------------------------------
+    # Quad-round 13 (+1, v8->v12->v16->v4)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v8
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v16, v12, v0
+    vsha2ms.vv v8, v28, v4  # Generate W[71:68]
+    #--------------------------------------------------------------------------------
+    # Quad-round 14 (+2, v12->v16->v4->v8)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v12
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v4, v16, v0
+    vsha2ms.vv v12, v28, v8  # Generate W[75:72]
+    #--------------------------------------------------------------------------------
+    # Quad-round 15 (+3, v16->v4->v8->v12)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v16
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    vmerge.vvm v28, v8, v4, v0
+    vsha2ms.vv v16, v28, v12  # Generate W[79:76]
+    #--------------------------------------------------------------------------------
+    # Quad-round 16 (+0, v4->v8->v12->v16)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v4
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    #--------------------------------------------------------------------------------
+    # Quad-round 17 (+1, v8->v12->v16->v4)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v8
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    #--------------------------------------------------------------------------------
+    # Quad-round 18 (+2, v12->v16->v4->v8)
+    vle64.v v28, (t0)
+    addi t0, t0, 32
+    vadd.vv v28, v28, v12
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+    #--------------------------------------------------------------------------------
+    # Quad-round 19 (+3, v16->v4->v8->v12)
+    vle64.v v28, (t0)
+    vadd.vv v28, v28, v16
+    vsha2cl.vv v24, v20, v28
+    vsha2ch.vv v20, v24, v28
+
+    #--------------------------------------------------------------------------------
+    # H' = H+{a',b',c',...,h'}, with H re-read from memory.
+    vle64.v v28, (a0)
+    vadd.vv v20, v28, v20
+    vle64.v v28, (t1)
+    vadd.vv v24, v28, v24
+
+    # Save the hash
+    vse64.v v20, (a0)   # {a',b',e',f'}
+    vse64.v v24, (t1)   # {c',d',g',h'}
+
+    addi a2, a2, -1
+    bnez a2, 1b
+
+2:
+    ret
+
+# sha512_blocks_lmul4
+
+######################################################################
+# Multi-Buffer Routines
+######################################################################
+
+# sha256_multi_blocks_lmul1
+#
+# Hashes 'nlanes' independent messages in lockstep, one message per element
+# group: group 'i' of the state and message schedule registers holds the
+# values of message 'i'. A single vsha2ms/vsha2c[hl] instruction thus
+# advances VLEN/128 messages at once. Messages beyond VLEN/128 are processed
+# in successive batches.
+#
+# states: nlanes hash values, 8 uint32_t each, in the "native"
+#         representation of sha256_block_lmul1.
+# ptrs: nlanes pointers to the blocks of each message.
+# counts: nlanes uint32_t, number of 64 bytes blocks to hash for each
+#         message.
+#
+# Messages may have different numbers of blocks. A message for which all
+# blocks have been hashed is masked out: its blocks are not loaded, and its
+# hash value is left unchanged by the following blocks of the other
+# messages. The batch ends when all its messages are done.
+#
+# The message blocks are loaded with indexed loads (vluxei64), using
+# per-element addresses, and the states with indexed loads/stores
+# (vluxei32/vsuxei32) using offsets relative to 'states'. The round
+# constants are replicated across all element groups and loaded once
+# in v1-v8 and v18-v25.
+#
+# Minimum VLEN: 128 bits.
+#
+# C/C++ Signature
+#  extern "C" void
+#  sha256_multi_blocks_lmul1(
+#      uint32_t* states,           // a0
+#      const void* const* ptrs,    // a1
+#      const uint32_t* counts,     // a2
+#      uint64_t nlanes             // a3
+#  );
+#
+.balign 4
+.global sha256_multi_blocks_lmul1
+sha256_multi_blocks_lmul1:
+
+    # Register use in this function:
+    #  v10 - v13: message schedule words (Wt), one message per group
+    #  v16 - v17: working state variables, {a,b,e,f} and {c,d,g,h}
+    #  v26 - v27: the hash values at the start of the current block
+    #  v1 - v8, v18 - v25: round constants, replicated in every group
+    #  v14: temporary, Wt+Kt
+    #  v15: mask for vmerge, copied in v0 during the rounds
+    #  v9: number of remaining blocks of each message
+    #  v28 - v29: address of the next block of each message, per element
+    #  v30: offsets of the state words, relative to 'states'
+    #  v0: mask of the messages still having blocks, or vmerge mask
+    #  t1: number of elements processed by the current batch
+
+    # t3 <- number of remaining 4B elements, 4 per message
+    slli t3, a3, 2
+    beqz t3, 2f
+
+    # Offsets in the (message) blocks.
+    li t4, 16
+    li t5, 32
+    li t6, 48
+    li a5, 64
+
+    # Load the round constants replicated in all element groups,
+    # using v14 = (i & 3) * 4 as offsets.
+    vsetvli t1, x0, e32, m1, ta, mu
+    vid.v v14
+    vand.vi v14, v14, 3
+    vsll.vi v14, v14, 2
+    la t0, SHA256_ROUND_CONSTANTS
+    vluxei32.v v1, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v2, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v3, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v4, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v5, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v6, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v7, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v8, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v18, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v19, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v20, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v21, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v22, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v23, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v24, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v25, (t0), v14
+
+1:
+    # Batch loop, processing t1/4 messages.
+    vsetvli t1, t3, e32, m1, ta, mu
+
+    # v15 <- vmerge mask, first word of each group, i.e., (i & 3) == 0
+    vid.v v14
+    vand.vi v14, v14, 3
+    vmseq.vi v15, v14, 0
+
+    # v30 <- offsets of the state words, 32 * (i >> 2) + 4 * (i & 3)
+    vid.v v30
+    vsrl.vi v30, v30, 2
+    vsll.vi v30, v30, 5
+    vsll.vi v14, v14, 2
+    vadd.vv v30, v30, v14
+
+    # Load the states, {f,e,b,a} in v16, {h,g,d,c} in v17.
+    vluxei32.v v16, (a0), v30
+    addi t2, a0, 16
+    vluxei32.v v17, (t2), v30
+
+    # v9 <- counts[i >> 2], using v14 = 4 * (i >> 2) as offsets.
+    vid.v v14
+    vsrl.vi v14, v14, 2
+    vsll.vi v14, v14, 2
+    vluxei32.v v9, (a2), v14
+
+    # v28 <- ptrs[i >> 2] + 4 * (i & 3), computed with 64b elements.
+    vsetvli x0, x0, e64, m2, ta, mu
+    vid.v v12
+    vsrl.vi v12, v12, 2
+    vsll.vi v12, v12, 3
+    vluxei64.v v28, (a1), v12
+    vid.v v12
+    vand.vi v12, v12, 3
+    vsll.vi v12, v12, 2
+    vadd.vv v28, v28, v12
+    vsetvli x0, x0, e32, m1, ta, mu
+
+3:
+    # Block loop. v0 <- messages still having blocks.
+    vmsne.vi v0, v9, 0
+    vcpop.m t2, v0
+    beqz t2, 4f
+
+    # Load the next 512-bits block of each active message in v10-v13,
+    # and perform an endian swap on each 4 bytes element.
+    vluxei64.v v10, (x0), v28, v0.t
+    vluxei64.v v11, (t4), v28, v0.t
+    vluxei64.v v12, (t5), v28, v0.t
+    vluxei64.v v13, (t6), v28, v0.t
+    vrev8.v v10, v10
+    vrev8.v v11, v11
+    vrev8.v v12, v12
+    vrev8.v v13, v13
+
+    # Capture the H values at the start of the block.
+    vmv.v.v v26, v16
+    vmv.v.v v27, v17
+
+    vmv1r.v v0, v15
+
+    # Quad-round 0 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v1, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 1 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v2, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 2 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v3, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 3 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v4, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 4 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v5, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 5 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v6, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 6 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v7, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 7 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v8, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 8 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v18, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 9 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v19, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 10 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v20, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 11 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v21, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 12 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v22, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 13 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v23, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 14 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v24, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 15 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v25, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+
+    # H' = H+{a',b',c',...,h'} for the active messages, H is unchanged
+    # for the others.
+    vmsne.vi v0, v9, 0
+    vadd.vv v26, v26, v16, v0.t
+    vadd.vv v27, v27, v17, v0.t
+    vmv.v.v v16, v26
+    vmv.v.v v17, v27
+    vadd.vi v9, v9, -1, v0.t
+
+    # Next block.
+    vsetvli x0, x0, e64, m2, ta, mu
+    vadd.vx v28, v28, a5
+    vsetvli x0, x0, e32, m1, ta, mu
+    j 3b
+
+4:
+    # Store the states.
+    vsuxei32.v v16, (a0), v30
+    addi t2, a0, 16
+    vsuxei32.v v17, (t2), v30
+
+    # t1 contains the number of 4B elements processed, 4 per message.
+    sub t3, t3, t1
+    slli t2, t1, 3              # 32 bytes of state per message
+    add a0, a0, t2
+    slli t2, t1, 1              # 8 bytes of pointer per message
+    add a1, a1, t2
+    add a2, a2, t1              # 4 bytes of count per message
+    bnez t3, 1b
+
+2:
+    ret
+
+# sha256_multi_blocks_lmul1
+
+
+# sha512_multi_blocks_lmul1
+#
+# SHA-512 variant of sha256_multi_blocks_lmul1, see above, hashing
+# VLEN/256 messages in lockstep.
+#
+# states: nlanes hash values, 8 uint64_t each, in the "native"
+#         representation of sha512_block_lmul1.
+# ptrs: nlanes pointers to the blocks of each message.
+# counts: nlanes uint64_t, number of 128 bytes blocks to hash for each
+#         message.
+#
+# The 20 register groups of round constants do not fit in the register
+# file alongside the per-message addresses and counts, they are loaded
+# in each quad-round, replicated across element groups with an indexed load.
+#
+# Minimum VLEN: 256 bits.
+#
+# C/C++ Signature
+#  extern "C" void
+#  sha512_multi_blocks_lmul1(
+#      uint64_t* states,           // a0
+#      const void* const* ptrs,    // a1
+#      const uint64_t* counts,     // a2
+#      uint64_t nlanes             // a3
+#  );
+#
+.balign 4
+.global sha512_multi_blocks_lmul1
+sha512_multi_blocks_lmul1:
+
+    # Register use in this function:
+    #  v10 - v13: message schedule words (Wt), one message per group
+    #  v16 - v17: working state variables, {a,b,e,f} and {c,d,g,h}
+    #  v26 - v27: the hash values at the start of the current block
+    #  v15: round constants Kt, replicated in every group
+    #  v14: temporary, Wt+Kt
+    #  v1: mask for vmerge, copied in v0 during the rounds
+    #  v2: number of remaining blocks of each message
+    #  v3: address of the next block of each message, per element
+    #  v4: offsets of the round constants, (i & 3) * 8
+    #  v5: offsets of the state words, relative to 'states'
+    #  v0: mask of the messages still having blocks, or vmerge mask
+    #  t1: number of elements processed by the current batch
+
+    # t3 <- number of remaining 8B elements, 4 per message
+    slli t3, a3, 2
+    beqz t3, 2f
+
+    # Offsets in the (message) blocks.
+    li t4, 32
+    li t5, 64
+    li t6, 96
+    li a5, 128
+
+1:
+    # Batch loop, processing t1/4 messages.
+    vsetvli t1, t3, e64, m1, ta, mu
+
+    # v1 <- vmerge mask, first word of each group, i.e., (i & 3) == 0
+    vid.v v4
+    vand.vi v4, v4, 3
+    vmseq.vi v1, v4, 0
+    # v4 <- offsets of the round constants, (i & 3) * 8
+    vsll.vi v4, v4, 3
+
+    # v5 <- offsets of the state words, 64 * (i >> 2) + 8 * (i & 3)
+    vid.v v5
+    vsrl.vi v5, v5, 2
+    vsll.vi v5, v5, 6
+    vadd.vv v5, v5, v4
+
+    # Load the states, {f,e,b,a} in v16, {h,g,d,c} in v17.
+    vluxei64.v v16, (a0), v5
+    addi t2, a0, 32
+    vluxei64.v v17, (t2), v5
+
+    # v2 <- counts[i >> 2]
+    vid.v v14
+    vsrl.vi v14, v14, 2
+    vsll.vi v14, v14, 3
+    vluxei64.v v2, (a2), v14
+
+    # v3 <- ptrs[i >> 2] + 8 * (i & 3)
+    vluxei64.v v3, (a1), v14
+    vadd.vv v3, v3, v4
+
+3:
+    # Block loop. v0 <- messages still having blocks.
+    vmsne.vi v0, v2, 0
+    vcpop.m t2, v0
+    beqz t2, 4f
+
+    # Load the next 1024-bits block of each active message in v10-v13,
+    # and perform an endian swap on each 8 bytes element.
+    vluxei64.v v10, (x0), v3, v0.t
+    vluxei64.v v11, (t4), v3, v0.t
+    vluxei64.v v12, (t5), v3, v0.t
+    vluxei64.v v13, (t6), v3, v0.t
+    vrev8.v v10, v10
+    vrev8.v v11, v11
+    vrev8.v v12, v12
+    vrev8.v v13, v13
+
+    # Capture the H values at the start of the block.
+    vmv.v.v v26, v16
+    vmv.v.v v27, v17
+
+    vmv1r.v v0, v1
+
+    # t0 tracks round constants.
+    la t0, SHA512_ROUND_CONSTANTS
+
+    # Quad-round 0 (+0, v10->v11->v12->v13)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 1 (+1, v11->v12->v13->v10)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 2 (+2, v12->v13->v10->v11)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 3 (+3, v13->v10->v11->v12)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 4 (+0, v10->v11->v12->v13)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 5 (+1, v11->v12->v13->v10)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 6 (+2, v12->v13->v10->v11)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 7 (+3, v13->v10->v11->v12)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 8 (+0, v10->v11->v12->v13)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 9 (+1, v11->v12->v13->v10)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 10 (+2, v12->v13->v10->v11)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 11 (+3, v13->v10->v11->v12)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 12 (+0, v10->v11->v12->v13)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 13 (+1, v11->v12->v13->v10)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 14 (+2, v12->v13->v10->v11)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 15 (+3, v13->v10->v11->v12)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 16 (+0, v10->v11->v12->v13)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 17 (+1, v11->v12->v13->v10)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 18 (+2, v12->v13->v10->v11)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 19 (+3, v13->v10->v11->v12)
+    vluxei64.v v15, (t0), v4
+    vadd.vv v14, v15, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+
+    # H' = H+{a',b',c',...,h'} for the active messages, H is unchanged
+    # for the others.
+    vmsne.vi v0, v2, 0
+    vadd.vv v26, v26, v16, v0.t
+    vadd.vv v27, v27, v17, v0.t
+    vmv.v.v v16, v26
+    vmv.v.v v17, v27
+    vadd.vi v2, v2, -1, v0.t
+
+    # Next block.
+    vadd.vx v3, v3, a5
+    j 3b
+
+4:
+    # Store the states.
+    vsuxei64.v v16, (a0), v5
+    addi t2, a0, 32
+    vsuxei64.v v17, (t2), v5
+
+    # t1 contains the number of 8B elements processed, 4 per message.
+    sub t3, t3, t1
+    slli t2, t1, 4              # 64 bytes of state per message
+    add a0, a0, t2
+    slli t2, t1, 1              # 8 bytes of pointer per message
+    add a1, a1, t2
+    add a2, a2, t2              # 8 bytes of count per message
+    bnez t3, 1b
+
+2:
+    ret
+
+# sha512_multi_blocks_lmul1
+
+
+######################################################################
+# PBKDF2 Routines
+######################################################################
+
+# sha256_pbkdf2_lmul1
+#
+# Runs the iterations of PBKDF2-HMAC-SHA-256 (RFC 8018) for 'nlanes'
+# independent lanes (e.g., candidate passwords) in lockstep, one lane per
+# element group, as in sha256_multi_blocks_lmul1.
+#
+# Each lane holds 4 hash values of 8 uint32_t, in the "native"
+# representation of sha256_block_lmul1:
+#  - inner: the hash value after the key^ipad block of HMAC,
+#  - outer: the hash value after the key^opad block of HMAC,
+#  - u: U_j, the last HMAC output,
+#  - t: T, the XOR of all the U_j values so far.
+#
+# Each iteration computes U_{j+1} = HMAC(P, U_j) and T ^= U_{j+1}, i.e.,
+# two compressions of a single block holding a 32 bytes digest and the
+# padding of a 64 + 32 bytes message. Those blocks are built in registers
+# from the native hash values, and all the values stay in registers for
+# the 'iterations' iterations. 'u' and 't' are updated on return.
+#
+# The round constants are replicated across all element groups and loaded
+# once in v1-v8 and v18-v25.
+#
+# Minimum VLEN: 128 bits.
+#
+# C/C++ Signature
+#  extern "C" void
+#  sha256_pbkdf2_lmul1(
+#      uint32_t* lanes,            // a0
+#      uint64_t iterations,        // a1
+#      uint64_t nlanes             // a2
+#  );
+#
+.balign 4
+.global sha256_pbkdf2_lmul1
+sha256_pbkdf2_lmul1:
+
+    # Register use in this function:
+    #  v10 - v13: message schedule words (Wt), one lane per group
+    #  v16 - v17: working state variables, then the inner digest or U
+    #  v26 - v27: inner midstate (key^ipad), {f,e,b,a} and {h,g,d,c}
+    #  v28 - v29: outer midstate (key^opad)
+    #  v30 - v31: T, the accumulated U values
+    #  v1 - v8, v18 - v25: round constants, replicated in every group
+    #  v14: temporary
+    #  v15: mask for vmerge, copied in v0 during the rounds
+    #  v9: gather indices, (i & ~3) + {3,2,3,2}
+    #  v0: vmerge or gather mask
+    #  t1: number of elements processed by the current batch
+    #  t2: remaining iterations
+
+    # t3 <- number of remaining 4B elements, 4 per lane
+    slli t3, a2, 2
+    beqz t3, 2f
+
+    # Padding words: the delimiter, and the bit length of the
+    # 64 + 32 bytes messages.
+    li t5, 0x80000000
+    li t6, 768
+
+    # Load the round constants replicated in all element groups,
+    # using v14 = (i & 3) * 4 as offsets.
+    vsetvli t1, x0, e32, m1, ta, mu
+    vid.v v14
+    vand.vi v14, v14, 3
+    vsll.vi v14, v14, 2
+    la t0, SHA256_ROUND_CONSTANTS
+    vluxei32.v v1, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v2, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v3, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v4, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v5, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v6, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v7, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v8, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v18, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v19, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v20, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v21, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v22, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v23, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v24, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v25, (t0), v14
+
+1:
+    # Batch loop, processing t1/4 lanes.
+    vsetvli t1, t3, e32, m1, ta, mu
+
+    # v15 <- vmerge mask, first word of each group, i.e., (i & 3) == 0
+    vid.v v14
+    vand.vi v14, v14, 3
+    vmseq.vi v15, v14, 0
+
+    # v9 <- gather indices, (i & ~3) + {3,2,3,2}
+    vid.v v9
+    vand.vi v14, v9, 3
+    vsub.vv v9, v9, v14
+    vid.v v14
+    vand.vi v14, v14, 1
+    vrsub.vi v14, v14, 3
+    vadd.vv v9, v9, v14
+
+    # v14 <- offsets of the lane words, 128 * (i >> 2) + 4 * (i & 3)
+    vid.v v14
+    vsrl.vi v14, v14, 2
+    vsll.vi v14, v14, 7
+    vid.v v12
+    vand.vi v12, v12, 3
+    vsll.vi v12, v12, 2
+    vadd.vv v14, v14, v12
+
+    # Load the midstates, U and T.
+    vluxei32.v v26, (a0), v14
+    addi t0, a0, 16
+    vluxei32.v v27, (t0), v14
+    addi t0, a0, 32
+    vluxei32.v v28, (t0), v14
+    addi t0, a0, 48
+    vluxei32.v v29, (t0), v14
+    addi t0, a0, 64
+    vluxei32.v v16, (t0), v14
+    addi t0, a0, 80
+    vluxei32.v v17, (t0), v14
+    addi t0, a0, 96
+    vluxei32.v v30, (t0), v14
+    addi t0, a0, 112
+    vluxei32.v v31, (t0), v14
+
+    mv t2, a1
+3:
+    # Iteration loop.
+    beqz t2, 4f
+
+    # Message block from the U value in v16-v17:
+    #  v10 <- {a,b,c,d}, v11 <- {e,f,g,h}, gathering {a,b} ({e,f}) from
+    #  v16 = {f,e,b,a} and {c,d} ({g,h}) from v17 = {h,g,d,c}, using
+    #  v9 = (i & ~3) + {3,2,3,2} and v14 = v9 - 2 as indices.
+    vid.v v14
+    vand.vi v14, v14, 2
+    vmsne.vi v0, v14, 0
+    vrgather.vv v10, v16, v9
+    vrgather.vv v10, v17, v9, v0.t
+    vadd.vi v14, v9, -2
+    vrgather.vv v11, v16, v14
+    vrgather.vv v11, v17, v14, v0.t
+    # Padding: v12 <- {0x80..., 0, 0, 0}, v13 <- {0, 0, 0, bit length}.
+    vid.v v13
+    vand.vi v13, v13, 3
+    vmseq.vi v0, v13, 3
+    vmv.v.i v13, 0
+    vmerge.vxm v13, v13, t6, v0
+    vmv1r.v v0, v15
+    vmv.v.i v12, 0
+    vmerge.vxm v12, v12, t5, v0
+    vmv.v.v v16, v26
+    vmv.v.v v17, v27
+
+    # Quad-round 0 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v1, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 1 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v2, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 2 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v3, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 3 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v4, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 4 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v5, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 5 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v6, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 6 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v7, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 7 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v8, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 8 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v18, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 9 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v19, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 10 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v20, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 11 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v21, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 12 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v22, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 13 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v23, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 14 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v24, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 15 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v25, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+
+    vadd.vv v16, v16, v26
+    vadd.vv v17, v17, v27
+
+    # Message block from the inner digest in v16-v17:
+    #  v10 <- {a,b,c,d}, v11 <- {e,f,g,h}, gathering {a,b} ({e,f}) from
+    #  v16 = {f,e,b,a} and {c,d} ({g,h}) from v17 = {h,g,d,c}, using
+    #  v9 = (i & ~3) + {3,2,3,2} and v14 = v9 - 2 as indices.
+    vid.v v14
+    vand.vi v14, v14, 2
+    vmsne.vi v0, v14, 0
+    vrgather.vv v10, v16, v9
+    vrgather.vv v10, v17, v9, v0.t
+    vadd.vi v14, v9, -2
+    vrgather.vv v11, v16, v14
+    vrgather.vv v11, v17, v14, v0.t
+    # Padding: v12 <- {0x80..., 0, 0, 0}, v13 <- {0, 0, 0, bit length}.
+    vid.v v13
+    vand.vi v13, v13, 3
+    vmseq.vi v0, v13, 3
+    vmv.v.i v13, 0
+    vmerge.vxm v13, v13, t6, v0
+    vmv1r.v v0, v15
+    vmv.v.i v12, 0
+    vmerge.vxm v12, v12, t5, v0
+    vmv.v.v v16, v28
+    vmv.v.v v17, v29
+
+    # Quad-round 0 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v1, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 1 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v2, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 2 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v3, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 3 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v4, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 4 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v5, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 5 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v6, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 6 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v7, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 7 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v8, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 8 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v18, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 9 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v19, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 10 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v20, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 11 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v21, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 12 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v22, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 13 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v23, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 14 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v24, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 15 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v25, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+
+    vadd.vv v16, v16, v28
+    vadd.vv v17, v17, v29
+
+    # T ^= U
+    vxor.vv v30, v30, v16
+    vxor.vv v31, v31, v17
+
+    addi t2, t2, -1
+    j 3b
+
+4:
+    # Store U and T.
+    vid.v v14
+    vsrl.vi v14, v14, 2
+    vsll.vi v14, v14, 7
+    vid.v v12
+    vand.vi v12, v12, 3
+    vsll.vi v12, v12, 2
+    vadd.vv v14, v14, v12
+    addi t0, a0, 64
+    vsuxei32.v v16, (t0), v14
+    addi t0, a0, 80
+    vsuxei32.v v17, (t0), v14
+    addi t0, a0, 96
+    vsuxei32.v v30, (t0), v14
+    addi t0, a0, 112
+    vsuxei32.v v31, (t0), v14
+
+    # t1 contains the number of 4B elements processed, 4 per lane.
+    sub t3, t3, t1
+    slli t0, t1, 5              # 128 bytes per lane
+    add a0, a0, t0
+    bnez t3, 1b
+
+2:
+    ret
+
+# sha256_pbkdf2_lmul1
+
+
+# sha512_pbkdf2_lmul1
+#
+# SHA-512 variant of sha256_pbkdf2_lmul1, see above. Each lane holds
+# 4 hash values of 8 uint64_t (256 bytes), the blocks hashed in each
+# iteration hold 128 + 64 bytes, i.e., 1536 bits.
+#
+# The round constants are loaded for each quad-round, as in
+# sha512_multi_blocks_lmul1.
+#
+# Minimum VLEN: 256 bits.
+#
+# C/C++ Signature
+#  extern "C" void
+#  sha512_pbkdf2_lmul1(
+#      uint64_t* lanes,            // a0
+#      uint64_t iterations,        // a1
+#      uint64_t nlanes             // a2
+#  );
+#
+.balign 4
+.global sha512_pbkdf2_lmul1
+sha512_pbkdf2_lmul1:
+
+    # Register use in this function:
+    #  v10 - v13: message schedule words (Wt), one lane per group
+    #  v16 - v17: working state variables, then the inner digest or U
+    #  v26 - v27: inner midstate (key^ipad), {f,e,b,a} and {h,g,d,c}
+    #  v28 - v29: outer midstate (key^opad)
+    #  v30 - v31: T, the accumulated U values
+    #  v15: round constants Kt, replicated in every group
+    #  v14: temporary
+    #  v9: gather indices, (i & ~3) + {3,2,3,2}
+    #  v4: offsets of the round constants, (i & 3) * 8
+    #  v1: mask for vmerge, copied in v0 during the rounds
+    #  v0: vmerge or gather mask
+    #  t1: number of elements processed by the current batch
+    #  t2: remaining iterations
+
+    # t3 <- number of remaining 8B elements, 4 per lane
+    slli t3, a2, 2
+    beqz t3, 2f
+
+    # Padding words: the delimiter, and the bit length of the
+    # 128 + 64 bytes messages.
+    li t5, 1
+    slli t5, t5, 63
+    li t6, 1536
+
+1:
+    # Batch loop, processing t1/4 lanes.
+    vsetvli t1, t3, e64, m1, ta, mu
+
+    # v1 <- vmerge mask, first word of each group, i.e., (i & 3) == 0
+    vid.v v4
+    vand.vi v4, v4, 3
+    vmseq.vi v1, v4, 0
+    # v4 <- offsets of the round constants, (i & 3) * 8
+    vsll.vi v4, v4, 3
+
+    # v9 <- gather indices, (i & ~3) + {3,2,3,2}
+    vid.v v9
+    vand.vi v14, v9, 3
+    vsub.vv v9, v9, v14
+    vid.v v14
+    vand.vi v14, v14, 1
+    vrsub.vi v14, v14, 3
+    vadd.vv v9, v9, v14
+
+    # v14 <- offsets of the lane words, 256 * (i >> 2) + 8 * (i & 3)
+    vid.v v14
+    vsrl.vi v14, v14, 2
+    vsll.vi v14, v14, 8
+    vid.v v12
+    vand.vi v12, v12, 3
+    vsll.vi v12, v12, 3
+    vadd.vv v14, v14, v12
+
+    # Load the midstates, U and T.
+    vluxei64.v v26, (a0), v14
+    addi t0, a0, 32
+    vluxei64.v v27, (t0), v14
+    addi t0, a0, 64
+    vluxei64.v v28, (t0), v14
+    addi t0, a0, 96
+    vluxei64.v v29, (t0), v14
+    addi t0, a0, 128
+    vluxei64.v v16, (t0), v14
+    addi t0, a0, 160
+    vluxei64.v v17, (t0), v14
+    addi t0, a0, 192
+    vluxei64.v v30, (t0), v14
+    addi t0, a0, 224
+    vluxei64.v v31, (t0), v14
+
+    mv t2, a1
+3:
+    # Iteration loop.
+    beqz t2, 4f
+
+    # Message block from the U value in v16-v17:
+    #  v10 <- {a,b,c,d}, v11 <- {e,f,g,h}, gathering {a,b} ({e,f}) from
+    #  v16 = {f,e,b,a} and {c,d} ({g,h}) from v17 = {h,g,d,c}, using
+    #  v9 = (i & ~3) + {3,2,3,2} and v14 = v9 - 2 as indices.
+    vid.v v14
+    vand.vi v14, v14, 2
+    vmsne.vi v0, v14, 0
+    vrgather.vv v10, v16, v9
+    vrgather.vv v10, v17, v9, v0.t
+    vadd.vi v14, v9, -2
+    vrgather.vv v11, v16, v14
+    vrgather.vv v11, v17, v14, v0.t
+    # Padding: v12 <- {0x80..., 0, 0, 0}, v13 <- {0, 0, 0, bit length}.
+    vid.v v13
+    vand.vi v13, v13, 3
+    vmseq.vi v0, v13, 3
+    vmv.v.i v13, 0
+    vmerge.vxm v13, v13, t6, v0
+    vmv1r.v v0, v1
+    vmv.v.i v12, 0
+    vmerge.vxm v12, v12, t5, v0
+    vmv.v.v v16, v26
+    vmv.v.v v17, v27
+
+    la t0, SHA512_ROUND_CONSTANTS
+
+    # Quad-round 0 (+0, v10->v11->v12->v13)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 1 (+1, v11->v12->v13->v10)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 2 (+2, v12->v13->v10->v11)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 3 (+3, v13->v10->v11->v12)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 4 (+0, v10->v11->v12->v13)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 5 (+1, v11->v12->v13->v10)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 6 (+2, v12->v13->v10->v11)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 7 (+3, v13->v10->v11->v12)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 8 (+0, v10->v11->v12->v13)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 9 (+1, v11->v12->v13->v10)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 10 (+2, v12->v13->v10->v11)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 11 (+3, v13->v10->v11->v12)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 12 (+0, v10->v11->v12->v13)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 13 (+1, v11->v12->v13->v10)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 14 (+2, v12->v13->v10->v11)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 15 (+3, v13->v10->v11->v12)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 16 (+0, v10->v11->v12->v13)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 17 (+1, v11->v12->v13->v10)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 18 (+2, v12->v13->v10->v11)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 19 (+3, v13->v10->v11->v12)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+
+    vadd.vv v16, v16, v26
+    vadd.vv v17, v17, v27
+
+    # Message block from the inner digest in v16-v17:
+    #  v10 <- {a,b,c,d}, v11 <- {e,f,g,h}, gathering {a,b} ({e,f}) from
+    #  v16 = {f,e,b,a} and {c,d} ({g,h}) from v17 = {h,g,d,c}, using
+    #  v9 = (i & ~3) + {3,2,3,2} and v14 = v9 - 2 as indices.
+    vid.v v14
+    vand.vi v14, v14, 2
+    vmsne.vi v0, v14, 0
+    vrgather.vv v10, v16, v9
+    vrgather.vv v10, v17, v9, v0.t
+    vadd.vi v14, v9, -2
+    vrgather.vv v11, v16, v14
+    vrgather.vv v11, v17, v14, v0.t
+    # Padding: v12 <- {0x80..., 0, 0, 0}, v13 <- {0, 0, 0, bit length}.
+    vid.v v13
+    vand.vi v13, v13, 3
+    vmseq.vi v0, v13, 3
+    vmv.v.i v13, 0
+    vmerge.vxm v13, v13, t6, v0
+    vmv1r.v v0, v1
+    vmv.v.i v12, 0
+    vmerge.vxm v12, v12, t5, v0
+    vmv.v.v v16, v28
+    vmv.v.v v17, v29
+
+    la t0, SHA512_ROUND_CONSTANTS
+
+    # Quad-round 0 (+0, v10->v11->v12->v13)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 1 (+1, v11->v12->v13->v10)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 2 (+2, v12->v13->v10->v11)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 3 (+3, v13->v10->v11->v12)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 4 (+0, v10->v11->v12->v13)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 5 (+1, v11->v12->v13->v10)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 6 (+2, v12->v13->v10->v11)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 7 (+3, v13->v10->v11->v12)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 8 (+0, v10->v11->v12->v13)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 9 (+1, v11->v12->v13->v10)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 10 (+2, v12->v13->v10->v11)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 11 (+3, v13->v10->v11->v12)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 12 (+0, v10->v11->v12->v13)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 13 (+1, v11->v12->v13->v10)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 14 (+2, v12->v13->v10->v11)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 15 (+3, v13->v10->v11->v12)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 16 (+0, v10->v11->v12->v13)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 17 (+1, v11->v12->v13->v10)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 18 (+2, v12->v13->v10->v11)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 19 (+3, v13->v10->v11->v12)
+    vluxei64.v v15, (t0), v4
+    addi t0, t0, 32
+    vadd.vv v14, v15, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+
+    vadd.vv v16, v16, v28
+    vadd.vv v17, v17, v29
+
+    # T ^= U
+    vxor.vv v30, v30, v16
+    vxor.vv v31, v31, v17
+
+    addi t2, t2, -1
+    j 3b
+
+4:
+    # Store U and T.
+    vid.v v14
+    vsrl.vi v14, v14, 2
+    vsll.vi v14, v14, 8
+    vid.v v12
+    vand.vi v12, v12, 3
+    vsll.vi v12, v12, 3
+    vadd.vv v14, v14, v12
+    addi t0, a0, 128
+    vsuxei64.v v16, (t0), v14
+    addi t0, a0, 160
+    vsuxei64.v v17, (t0), v14
+    addi t0, a0, 192
+    vsuxei64.v v30, (t0), v14
+    addi t0, a0, 224
+    vsuxei64.v v31, (t0), v14
+
+    # t1 contains the number of 8B elements processed, 4 per lane.
+    sub t3, t3, t1
+    slli t0, t1, 6              # 256 bytes per lane
+    add a0, a0, t0
+    bnez t3, 1b
+
+2:
+    ret
+
+# sha512_pbkdf2_lmul1
+
+######################################################################
+# Double SHA-256 Routines
+######################################################################
+
+# sha256d_sweep_lmul1
+#
+# Computes SHA-256(SHA-256(header)) for 'count' 80 bytes headers that
+# only differ in their last 4 bytes, a little-endian nonce counting up
+# from 'nonce', one header per element group.
+#
+# 'params' holds, in native representation:
+#  - params[0..7]: the hash value after the first 64 bytes of the header,
+#  - params[8..15]: the SHA-256 initial hash value,
+#  - params[16..18]: the message words of header bytes 64 to 75, i.e.,
+#    their big-endian value, params[19] is ignored.
+#
+# The two remaining blocks have a fixed layout, so they are built in
+# registers rather than padded in memory:
+#  - the end of the header, the nonce and the padding of an 80 bytes
+#    message, hashed from params[0..7],
+#  - the 32 bytes first digest and the padding of a 32 bytes message,
+#    hashed from params[8..15].
+# The final hash values are written to 'hashes', 8 uint32_t per header in
+# the native representation of sha256_block_lmul1.
+#
+# The round constants are replicated across all element groups and loaded
+# once in v1-v8 and v18-v25.
+#
+# Minimum VLEN: 128 bits.
+#
+# C/C++ Signature
+#  extern "C" void
+#  sha256d_sweep_lmul1(
+#      uint32_t* hashes,           // a0
+#      const uint32_t* params,     // a1
+#      uint64_t nonce,             // a2
+#      uint64_t count              // a3
+#  );
+#
+.balign 4
+.global sha256d_sweep_lmul1
+sha256d_sweep_lmul1:
+
+    # Register use in this function:
+    #  v10 - v13: message schedule words (Wt), one lane per group
+    #  v16 - v17: working state variables, then the first digest
+    #  v26 - v27: hash value after the first 64 bytes of the header
+    #  v28 - v29: SHA-256 initial hash value
+    #  v30: header words 16 to 18
+    #  v31: mask of the last word of each group, i.e., (i & 3) == 3
+    #  v1 - v8, v18 - v25: round constants, replicated in every group
+    #  v14: temporary
+    #  v15: mask for vmerge, copied in v0 during the rounds
+    #  v9: gather indices, (i & ~3) + {3,2,3,2}
+    #  v0: vmerge or gather mask
+    #  t1: number of elements processed by the current batch
+    #  t2: nonce of the first lane of the current batch
+
+    # t3 <- number of remaining 4B elements, 4 per lane
+    slli t3, a3, 2
+    beqz t3, 2f
+    mv t2, a2
+
+    # Padding words: the delimiter, and the bit lengths of the 80 bytes
+    # header and of the 32 bytes first digest.
+    li t5, 0x80000000
+    li t4, 640
+    li t6, 256
+
+    # Load the round constants, hash values and header words replicated
+    # in all element groups, using v14 = (i & 3) * 4 as offsets.
+    vsetvli t1, x0, e32, m1, ta, mu
+    vid.v v14
+    vand.vi v14, v14, 3
+    vsll.vi v14, v14, 2
+    la t0, SHA256_ROUND_CONSTANTS
+    vluxei32.v v1, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v2, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v3, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v4, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v5, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v6, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v7, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v8, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v18, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v19, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v20, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v21, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v22, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v23, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v24, (t0), v14
+    addi t0, t0, 16
+    vluxei32.v v25, (t0), v14
+    vluxei32.v v26, (a1), v14
+    addi t0, a1, 16
+    vluxei32.v v27, (t0), v14
+    addi t0, a1, 32
+    vluxei32.v v28, (t0), v14
+    addi t0, a1, 48
+    vluxei32.v v29, (t0), v14
+    addi t0, a1, 64
+    vluxei32.v v30, (t0), v14
+
+    # v15 <- vmerge mask, first word of each group, i.e., (i & 3) == 0
+    # v31 <- last word of each group, i.e., (i & 3) == 3
+    vid.v v14
+    vand.vi v14, v14, 3
+    vmseq.vi v15, v14, 0
+    vmseq.vi v31, v14, 3
+
+    # v9 <- gather indices, (i & ~3) + {3,2,3,2}
+    vid.v v9
+    vand.vi v14, v9, 3
+    vsub.vv v9, v9, v14
+    vid.v v14
+    vand.vi v14, v14, 1
+    vrsub.vi v14, v14, 3
+    vadd.vv v9, v9, v14
+
+1:
+    # Batch loop, processing t1/4 lanes.
+    vsetvli t1, t3, e32, m1, ta, mu
+
+    # Second block: v10 <- {W16, W17, W18, nonce}, the nonce of lane i >> 2
+    # being t2 + (i >> 2), byte swapped into a big-endian word.
+    vid.v v14
+    vsrl.vi v14, v14, 2
+    vadd.vx v14, v14, t2
+    vrev8.v v14, v14
+    vmv1r.v v0, v31
+    vmerge.vvm v10, v30, v14, v0
+    # Padding: v11 <- {0x80..., 0, 0, 0}, v12 <- 0, v13 <- {0, 0, 0, 640}.
+    vmv.v.i v13, 0
+    vmerge.vxm v13, v13, t4, v0
+    vmv.v.i v12, 0
+    vmv1r.v v0, v15
+    vmv.v.i v11, 0
+    vmerge.vxm v11, v11, t5, v0
+    vmv.v.v v16, v26
+    vmv.v.v v17, v27
+
+    # Quad-round 0 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v1, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 1 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v2, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 2 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v3, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 3 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v4, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 4 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v5, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 5 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v6, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 6 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v7, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 7 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v8, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 8 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v18, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 9 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v19, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 10 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v20, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 11 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v21, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 12 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v22, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 13 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v23, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 14 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v24, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 15 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v25, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+
+    vadd.vv v16, v16, v26
+    vadd.vv v17, v17, v27
+
+    # Message block from the first digest in v16-v17:
+    #  v10 <- {a,b,c,d}, v11 <- {e,f,g,h}, gathering {a,b} ({e,f}) from
+    #  v16 = {f,e,b,a} and {c,d} ({g,h}) from v17 = {h,g,d,c}, using
+    #  v9 = (i & ~3) + {3,2,3,2} and v14 = v9 - 2 as indices.
+    vid.v v14
+    vand.vi v14, v14, 2
+    vmsne.vi v0, v14, 0
+    vrgather.vv v10, v16, v9
+    vrgather.vv v10, v17, v9, v0.t
+    vadd.vi v14, v9, -2
+    vrgather.vv v11, v16, v14
+    vrgather.vv v11, v17, v14, v0.t
+    # Padding: v12 <- {0x80..., 0, 0, 0}, v13 <- {0, 0, 0, bit length}.
+    vid.v v13
+    vand.vi v13, v13, 3
+    vmseq.vi v0, v13, 3
+    vmv.v.i v13, 0
+    vmerge.vxm v13, v13, t6, v0
+    vmv1r.v v0, v15
+    vmv.v.i v12, 0
+    vmerge.vxm v12, v12, t5, v0
+    vmv.v.v v16, v28
+    vmv.v.v v17, v29
+
+    # Quad-round 0 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v1, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 1 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v2, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 2 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v3, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 3 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v4, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 4 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v5, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 5 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v6, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 6 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v7, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 7 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v8, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 8 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v18, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 9 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v19, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 10 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v20, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 11 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v21, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 12 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v22, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 13 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v23, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 14 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v24, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 15 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v25, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+
+    vadd.vv v16, v16, v28
+    vadd.vv v17, v17, v29
+
+    # Store the final hash values, at offsets 32 * (i >> 2) + 4 * (i & 3).
+    vid.v v14
+    vsrl.vi v14, v14, 2
+    vsll.vi v14, v14, 5
+    vid.v v12
+    vand.vi v12, v12, 3
+    vsll.vi v12, v12, 2
+    vadd.vv v14, v14, v12
+    vsuxei32.v v16, (a0), v14
+    addi t0, a0, 16
+    vsuxei32.v v17, (t0), v14
+
+    # t1 contains the number of 4B elements processed, 4 per lane.
+    sub t3, t3, t1
+    srli t0, t1, 2
+    add t2, t2, t0
+    slli t0, t1, 3              # 32 bytes per lane
+    add a0, a0, t0
+    bnez t3, 1b
+
+2:
+    ret
+
+# sha256d_sweep_lmul1
+
+######################################################################
+# Merkle Tree Routines
+######################################################################
+
+.data
+.balign 16
+// SHA-256 initial hash value, in the native {f,e,b,a,h,g,d,c} order.
+SHA256_NATIVE_INITIAL_HASH:
+    .word 0x9b05688c, 0x510e527f, 0xbb67ae85, 0x6a09e667
+    .word 0x5be0cd19, 0x1f83d9ab, 0xa54ff53a, 0x3c6ef372
+
+// Kt + Wt for the padding block of a 64 bytes message, i.e., for
+// W0-15 = {0x80000000, 0, ..., 0, 512}. The message schedule of that
+// block is the same for every 64 bytes message.
+SHA256_PAD64_KW:
+    .word 0xc28a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5  # 0-3
+    .word 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5  # 4-7
+    .word 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3
+    .word 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf374
+    .word 0x649b69c1, 0xf0fe4786, 0x0fe1edc6, 0x240cf254
+    .word 0x4fe9346f, 0x6cc984be, 0x61b9411e, 0x16f988fa
+    .word 0xf2c65152, 0xa88e5a6d, 0xb019fc65, 0xb9d99ec7
+    .word 0x9a1231c3, 0xe70eeaa0, 0xfdb1232b, 0xc7353eb0
+    .word 0x3069bad5, 0xcb976d5f, 0x5a0f118f, 0xdc1eeefd
+    .word 0x0a35b689, 0xde0b7a04, 0x58f4ca9d, 0xe15d5b16
+    .word 0x007f3e86, 0x37088980, 0xa507ea32, 0x6fab9537
+    .word 0x17406110, 0x0d8cd6f1, 0xcdaa3b6d, 0xc0bbbe37
+    .word 0x83613bda, 0xdb48a363, 0x0b02e931, 0x6fd15ca7
+    .word 0x521afaca, 0x31338431, 0x6ed41a95, 0x6d437890
+    .word 0xc39c91f2, 0x9eccabbd, 0xb5c9a0e6, 0x532fb63c
+    .word 0xd2c741c6, 0x07237ea3, 0xa4954b68, 0x4c191d76  # 60-63
+
+.text
+
+# sha256_merkle_nodes_lmul1
+#
+# Computes 'nparents' inner nodes of a SHA-256 Merkle tree, the hash of
+# the concatenation of two child digests, one node per element group.
+#
+# 'children' holds 2 * 'nparents' hash values, 8 uint32_t each, in the
+# native representation of sha256_block_lmul1: parent i is the hash of
+# the digests of children 2i and 2i+1. The parent hash values are written
+# to 'parents' in the same representation, so that a level of the tree
+# can be passed as the children of the next one without any conversion.
+#
+# The first block, the two child digests, is gathered in registers from
+# the native hash values. The second block is the padding of a 64 bytes
+# message, which does not depend on the children: its message schedule
+# is precomputed (SHA256_PAD64_KW), and its compression only runs the
+# rounds.
+#
+# The round constants are replicated across all element groups and loaded
+# once in v1-v8 and v18-v25.
+#
+# Minimum VLEN: 128 bits.
+#
+# C/C++ Signature
+#  extern "C" void
+#  sha256_merkle_nodes_lmul1(
+#      uint32_t* parents,          // a0
+#      const uint32_t* children,   // a1
+#      uint64_t nparents           // a2
+#  );
+#
+.balign 4
+.global sha256_merkle_nodes_lmul1
+sha256_merkle_nodes_lmul1:
+
+    # Register use in this function:
+    #  v10 - v13: message schedule words (Wt), one lane per group
+    #  v16 - v17: working state variables, first the left child
+    #  v26 - v27: right child, then the hash value after the first block
+    #  v28 - v29: SHA-256 initial hash value
+    #  v31: offsets of the replicated constants, (i & 3) * 4
+    #  v1 - v8, v18 - v25: round constants, replicated in every group
+    #  v14: temporary
+    #  v15: mask for vmerge, copied in v0 during the rounds
+    #  v9: gather indices, (i & ~3) + {3,2,3,2}
+    #  v0: vmerge or gather mask
+    #  t1: number of elements processed by the current batch
+
+    # t3 <- number of remaining 4B elements, 4 per lane
+    slli t3, a2, 2
+    beqz t3, 2f
+
+    # Load the round constants and the initial hash value replicated in
+    # all element groups, using v31 = (i & 3) * 4 as offsets.
+    vsetvli t1, x0, e32, m1, ta, mu
+    vid.v v31
+    vand.vi v31, v31, 3
+    vsll.vi v31, v31, 2
+    la t0, SHA256_ROUND_CONSTANTS
+    vluxei32.v v1, (t0), v31
+    addi t0, t0, 16
+    vluxei32.v v2, (t0), v31
+    addi t0, t0, 16
+    vluxei32.v v3, (t0), v31
+    addi t0, t0, 16
+    vluxei32.v v4, (t0), v31
+    addi t0, t0, 16
+    vluxei32.v v5, (t0), v31
+    addi t0, t0, 16
+    vluxei32.v v6, (t0), v31
+    addi t0, t0, 16
+    vluxei32.v v7, (t0), v31
+    addi t0, t0, 16
+    vluxei32.v v8, (t0), v31
+    addi t0, t0, 16
+    vluxei32.v v18, (t0), v31
+    addi t0, t0, 16
+    vluxei32.v v19, (t0), v31
+    addi t0, t0, 16
+    vluxei32.v v20, (t0), v31
+    addi t0, t0, 16
+    vluxei32.v v21, (t0), v31
+    addi t0, t0, 16
+    vluxei32.v v22, (t0), v31
+    addi t0, t0, 16
+    vluxei32.v v23, (t0), v31
+    addi t0, t0, 16
+    vluxei32.v v24, (t0), v31
+    addi t0, t0, 16
+    vluxei32.v v25, (t0), v31
+    la t0, SHA256_NATIVE_INITIAL_HASH
+    vluxei32.v v28, (t0), v31
+    addi t0, t0, 16
+    vluxei32.v v29, (t0), v31
+
+    # v15 <- vmerge mask, first word of each group, i.e., (i & 3) == 0
+    vid.v v14
+    vand.vi v14, v14, 3
+    vmseq.vi v15, v14, 0
+
+    # v9 <- gather indices, (i & ~3) + {3,2,3,2}
+    vid.v v9
+    vand.vi v14, v9, 3
+    vsub.vv v9, v9, v14
+    vid.v v14
+    vand.vi v14, v14, 1
+    vrsub.vi v14, v14, 3
+    vadd.vv v9, v9, v14
+
+1:
+    # Batch loop, processing t1/4 nodes.
+    vsetvli t1, t3, e32, m1, ta, mu
+
+    # Load the children, at offsets 64 * (i >> 2) + 4 * (i & 3).
+    vid.v v14
+    vsrl.vi v14, v14, 2
+    vsll.vi v14, v14, 6
+    vadd.vv v14, v14, v31
+    vluxei32.v v16, (a1), v14
+    addi t0, a1, 16
+    vluxei32.v v17, (t0), v14
+    addi t0, a1, 32
+    vluxei32.v v26, (t0), v14
+    addi t0, a1, 48
+    vluxei32.v v27, (t0), v14
+
+    # First block from the children digests:
+    #  v10 <- {a,b,c,d}, v11 <- {e,f,g,h} of the left child, gathering
+    #  {a,b} ({e,f}) from v16 = {f,e,b,a} and {c,d} ({g,h}) from
+    #  v17 = {h,g,d,c}, using v9 = (i & ~3) + {3,2,3,2} and v14 = v9 - 2
+    #  as indices. Likewise, v12 and v13 from the right child.
+    vid.v v14
+    vand.vi v14, v14, 2
+    vmsne.vi v0, v14, 0
+    vadd.vi v14, v9, -2
+    vrgather.vv v10, v16, v9
+    vrgather.vv v10, v17, v9, v0.t
+    vrgather.vv v11, v16, v14
+    vrgather.vv v11, v17, v14, v0.t
+    vrgather.vv v12, v26, v9
+    vrgather.vv v12, v27, v9, v0.t
+    vrgather.vv v13, v26, v14
+    vrgather.vv v13, v27, v14, v0.t
+    vmv1r.v v0, v15
+    vmv.v.v v16, v28
+    vmv.v.v v17, v29
+
+    # Quad-round 0 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v1, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 1 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v2, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 2 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v3, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 3 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v4, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 4 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v5, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 5 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v6, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 6 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v7, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 7 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v8, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 8 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v18, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v12, v11, v0
+    vsha2ms.vv v10, v14, v13
+    # Quad-round 9 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v19, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v13, v12, v0
+    vsha2ms.vv v11, v14, v10
+    # Quad-round 10 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v20, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v10, v13, v0
+    vsha2ms.vv v12, v14, v11
+    # Quad-round 11 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v21, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    vmerge.vvm v14, v11, v10, v0
+    vsha2ms.vv v13, v14, v12
+    # Quad-round 12 (+0, v10->v11->v12->v13)
+    vadd.vv v14, v22, v10
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 13 (+1, v11->v12->v13->v10)
+    vadd.vv v14, v23, v11
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 14 (+2, v12->v13->v10->v11)
+    vadd.vv v14, v24, v12
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 15 (+3, v13->v10->v11->v12)
+    vadd.vv v14, v25, v13
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+
+    vadd.vv v16, v16, v28
+    vadd.vv v17, v17, v29
+    vmv.v.v v26, v16
+    vmv.v.v v27, v17
+
+    # Padding block, with the precomputed Kt + Wt.
+    la t0, SHA256_PAD64_KW
+    # Quad-round 0
+    vluxei32.v v14, (t0), v31
+    addi t0, t0, 16
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 1
+    vluxei32.v v14, (t0), v31
+    addi t0, t0, 16
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 2
+    vluxei32.v v14, (t0), v31
+    addi t0, t0, 16
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 3
+    vluxei32.v v14, (t0), v31
+    addi t0, t0, 16
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 4
+    vluxei32.v v14, (t0), v31
+    addi t0, t0, 16
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 5
+    vluxei32.v v14, (t0), v31
+    addi t0, t0, 16
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 6
+    vluxei32.v v14, (t0), v31
+    addi t0, t0, 16
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 7
+    vluxei32.v v14, (t0), v31
+    addi t0, t0, 16
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 8
+    vluxei32.v v14, (t0), v31
+    addi t0, t0, 16
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 9
+    vluxei32.v v14, (t0), v31
+    addi t0, t0, 16
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 10
+    vluxei32.v v14, (t0), v31
+    addi t0, t0, 16
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 11
+    vluxei32.v v14, (t0), v31
+    addi t0, t0, 16
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 12
+    vluxei32.v v14, (t0), v31
+    addi t0, t0, 16
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 13
+    vluxei32.v v14, (t0), v31
+    addi t0, t0, 16
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 14
+    vluxei32.v v14, (t0), v31
+    addi t0, t0, 16
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+    # Quad-round 15
+    vluxei32.v v14, (t0), v31
+    vsha2cl.vv v17, v16, v14
+    vsha2ch.vv v16, v17, v14
+
+    vadd.vv v16, v16, v26
+    vadd.vv v17, v17, v27
+
+    # Store the parents, at offsets 32 * (i >> 2) + 4 * (i & 3).
+    vid.v v14
+    vsrl.vi v14, v14, 2
+    vsll.vi v14, v14, 5
+    vadd.vv v14, v14, v31
+    vsuxei32.v v16, (a0), v14
+    addi t0, a0, 16
+    vsuxei32.v v17, (t0), v14
+
+    # t1 contains the number of 4B elements processed, 4 per node.
+    sub t3, t3, t1
+    slli t0, t1, 3              # 32 bytes per parent
+    add a0, a0, t0
+    slli t0, t1, 4              # 64 bytes per pair of children
+    add a1, a1, t0
+    bnez t3, 1b
+
+2:
+    ret
+
+# sha256_merkle_nodes_lmul1
@@ -17,6 +17,8 @@
 
 #include <stdint.h>
 
+// Unless noted otherwise, the routines below require VLEN >= 128.
+
 extern void
 zvksed_sm4_encode_vv(
     void* dest,
@@ -33,4 +35,225 @@ zvksed_sm4_decode_vv(
     const void* masterKey
 );
 
+// Key expansion. An expanded key holds the 32 round keys in encryption
+// order, followed by the same 32 round keys in decryption order.
+// zvksed_sm4_expand_key works with any VLEN.
+
+#define ZVKSED_SM4_EXPANDED_KEY_WORDS 64
+
+extern void
+zvksed_sm4_expand_key(
+    uint32_t* rk,           // uint32_t[64]
+    const void* masterKey   // uint32_t[4]
+);
+
+// Expands 'nkeys' master keys, one per element group, into 'nkeys'
+// consecutive expanded keys.
+extern void
+zvksed_sm4_expand_keys(
+    uint32_t* rks,            // uint32_t[64 * nkeys]
+    const void* masterKeys,   // uint32_t[4 * nkeys]
+    uint64_t nkeys
+);
+
+// Encoding/decoding with an expanded key.
+
+extern void
+zvksed_sm4_encode_rk_vv(
+    void* dest,
+    const void* src,
+    uint64_t length,
+    const uint32_t* rk
+);
+
+extern void
+zvksed_sm4_decode_rk_vv(
+    void* dest,
+    const void* src,
+    uint64_t length,
+    const uint32_t* rk
+);
+
+// Strip-mined variants of the above, processing VLEN*LMUL/128 blocks per
+// iteration. The minimum VLEN is 128 bits for LMUL=1, 64 bits for LMUL=2
+// and 32 bits for LMUL=4.
+
+extern void
+zvksed_sm4_encode_rk_vs_lmul1(
+    void* dest,
+    const void* src,
+    uint64_t length,
+    const uint32_t* rk
+);
+
+extern void
+zvksed_sm4_encode_rk_vs_lmul2(
+    void* dest,
+    const void* src,
+    uint64_t length,
+    const uint32_t* rk
+);
+
+extern void
+zvksed_sm4_encode_rk_vs_lmul4(
+    void* dest,
+    const void* src,
+    uint64_t length,
+    const uint32_t* rk
+);
+
+extern void
+zvksed_sm4_decode_rk_vs_lmul1(
+    void* dest,
+    const void* src,
+    uint64_t length,
+    const uint32_t* rk
+);
+
+extern void
+zvksed_sm4_decode_rk_vs_lmul2(
+    void* dest,
+    const void* src,
+    uint64_t length,
+    const uint32_t* rk
+);
+
+extern void
+zvksed_sm4_decode_rk_vs_lmul4(
+    void* dest,
+    const void* src,
+    uint64_t length,
+    const uint32_t* rk
+);
+
+// SM4 Counter Mode
+//
+// Each 16 bytes block 'i' is XORed with the encryption of the i-th
+// increment (32 bits, big-endian) of counter_block, which is updated
+// to the counter block following the last one used. Unlike the routines
+// above, the text and the counter block are byte strings. Only the
+// encryption schedule of 'rk' is used. Minimum VLEN: 64 bits.
+
+extern void
+zvksed_sm4_ctr32_vs_lmul2(
+    void* dest,
+    const void* src,
+    uint64_t length,
+    const uint32_t* rk,
+    void* counter_block
+);
+
+// SM4-XTS, IEEE 1619 and GB/T 17964 (gb) variants
+//
+// 'rks' holds Key1 (data) then Key2 (tweak), each expanded by
+// zvksed_sm4_expand_key. 'length' shall be at least 16, a trailing partial
+// block is handled with ciphertext stealing. The text and the initial
+// tweak 'iv' are byte strings. Minimum VLEN: 64 bits, maximum VLEN: 4096
+// bits.
+
+#define ZVKSED_SM4_XTS_KEY_WORDS (2 * ZVKSED_SM4_EXPANDED_KEY_WORDS)
+
+extern void
+zvksed_sm4_xts_encrypt_vs_lmul2(
+    void* dest,
+    const void* src,
+    uint64_t length,
+    const uint32_t* rks,
+    const void* iv
+);
+
+extern void
+zvksed_sm4_xts_decrypt_vs_lmul2(
+    void* dest,
+    const void* src,
+    uint64_t length,
+    const uint32_t* rks,
+    const void* iv
+);
+
+extern void
+zvksed_sm4_xts_gb_encrypt_vs_lmul2(
+    void* dest,
+    const void* src,
+    uint64_t length,
+    const uint32_t* rks,
+    const void* iv
+);
+
+extern void
+zvksed_sm4_xts_gb_decrypt_vs_lmul2(
+    void* dest,
+    const void* src,
+    uint64_t length,
+    const uint32_t* rks,
+    const void* iv
+);
+
+// SM4-CBC and SM4-CFB (128 bits feedback)
+//
+// 'length' shall be a multiple of 16. The text and 'iv' are byte strings,
+// 'iv' being updated to the last ciphertext block. Encryption is serial,
+// decryption processes VLEN*2/128 blocks per iteration. Minimum VLEN: 64
+// bits.
+
+extern void
+zvksed_sm4_cbc_encrypt_vs_lmul2(
+    void* dest,
+    const void* src,
+    uint64_t length,
+    const uint32_t* rk,
+    void* iv
+);
+
+extern void
+zvksed_sm4_cbc_decrypt_vs_lmul2(
+    void* dest,
+    const void* src,
+    uint64_t length,
+    const uint32_t* rk,
+    void* iv
+);
+
+extern void
+zvksed_sm4_cfb_encrypt_vs_lmul2(
+    void* dest,
+    const void* src,
+    uint64_t length,
+    const uint32_t* rk,
+    void* iv
+);
+
+extern void
+zvksed_sm4_cfb_decrypt_vs_lmul2(
+    void* dest,
+    const void* src,
+    uint64_t length,
+    const uint32_t* rk,
+    void* iv
+);
+
+// Multi-key SM4
+//
+// Each job holds a master key and a block, which is replaced by its
+// encryption (resp. decryption) under that key. Both are byte strings.
+// The keys are expanded in registers, one job per element group, and
+// never stored. Minimum VLEN: 64 bits.
+
+struct zvksed_sm4_job {
+    uint8_t key[16];
+    uint8_t block[16];
+};
+
+extern void
+zvksed_sm4_encrypt_jobs_vv_lmul2(
+    struct zvksed_sm4_job* jobs,
+    uint64_t njobs
+);
+
+extern void
+zvksed_sm4_decrypt_jobs_vv_lmul2(
+    struct zvksed_sm4_job* jobs,
+    uint64_t njobs
+);
+
 #endif  // ZVKSED_H_
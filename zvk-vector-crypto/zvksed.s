@@ -108,6 +108,7 @@ zvksed_sm4_encode_vv:
 
     add a2, a2, -16
     add a1, a1, 16
+    add a0, a0, 16
     bnez a2, 1b
 
     ret
@@ -204,5 +205,1478 @@ zvksed_sm4_decode_vv:
 
     add a2, a2, -16
     add a1, a1, 16
+    add a0, a0, 16
     bnez a2, 1b
     ret
+
+# zvksed_sm4_expand_key
+#
+# Expands the 128 bit 'master_key' into the 32 round keys, stored twice in
+# 'rk': rk[0..31] in encryption order, then rk[32..63] in decryption order,
+# i.e., reversed. The decryption schedule is written with negative stride
+# stores, so that zvksed_sm4_decode_rk_vv can load it as is, without the
+# per-call vrgather reversals of zvksed_sm4_decode_vv.
+#
+# Minimum VLEN: 32 bits.
+#
+# C/C++ Signature
+#   extern "C" void
+#   zvksed_sm4_expand_key(
+#       uint32_t* rk,             // a0, uint32_t[64]
+#       const void* master_key    // a1, uint32_t[4]
+#   );
+#
+.balign 4
+.global zvksed_sm4_expand_key
+zvksed_sm4_expand_key:
+    # LMUL=4 lets a single element group fit a register group for any
+    # VLEN >= 32, so that keys can be expanded for the LMUL>1 routines
+    # on small VLEN machines.
+    vsetivli x0, 4, e32, m4, ta, ma
+
+    # Load the master key and XOR it with FK, round_key rk{-4:-1}.
+    vle32.v v0, (a1)
+    la t0, FK
+    vle32.v v4, (t0)
+    vxor.vv v0, v0, v4
+
+    # t1 = &rk[63], the slot of rk[0] in the decryption schedule. Each
+    # group of four round keys is stored there from its last word down.
+    addi t1, a0, 252
+    li t2, -4
+
+    vsm4k.vi v4, v0, 0
+    vse32.v v4, (a0)
+    vsse32.v v4, (t1), t2
+    addi a0, a0, 16
+    addi t1, t1, -16
+    vsm4k.vi v8, v4, 1
+    vse32.v v8, (a0)
+    vsse32.v v8, (t1), t2
+    addi a0, a0, 16
+    addi t1, t1, -16
+    vsm4k.vi v4, v8, 2
+    vse32.v v4, (a0)
+    vsse32.v v4, (t1), t2
+    addi a0, a0, 16
+    addi t1, t1, -16
+    vsm4k.vi v8, v4, 3
+    vse32.v v8, (a0)
+    vsse32.v v8, (t1), t2
+    addi a0, a0, 16
+    addi t1, t1, -16
+    vsm4k.vi v4, v8, 4
+    vse32.v v4, (a0)
+    vsse32.v v4, (t1), t2
+    addi a0, a0, 16
+    addi t1, t1, -16
+    vsm4k.vi v8, v4, 5
+    vse32.v v8, (a0)
+    vsse32.v v8, (t1), t2
+    addi a0, a0, 16
+    addi t1, t1, -16
+    vsm4k.vi v4, v8, 6
+    vse32.v v4, (a0)
+    vsse32.v v4, (t1), t2
+    addi a0, a0, 16
+    addi t1, t1, -16
+    vsm4k.vi v8, v4, 7
+    vse32.v v8, (a0)
+    vsse32.v v8, (t1), t2
+
+    ret
+
+# zvksed_sm4_expand_key
+
+# zvksed_sm4_expand_keys
+#
+# Expands 'nkeys' master keys, stored consecutively in 'master_keys', into
+# 'nkeys' consecutive 64 words schedules in the layout of
+# zvksed_sm4_expand_key. Each element group holds a different key, so
+# that every vsm4k.vi expands VLEN/128 keys at once.
+#
+# The round keys are scattered with indexed stores: element 'i' of a
+# round key group belongs to key i/4, word i%4, and is stored at offset
+# 256*(i/4) + 4*(i%4) of the encryption schedule, and at offset
+# 256*(i/4) + 252 - 4*(i%4) of the decryption one (relative to the
+# current round).
+#
+# Minimum VLEN: 128 bits.
+#
+# C/C++ Signature
+#   extern "C" void
+#   zvksed_sm4_expand_keys(
+#       uint32_t* rks,              // a0, uint32_t[64 * nkeys]
+#       const void* master_keys,    // a1, uint32_t[4 * nkeys]
+#       uint64_t nkeys              // a2
+#   );
+#
+.balign 4
+.global zvksed_sm4_expand_keys
+zvksed_sm4_expand_keys:
+    beqz a2, 2f
+
+    # a2 = number of words left, t3 = words per iteration, a multiple of 4
+    # as VLEN >= 128.
+    slli a2, a2, 2
+    vsetvli t3, x0, e32, m1, ta, ma
+
+    # v2 = 4*(i%4), v4 = 256*(i/4)
+    vid.v v1
+    vand.vi v2, v1, 3
+    vsll.vi v2, v2, 2
+    vsrl.vi v4, v1, 2
+    vsll.vi v4, v4, 8
+    # v20 = encryption offsets, v21 = decryption offsets
+    vadd.vv v20, v4, v2
+    li t4, 252
+    vrsub.vx v5, v2, t4
+    vadd.vv v21, v4, v5
+
+    # FK, replicated in every element group.
+    la t0, FK
+    vluxei32.v v9, (t0), v2
+
+1:
+    # t0 = min(a2, t3). AVL <= VLMAX ensures vl == AVL, a whole number of
+    # keys.
+    mv t0, a2
+    bleu t0, t3, 3f
+    mv t0, t3
+3:
+    vsetvli x0, t0, e32, m1, ta, ma
+
+    vle32.v v10, (a1)
+    vxor.vv v10, v10, v9
+
+    # t1 walks the encryption schedules up, t2 the decryption ones down.
+    mv t1, a0
+    mv t2, a0
+
+    vsm4k.vi v11, v10, 0
+    vsuxei32.v v11, (t1), v20
+    vsuxei32.v v11, (t2), v21
+    addi t1, t1, 16
+    addi t2, t2, -16
+    vsm4k.vi v12, v11, 1
+    vsuxei32.v v12, (t1), v20
+    vsuxei32.v v12, (t2), v21
+    addi t1, t1, 16
+    addi t2, t2, -16
+    vsm4k.vi v11, v12, 2
+    vsuxei32.v v11, (t1), v20
+    vsuxei32.v v11, (t2), v21
+    addi t1, t1, 16
+    addi t2, t2, -16
+    vsm4k.vi v12, v11, 3
+    vsuxei32.v v12, (t1), v20
+    vsuxei32.v v12, (t2), v21
+    addi t1, t1, 16
+    addi t2, t2, -16
+    vsm4k.vi v11, v12, 4
+    vsuxei32.v v11, (t1), v20
+    vsuxei32.v v11, (t2), v21
+    addi t1, t1, 16
+    addi t2, t2, -16
+    vsm4k.vi v12, v11, 5
+    vsuxei32.v v12, (t1), v20
+    vsuxei32.v v12, (t2), v21
+    addi t1, t1, 16
+    addi t2, t2, -16
+    vsm4k.vi v11, v12, 6
+    vsuxei32.v v11, (t1), v20
+    vsuxei32.v v11, (t2), v21
+    addi t1, t1, 16
+    addi t2, t2, -16
+    vsm4k.vi v12, v11, 7
+    vsuxei32.v v12, (t1), v20
+    vsuxei32.v v12, (t2), v21
+
+    # 4 bytes of master key and 64 bytes of schedule per word.
+    slli t1, t0, 2
+    add a1, a1, t1
+    slli t1, t0, 6
+    add a0, a0, t1
+    sub a2, a2, t0
+    bnez a2, 1b
+
+2:
+    ret
+
+# zvksed_sm4_expand_keys
+
+# zvksed_sm4_encode_rk_vv
+#
+# Encodes the plain text provided in 'src' with the round keys in 'rk',
+# as expanded by zvksed_sm4_expand_key. Result is placed in 'dest'.
+# The length provided in 'n' shall be a multiple of 16B block size.
+#
+# Same as zvksed_sm4_encode_vv, without the key expansion: the 8 round key
+# groups are loaded from memory.
+#
+# C/C++ Signature
+#   extern "C" void
+#   zvksed_sm4_encode_rk_vv(
+#       void* dest,           // a0
+#       const void* src,      // a1
+#       uint64_t n,           // a2
+#       const uint32_t* rk    // a3, uint32_t[64]
+#   );
+#
+.balign 4
+.global zvksed_sm4_encode_rk_vv
+zvksed_sm4_encode_rk_vv:
+    beqz a2, 2f
+    vsetivli x0, 4, e32, m1, ta, ma
+
+    # Load the round keys.
+    vle32.v v11, (a3)
+    addi a3, a3, 16
+    vle32.v v12, (a3)
+    addi a3, a3, 16
+    vle32.v v13, (a3)
+    addi a3, a3, 16
+    vle32.v v14, (a3)
+    addi a3, a3, 16
+    vle32.v v15, (a3)
+    addi a3, a3, 16
+    vle32.v v16, (a3)
+    addi a3, a3, 16
+    vle32.v v17, (a3)
+    addi a3, a3, 16
+    vle32.v v18, (a3)
+
+    # Generate vector of [3, 2, 1, 0] indices.
+    # Use it to reverse the order of elements in the register.
+    vid.v v3
+    vxor.vi v3, v3, 3
+
+1:
+    # Load a 16B block of data to process.
+    vle32.v v1, (a1)
+
+    vsm4r.vv v1, v11    # with round key rk[0:3]
+    vsm4r.vv v1, v12    # with round key rk[4:7]
+    vsm4r.vv v1, v13    # with round key rk[8:11]
+    vsm4r.vv v1, v14    # with round key rk[12:15]
+    vsm4r.vv v1, v15    # with round key rk[16:19]
+    vsm4r.vv v1, v16    # with round key rk[20:23]
+    vsm4r.vv v1, v17    # with round key rk[24:27]
+    vsm4r.vv v1, v18    # with round key rk[28:31]
+
+    vrgather.vv v10, v1, v3
+
+    # Save the result.
+    vse32.v v10, (a0)
+
+    add a2, a2, -16
+    add a1, a1, 16
+    add a0, a0, 16
+    bnez a2, 1b
+
+2:
+    ret
+
+# zvksed_sm4_encode_rk_vv
+
+# zvksed_sm4_decode_rk_vv
+#
+# Decodes the cipher text provided in 'src' with the round keys in 'rk',
+# as expanded by zvksed_sm4_expand_key. Result is placed in 'dest'.
+# The length provided in 'n' shall be a multiple of 16B block size.
+#
+# Decoding is encoding with the round keys in reverse order, i.e., with
+# the decryption schedule in the second half of 'rk'.
+#
+# C/C++ Signature
+#   extern "C" void
+#   zvksed_sm4_decode_rk_vv(
+#       void* dest,           // a0
+#       const void* src,      // a1
+#       uint64_t n,           // a2
+#       const uint32_t* rk    // a3, uint32_t[64]
+#   );
+#
+.balign 4
+.global zvksed_sm4_decode_rk_vv
+zvksed_sm4_decode_rk_vv:
+    addi a3, a3, 128
+    j zvksed_sm4_encode_rk_vv
+
+# zvksed_sm4_decode_rk_vv
+
+# zvksed_sm4_encode_rk_vs_lmul1
+#
+# Encodes the plain text provided in 'src' with the round keys in 'rk',
+# as expanded by zvksed_sm4_expand_key. Result is placed in 'dest'.
+# The length provided in 'n' shall be a multiple of 16B block size.
+#
+# Unlike zvksed_sm4_encode_rk_vv, which processes a single block per
+# iteration, the loop is strip-mined with vsetvli and processes VLEN/128
+# blocks per iteration, one per element group. The "vector scalar" form
+# vsm4r.vs applies the round keys in the first element group of the key
+# registers to all element groups, so the 8 round key groups are loaded
+# once, before the loop, and never need to be replicated.
+#
+# This variant uses LMUL=1. Minimum VLEN: 128 bits.
+#
+# C/C++ Signature
+#   extern "C" void
+#   zvksed_sm4_encode_rk_vs_lmul1(
+#       void* dest,           // a0
+#       const void* src,      // a1
+#       uint64_t n,           // a2
+#       const uint32_t* rk    // a3, uint32_t[64]
+#   );
+#
+.balign 4
+.global zvksed_sm4_encode_rk_vs_lmul1
+zvksed_sm4_encode_rk_vs_lmul1:
+    # t3 <- number of remaining 4B elements (a multiple of 4)
+    srli t3, a2, 2
+    beqz t3, 2f
+
+    # Load the round keys.
+    vsetivli x0, 4, e32, m1, ta, ma
+    vle32.v v10, (a3)
+    addi a3, a3, 16
+    vle32.v v11, (a3)
+    addi a3, a3, 16
+    vle32.v v12, (a3)
+    addi a3, a3, 16
+    vle32.v v13, (a3)
+    addi a3, a3, 16
+    vle32.v v14, (a3)
+    addi a3, a3, 16
+    vle32.v v15, (a3)
+    addi a3, a3, 16
+    vle32.v v16, (a3)
+    addi a3, a3, 16
+    vle32.v v17, (a3)
+
+    # t1 <- VLMAX. Generate the [3, 2, 1, 0] indices in every element
+    # group, used to reverse the order of elements in each block.
+    vsetvli t1, x0, e32, m1, ta, ma
+    vid.v v3
+    vxor.vi v3, v3, 3
+
+1:
+    # t2 <- min(t3, VLMAX). AVL <= VLMAX ensures vl == AVL, i.e., a whole
+    # number of blocks.
+    mv t2, t3
+    bleu t2, t1, 3f
+    mv t2, t1
+3:
+    vsetvli x0, t2, e32, m1, ta, ma
+
+    vle32.v v1, (a1)
+
+    vsm4r.vs v1, v10    # with round key rk[0:3]
+    vsm4r.vs v1, v11    # with round key rk[4:7]
+    vsm4r.vs v1, v12    # with round key rk[8:11]
+    vsm4r.vs v1, v13    # with round key rk[12:15]
+    vsm4r.vs v1, v14    # with round key rk[16:19]
+    vsm4r.vs v1, v15    # with round key rk[20:23]
+    vsm4r.vs v1, v16    # with round key rk[24:27]
+    vsm4r.vs v1, v17    # with round key rk[28:31]
+
+    vrgather.vv v2, v1, v3
+    vse32.v v2, (a0)
+
+    sub t3, t3, t2
+    slli t2, t2, 2
+    add a1, a1, t2
+    add a0, a0, t2
+    bnez t3, 1b
+
+2:
+    ret
+
+# zvksed_sm4_encode_rk_vs_lmul1
+
+# zvksed_sm4_encode_rk_vs_lmul2
+#
+# Same as zvksed_sm4_encode_rk_vs_lmul1, processing VLEN*2/128 blocks per
+# iteration. The round keys are kept in 8 register groups, v8-v22.
+#
+# This variant uses LMUL=2. Minimum VLEN: 64 bits.
+#
+# C/C++ Signature
+#   extern "C" void
+#   zvksed_sm4_encode_rk_vs_lmul2(
+#       void* dest,           // a0
+#       const void* src,      // a1
+#       uint64_t n,           // a2
+#       const uint32_t* rk    // a3, uint32_t[64]
+#   );
+#
+.balign 4
+.global zvksed_sm4_encode_rk_vs_lmul2
+zvksed_sm4_encode_rk_vs_lmul2:
+    srli t3, a2, 2
+    beqz t3, 2f
+
+    # Load the round keys.
+    vsetivli x0, 4, e32, m2, ta, ma
+    vle32.v v8, (a3)
+    addi a3, a3, 16
+    vle32.v v10, (a3)
+    addi a3, a3, 16
+    vle32.v v12, (a3)
+    addi a3, a3, 16
+    vle32.v v14, (a3)
+    addi a3, a3, 16
+    vle32.v v16, (a3)
+    addi a3, a3, 16
+    vle32.v v18, (a3)
+    addi a3, a3, 16
+    vle32.v v20, (a3)
+    addi a3, a3, 16
+    vle32.v v22, (a3)
+
+    vsetvli t1, x0, e32, m2, ta, ma
+    vid.v v2
+    vxor.vi v2, v2, 3
+
+1:
+    mv t2, t3
+    bleu t2, t1, 3f
+    mv t2, t1
+3:
+    vsetvli x0, t2, e32, m2, ta, ma
+
+    vle32.v v0, (a1)
+
+    vsm4r.vs v0, v8     # with round key rk[0:3]
+    vsm4r.vs v0, v10    # with round key rk[4:7]
+    vsm4r.vs v0, v12    # with round key rk[8:11]
+    vsm4r.vs v0, v14    # with round key rk[12:15]
+    vsm4r.vs v0, v16    # with round key rk[16:19]
+    vsm4r.vs v0, v18    # with round key rk[20:23]
+    vsm4r.vs v0, v20    # with round key rk[24:27]
+    vsm4r.vs v0, v22    # with round key rk[28:31]
+
+    vrgather.vv v4, v0, v2
+    vse32.v v4, (a0)
+
+    sub t3, t3, t2
+    slli t2, t2, 2
+    add a1, a1, t2
+    add a0, a0, t2
+    bnez t3, 1b
+
+2:
+    ret
+
+# zvksed_sm4_encode_rk_vs_lmul2
+
+# zvksed_sm4_encode_rk_vs_lmul4
+#
+# Same as zvksed_sm4_encode_rk_vs_lmul1, processing VLEN*4/128 blocks per
+# iteration.
+#
+# With LMUL=4, there are only 8 register groups. The data, the reversal
+# indices and the reversed output use 3 of them, the first 5 round key
+# groups are kept in the remaining ones (v12-v28), and the last 3 are
+# reloaded on every iteration, in v4 and v8, before those are needed for
+# the reversal.
+#
+# This variant uses LMUL=4. Minimum VLEN: 32 bits.
+#
+# C/C++ Signature
+#   extern "C" void
+#   zvksed_sm4_encode_rk_vs_lmul4(
+#       void* dest,           // a0
+#       const void* src,      // a1
+#       uint64_t n,           // a2
+#       const uint32_t* rk    // a3, uint32_t[64]
+#   );
+#
+.balign 4
+.global zvksed_sm4_encode_rk_vs_lmul4
+zvksed_sm4_encode_rk_vs_lmul4:
+    srli t3, a2, 2
+    beqz t3, 2f
+
+    # Load the first 5 round keys, a3 <- &rk[20].
+    vsetivli x0, 4, e32, m4, ta, ma
+    vle32.v v12, (a3)
+    addi a3, a3, 16
+    vle32.v v16, (a3)
+    addi a3, a3, 16
+    vle32.v v20, (a3)
+    addi a3, a3, 16
+    vle32.v v24, (a3)
+    addi a3, a3, 16
+    vle32.v v28, (a3)
+    addi a3, a3, 16
+    addi t4, a3, 16     # &rk[24]
+    addi t5, a3, 32     # &rk[28]
+
+    vsetvli t1, x0, e32, m4, ta, ma
+
+1:
+    mv t2, t3
+    bleu t2, t1, 3f
+    mv t2, t1
+3:
+    # Reload round keys rk[20:23] and rk[24:27].
+    vsetivli x0, 4, e32, m4, ta, ma
+    vle32.v v4, (a3)
+    vle32.v v8, (t4)
+    vsetvli x0, t2, e32, m4, ta, ma
+
+    vle32.v v0, (a1)
+
+    vsm4r.vs v0, v12    # with round key rk[0:3]
+    vsm4r.vs v0, v16    # with round key rk[4:7]
+    vsm4r.vs v0, v20    # with round key rk[8:11]
+    vsm4r.vs v0, v24    # with round key rk[12:15]
+    vsm4r.vs v0, v28    # with round key rk[16:19]
+    vsm4r.vs v0, v4     # with round key rk[20:23]
+    vsm4r.vs v0, v8     # with round key rk[24:27]
+
+    # Reload round key rk[28:31].
+    vsetivli x0, 4, e32, m4, ta, ma
+    vle32.v v4, (t5)
+    vsetvli x0, t2, e32, m4, ta, ma
+
+    vsm4r.vs v0, v4     # with round key rk[28:31]
+
+    vid.v v4
+    vxor.vi v4, v4, 3
+    vrgather.vv v8, v0, v4
+    vse32.v v8, (a0)
+
+    sub t3, t3, t2
+    slli t2, t2, 2
+    add a1, a1, t2
+    add a0, a0, t2
+    bnez t3, 1b
+
+2:
+    ret
+
+# zvksed_sm4_encode_rk_vs_lmul4
+
+# zvksed_sm4_decode_rk_vs_lmul1, zvksed_sm4_decode_rk_vs_lmul2,
+# zvksed_sm4_decode_rk_vs_lmul4
+#
+# Decodes the cipher text provided in 'src' with the round keys in 'rk',
+# as expanded by zvksed_sm4_expand_key, by encoding it with the decryption
+# schedule in the second half of 'rk'.
+#
+# C/C++ Signature
+#   extern "C" void
+#   zvksed_sm4_decode_rk_vs_lmul1(
+#       void* dest,           // a0
+#       const void* src,      // a1
+#       uint64_t n,           // a2
+#       const uint32_t* rk    // a3, uint32_t[64]
+#   );
+#
+.balign 4
+.global zvksed_sm4_decode_rk_vs_lmul1
+zvksed_sm4_decode_rk_vs_lmul1:
+    addi a3, a3, 128
+    j zvksed_sm4_encode_rk_vs_lmul1
+
+.balign 4
+.global zvksed_sm4_decode_rk_vs_lmul2
+zvksed_sm4_decode_rk_vs_lmul2:
+    addi a3, a3, 128
+    j zvksed_sm4_encode_rk_vs_lmul2
+
+.balign 4
+.global zvksed_sm4_decode_rk_vs_lmul4
+zvksed_sm4_decode_rk_vs_lmul4:
+    addi a3, a3, 128
+    j zvksed_sm4_encode_rk_vs_lmul4
+
+# zvksed_sm4_decode_rk_vs_lmul1, zvksed_sm4_decode_rk_vs_lmul2,
+# zvksed_sm4_decode_rk_vs_lmul4
+
+#
+# SM4 Counter Mode Routines
+#
+
+# zvksed_sm4_ctr32_vs_lmul2
+#
+# Counter mode (CTR) keystream generation, where the counter blocks are
+# generated in registers from a single counter block.
+#
+# For each 16 bytes block 'i' in [0, n/16):
+#   dest[i] = src[i] ^ SM4_Encrypt(inc32^i(counter_block), rk)
+# where inc32 increments the 32 bit big-endian counter held in the last
+# 4 bytes of the counter block, as in GCM. On return 'counter_block'
+# holds the counter block following the last one used, allowing to
+# call this routine repeatedly on consecutive parts of a message.
+#
+# Unlike the other routines in this file, the text and the counter block
+# are byte strings, as specified for the SM4 modes of operation. SM4
+# words being big-endian, they are byte-swapped with vrev8 (Zvkb) after
+# loading. The counter words are kept in v4 as SM4 words, group 'j'
+# holding the counter block of block 'j' of the current iteration, so
+# that the counters are incremented in place, without any byte-swapping.
+# The output words are reversed and byte-swapped back into keystream
+# bytes.
+#
+# 'rk' holds the round keys as expanded by zvksed_sm4_expand_key, only
+# the encryption schedule is used, for both encryption and decryption.
+# The round keys are kept in v10-v24, the LMUL=2 register groups leaving
+# room for the counters, the reversal indices and the group mask.
+#
+# 'n' shall be a multiple of 16B block size.
+#
+# This variant uses LMUL=2. Minimum VLEN: 64 bits.
+#
+# C/C++ Signature
+#   extern "C" void
+#   zvksed_sm4_ctr32_vs_lmul2(
+#       void* dest,               // a0
+#       const void* src,          // a1
+#       uint64_t n,               // a2
+#       const uint32_t* rk,       // a3, uint32_t[64]
+#       void* counter_block       // a4, uint8_t[16]
+#   );
+#
+.balign 4
+.global zvksed_sm4_ctr32_vs_lmul2
+zvksed_sm4_ctr32_vs_lmul2:
+    srli t3, a2, 2
+    beqz t3, 2f
+
+    # Load the round keys, and the counter block.
+    vsetivli x0, 4, e32, m2, ta, mu
+    vle32.v v10, (a3)
+    addi a3, a3, 16
+    vle32.v v12, (a3)
+    addi a3, a3, 16
+    vle32.v v14, (a3)
+    addi a3, a3, 16
+    vle32.v v16, (a3)
+    addi a3, a3, 16
+    vle32.v v18, (a3)
+    addi a3, a3, 16
+    vle32.v v20, (a3)
+    addi a3, a3, 16
+    vle32.v v22, (a3)
+    addi a3, a3, 16
+    vle32.v v24, (a3)
+    vle32.v v6, (a4)
+
+    # Replicate the counter block across all element groups, as SM4 words,
+    # and add the group index to the counters.
+    vsetvli t1, x0, e32, m2, ta, mu
+    vid.v v2
+    vand.vi v8, v2, 3
+    vmseq.vi v0, v8, 3          # v0 <- last word of each group
+    vrgather.vv v4, v6, v8
+    vrev8.v v4, v4
+    vsrl.vi v8, v2, 2           # v8 <- group index
+    vadd.vv v4, v4, v8, v0.t
+    # v2 <- [3, 2, 1, 0] indices in every element group.
+    vxor.vi v2, v2, 3
+
+1:
+    # t2 <- min(t3, VLMAX), a whole number of blocks.
+    mv t2, t3
+    bleu t2, t1, 3f
+    mv t2, t1
+3:
+    # mu: mask undisturbed, the counter updates below are masked
+    # to the last word of each element group.
+    vsetvli x0, t2, e32, m2, ta, mu
+
+    vmv.v.v v6, v4
+
+    vsm4r.vs v6, v10    # with round key rk[0:3]
+    vsm4r.vs v6, v12    # with round key rk[4:7]
+    vsm4r.vs v6, v14    # with round key rk[8:11]
+    vsm4r.vs v6, v16    # with round key rk[12:15]
+    vsm4r.vs v6, v18    # with round key rk[16:19]
+    vsm4r.vs v6, v20    # with round key rk[20:23]
+    vsm4r.vs v6, v22    # with round key rk[24:27]
+    vsm4r.vs v6, v24    # with round key rk[28:31]
+
+    # v8 <- keystream bytes.
+    vrgather.vv v8, v6, v2
+    vrev8.v v8, v8
+
+    # XOR the keystream with the source and store the result.
+    vle32.v v6, (a1)
+    vxor.vv v8, v8, v6
+    vse32.v v8, (a0)
+
+    # Advance the counters by the number of groups processed.
+    srli t4, t2, 2
+    vadd.vx v4, v4, t4, v0.t
+
+    sub t3, t3, t2
+    slli t2, t2, 2
+    add a1, a1, t2
+    add a0, a0, t2
+    bnez t3, 1b
+
+    # Store the next counter block, held in group 0.
+    vsetivli x0, 4, e32, m2, ta, mu
+    vrev8.v v4, v4
+    vse32.v v4, (a4)
+
+2:
+    ret
+
+# zvksed_sm4_ctr32_vs_lmul2
+
+#
+# SM4-XTS Routines
+#
+
+# zvksed_sm4_xts_encrypt_vs_lmul2, zvksed_sm4_xts_decrypt_vs_lmul2,
+# zvksed_sm4_xts_gb_encrypt_vs_lmul2, zvksed_sm4_xts_gb_decrypt_vs_lmul2
+#
+# XTS encryption (resp. decryption) of the 'n' bytes data unit at 'src'
+# into 'dest', with the initial tweak value 'iv' (e.g., the sector number).
+# 'n' shall be at least 16 bytes. When it is not a multiple of 16, the
+# last partial block is handled with ciphertext stealing.
+#
+# 'rks' holds the pre-expanded key pair, as two consecutive 64 words
+# schedules of zvksed_sm4_expand_key: Key1 (data), then Key2 (tweak).
+# As for zvksed_sm4_ctr32_vs_lmul2, the text and the IV are byte strings.
+#
+# The 'gb' variants follow GB/T 17964-2021, the others IEEE 1619. Both
+# multiply the tweak by alpha (x) in GF(2^128) for every block, but the
+# IEEE 1619 tweak is a little-endian polynomial, while the GB/T 17964 one
+# uses the bit-reflected representation of GCM. The tweaks are thus kept
+# in v4 in the GCM representation, as expected by vgmul (Zvkg), which is
+# the tweak itself for GB/T 17964, and the tweak with the bits of every
+# byte reversed (vbrev8, Zvkb) for IEEE 1619. In both cases x^i is the
+# bit 7 - i%8 of byte i/8.
+#
+# The tweaks of a whole register group are computed at once: group 'j'
+# of v4 starts as T o x^j, and is multiplied by x^N after every
+# iteration, N being the number of element groups. This requires N < 128,
+# i.e., VLEN < 8192 bits.
+#
+# This variant uses LMUL=2. Minimum VLEN: 64 bits.
+#
+# C/C++ Signature
+#   extern "C" void
+#   zvksed_sm4_xts_encrypt_vs_lmul2(
+#       void* dest,               // a0
+#       const void* src,          // a1
+#       uint64_t n,               // a2
+#       const uint32_t* rks,      // a3, uint32_t[128]
+#       const void* iv            // a4, uint8_t[16]
+#   );
+#
+.balign 4
+.global zvksed_sm4_xts_encrypt_vs_lmul2
+zvksed_sm4_xts_encrypt_vs_lmul2:
+    li a7, 0
+    j zvksed_sm4_xts_vs_lmul2
+
+.balign 4
+.global zvksed_sm4_xts_decrypt_vs_lmul2
+zvksed_sm4_xts_decrypt_vs_lmul2:
+    li a7, 1
+    j zvksed_sm4_xts_vs_lmul2
+
+.balign 4
+.global zvksed_sm4_xts_gb_encrypt_vs_lmul2
+zvksed_sm4_xts_gb_encrypt_vs_lmul2:
+    li a7, 2
+    j zvksed_sm4_xts_vs_lmul2
+
+.balign 4
+.global zvksed_sm4_xts_gb_decrypt_vs_lmul2
+zvksed_sm4_xts_gb_decrypt_vs_lmul2:
+    li a7, 3
+
+# a7 bit 0: decryption, a7 bit 1: GB/T 17964 tweaks.
+zvksed_sm4_xts_vs_lmul2:
+    li t0, 16
+    bltu a2, t0, 9f
+
+    # T = E(Key2, iv), v26 <- T in the GCM representation.
+    vsetivli x0, 4, e32, m2, ta, ma
+    addi t0, a3, 256
+    vle32.v v10, (t0)
+    addi t0, t0, 16
+    vle32.v v12, (t0)
+    addi t0, t0, 16
+    vle32.v v14, (t0)
+    addi t0, t0, 16
+    vle32.v v16, (t0)
+    addi t0, t0, 16
+    vle32.v v18, (t0)
+    addi t0, t0, 16
+    vle32.v v20, (t0)
+    addi t0, t0, 16
+    vle32.v v22, (t0)
+    addi t0, t0, 16
+    vle32.v v24, (t0)
+
+    vid.v v28
+    vxor.vi v28, v28, 3
+    vle32.v v8, (a4)
+    vrev8.v v8, v8
+    vsm4r.vs v8, v10
+    vsm4r.vs v8, v12
+    vsm4r.vs v8, v14
+    vsm4r.vs v8, v16
+    vsm4r.vs v8, v18
+    vsm4r.vs v8, v20
+    vsm4r.vs v8, v22
+    vsm4r.vs v8, v24
+    vrgather.vv v26, v8, v28
+    vrev8.v v26, v26
+    andi t0, a7, 2
+    bnez t0, 1f
+    vbrev8.v v26, v26
+1:
+
+    # Load the Key1 round keys, the decryption schedule when decrypting.
+    andi t0, a7, 1
+    slli t0, t0, 7
+    add a3, a3, t0
+    vle32.v v10, (a3)
+    addi a3, a3, 16
+    vle32.v v12, (a3)
+    addi a3, a3, 16
+    vle32.v v14, (a3)
+    addi a3, a3, 16
+    vle32.v v16, (a3)
+    addi a3, a3, 16
+    vle32.v v18, (a3)
+    addi a3, a3, 16
+    vle32.v v20, (a3)
+    addi a3, a3, 16
+    vle32.v v22, (a3)
+    addi a3, a3, 16
+    vle32.v v24, (a3)
+
+    # t1 <- VLMAX, v28 <- [3, 2, 1, 0] indices in every element group.
+    vsetvli t1, x0, e32, m2, ta, ma
+    vid.v v2
+    vxor.vi v28, v2, 3
+
+    # v4 <- T replicated across all element groups.
+    vand.vi v8, v2, 3
+    vrgather.vv v4, v26, v8
+
+    # v6 <- x^j in group 'j', i.e., word j/32 of group 'j' holds the
+    # little-endian 1 << (j%32), with the bits of every byte reversed.
+    vsrl.vi v6, v2, 2           # v6 <- j
+    vsrl.vi v30, v6, 5
+    vmseq.vv v0, v30, v8        # v0 <- word j/32 of each group
+    vand.vi v30, v6, 31
+    vmv.v.i v6, 1
+    vsll.vv v6, v6, v30
+    vmv.v.i v30, 0
+    vmerge.vvm v6, v30, v6, v0
+    vbrev8.v v6, v6
+
+    # v4 <- T o x^j in group 'j'.
+    vgmul.vv v4, v6
+
+    # v6 <- x^N in all element groups.
+    srli t2, t1, 2
+    srli t0, t2, 5
+    vmseq.vx v0, v8, t0
+    andi t0, t2, 31
+    li t4, 1
+    sll t4, t4, t0
+    vmv.v.i v6, 0
+    vmerge.vxm v6, v6, t4, v0
+    vbrev8.v v6, v6
+
+    # t3 <- number of 4B elements processed by the main loop, keeping the
+    # last full block for the ciphertext stealing when 'n' is not a
+    # multiple of 16. t5 <- n % 16.
+    srli t3, a2, 4
+    andi t5, a2, 15
+    beqz t5, 2f
+    addi t3, t3, -1
+2:
+    slli t3, t3, 2
+    # t6 <- index of the group of v4 holding the tweak of the next block.
+    li t6, 0
+    beqz t3, 5f
+
+3:
+    mv t2, t3
+    bleu t2, t1, 4f
+    mv t2, t1
+4:
+    vsetvli x0, t2, e32, m2, ta, ma
+
+    # v26 <- tweaks, as byte strings.
+    vmv.v.v v26, v4
+    andi t0, a7, 2
+    bnez t0, 6f
+    vbrev8.v v26, v26
+6:
+
+    vle32.v v8, (a1)
+    vxor.vv v8, v8, v26
+    vrev8.v v8, v8
+    vsm4r.vs v8, v10    # with round key rk[0:3]
+    vsm4r.vs v8, v12    # with round key rk[4:7]
+    vsm4r.vs v8, v14    # with round key rk[8:11]
+    vsm4r.vs v8, v16    # with round key rk[12:15]
+    vsm4r.vs v8, v18    # with round key rk[16:19]
+    vsm4r.vs v8, v20    # with round key rk[20:23]
+    vsm4r.vs v8, v22    # with round key rk[24:27]
+    vsm4r.vs v8, v24    # with round key rk[28:31]
+    vrgather.vv v30, v8, v28
+    vrev8.v v30, v30
+    vxor.vv v30, v30, v26
+    vse32.v v30, (a0)
+
+    sub t3, t3, t2
+    slli t0, t2, 2
+    add a1, a1, t0
+    add a0, a0, t0
+
+    # A partial iteration is the last one, the next tweak is then in
+    # group t2/4 of v4. Otherwise, move on to the tweaks of the next
+    # iteration.
+    bgeu t2, t1, 7f
+    srli t6, t2, 2
+    j 5f
+7:
+    vgmul.vv v4, v6
+    bnez t3, 3b
+
+5:
+    # Ciphertext stealing.
+    beqz t5, 9f
+
+    # v26 <- T_a, tweak of the last full block, v6 <- T_b = T_a o x.
+    vsetvli x0, t1, e32, m2, ta, ma
+    slli t0, t6, 2
+    vslidedown.vx v26, v4, t0
+    # vmv.s.x only writes element 0, elements 1-3 are tail elements for it:
+    # they must be undisturbed (tu) to keep the zeros written by vmv.v.i,
+    # 'ta' would allow them to be overwritten with 1s.
+    vsetivli x0, 4, e32, m2, tu, ma
+    vmv.v.i v2, 0
+    li t0, 0x40
+    vmv.s.x v2, t0
+    vmv.v.v v6, v26
+    vgmul.vv v6, v2
+
+    # Encryption uses T_a then T_b, decryption T_b then T_a.
+    andi t0, a7, 1
+    beqz t0, 10f
+    vmv.v.v v2, v26
+    vmv.v.v v26, v6
+    vmv.v.v v6, v2
+10:
+    andi t0, a7, 2
+    bnez t0, 11f
+    vbrev8.v v26, v26
+    vbrev8.v v6, v6
+11:
+
+    # dest[0:16] <- CC, the last full block processed with the first
+    # tweak.
+    vle32.v v8, (a1)
+    vxor.vv v8, v8, v26
+    vrev8.v v8, v8
+    vsm4r.vs v8, v10
+    vsm4r.vs v8, v12
+    vsm4r.vs v8, v14
+    vsm4r.vs v8, v16
+    vsm4r.vs v8, v18
+    vsm4r.vs v8, v20
+    vsm4r.vs v8, v22
+    vsm4r.vs v8, v24
+    vrgather.vv v30, v8, v28
+    vrev8.v v30, v30
+    vxor.vv v30, v30, v26
+    vse32.v v30, (a0)
+
+    # Steal: the partial last block receives the first n%16 bytes of CC,
+    # which are replaced by the partial block of 'src'.
+    # The source byte is read first, as 'src' may be 'dest'.
+    mv t0, a0
+    addi t2, a1, 16
+    add t3, a0, t5
+12:
+    lbu t4, 0(t2)
+    lbu a5, 0(t0)
+    sb a5, 16(t0)
+    sb t4, 0(t0)
+    addi t0, t0, 1
+    addi t2, t2, 1
+    bne t0, t3, 12b
+
+    # dest[0:16] <- the stitched block processed with the second tweak.
+    vle32.v v8, (a0)
+    vxor.vv v8, v8, v6
+    vrev8.v v8, v8
+    vsm4r.vs v8, v10
+    vsm4r.vs v8, v12
+    vsm4r.vs v8, v14
+    vsm4r.vs v8, v16
+    vsm4r.vs v8, v18
+    vsm4r.vs v8, v20
+    vsm4r.vs v8, v22
+    vsm4r.vs v8, v24
+    vrgather.vv v30, v8, v28
+    vrev8.v v30, v30
+    vxor.vv v30, v30, v6
+    vse32.v v30, (a0)
+
+9:
+    ret
+
+# zvksed_sm4_xts_encrypt_vs_lmul2, zvksed_sm4_xts_decrypt_vs_lmul2,
+# zvksed_sm4_xts_gb_encrypt_vs_lmul2, zvksed_sm4_xts_gb_decrypt_vs_lmul2
+
+#
+# SM4-CBC and SM4-CFB Routines
+#
+# As for the counter mode, the text and the IV are byte strings. On return
+# 'iv' holds the last ciphertext block, allowing to call these routines
+# repeatedly on consecutive parts of a message. 'n' shall be a multiple of
+# 16B block size.
+#
+# Encryption is serial, one block per iteration, with the chaining value
+# kept in a register. Decryption processes VLEN*2/128 blocks per iteration:
+# the previous ciphertext blocks are obtained by sliding the ciphertext up
+# by one element group, the first group being filled with the last
+# ciphertext block of the previous iteration (or the IV), which is kept
+# in the first group of v12.
+#
+# The round keys are kept in v16-v30. The encryption routines, and the
+# CFB decryption, use the encryption schedule of 'rk', the CBC decryption
+# the decryption schedule.
+#
+# These routines use LMUL=2. Minimum VLEN: 64 bits.
+#
+# C/C++ Signature
+#   extern "C" void
+#   zvksed_sm4_cbc_encrypt_vs_lmul2(
+#       void* dest,               // a0
+#       const void* src,          // a1
+#       uint64_t n,               // a2
+#       const uint32_t* rk,       // a3, uint32_t[64]
+#       void* iv                  // a4, uint8_t[16]
+#   );
+#
+
+# zvksed_sm4_cbc_encrypt_vs_lmul2
+#
+#   dest[i] = SM4_Encrypt(src[i] ^ dest[i - 1]), dest[-1] = iv
+#
+.balign 4
+.global zvksed_sm4_cbc_encrypt_vs_lmul2
+zvksed_sm4_cbc_encrypt_vs_lmul2:
+    beqz a2, 2f
+
+    vsetivli x0, 4, e32, m2, ta, ma
+    vle32.v v16, (a3)
+    addi a3, a3, 16
+    vle32.v v18, (a3)
+    addi a3, a3, 16
+    vle32.v v20, (a3)
+    addi a3, a3, 16
+    vle32.v v22, (a3)
+    addi a3, a3, 16
+    vle32.v v24, (a3)
+    addi a3, a3, 16
+    vle32.v v26, (a3)
+    addi a3, a3, 16
+    vle32.v v28, (a3)
+    addi a3, a3, 16
+    vle32.v v30, (a3)
+
+    vid.v v2
+    vxor.vi v2, v2, 3
+
+    # v4 <- chaining value, as SM4 words.
+    vle32.v v4, (a4)
+    vrev8.v v4, v4
+
+1:
+    vle32.v v6, (a1)
+    vrev8.v v6, v6
+    vxor.vv v8, v6, v4
+
+    vsm4r.vs v8, v16    # with round key rk[0:3]
+    vsm4r.vs v8, v18    # with round key rk[4:7]
+    vsm4r.vs v8, v20    # with round key rk[8:11]
+    vsm4r.vs v8, v22    # with round key rk[12:15]
+    vsm4r.vs v8, v24    # with round key rk[16:19]
+    vsm4r.vs v8, v26    # with round key rk[20:23]
+    vsm4r.vs v8, v28    # with round key rk[24:27]
+    vsm4r.vs v8, v30    # with round key rk[28:31]
+
+    vrgather.vv v4, v8, v2
+    vrev8.v v6, v4
+    vse32.v v6, (a0)
+
+    addi a2, a2, -16
+    addi a1, a1, 16
+    addi a0, a0, 16
+    bnez a2, 1b
+
+    vse32.v v6, (a4)
+
+2:
+    ret
+
+# zvksed_sm4_cbc_encrypt_vs_lmul2
+
+# zvksed_sm4_cbc_decrypt_vs_lmul2
+#
+#   dest[i] = SM4_Decrypt(src[i]) ^ src[i - 1], src[-1] = iv
+#
+.balign 4
+.global zvksed_sm4_cbc_decrypt_vs_lmul2
+zvksed_sm4_cbc_decrypt_vs_lmul2:
+    srli t3, a2, 2
+    beqz t3, 2f
+
+    # Load the decryption round keys.
+    addi a3, a3, 128
+    vsetivli x0, 4, e32, m2, ta, ma
+    vle32.v v16, (a3)
+    addi a3, a3, 16
+    vle32.v v18, (a3)
+    addi a3, a3, 16
+    vle32.v v20, (a3)
+    addi a3, a3, 16
+    vle32.v v22, (a3)
+    addi a3, a3, 16
+    vle32.v v24, (a3)
+    addi a3, a3, 16
+    vle32.v v26, (a3)
+    addi a3, a3, 16
+    vle32.v v28, (a3)
+    addi a3, a3, 16
+    vle32.v v30, (a3)
+    vle32.v v12, (a4)
+
+    vsetvli t1, x0, e32, m2, ta, ma
+    vid.v v2
+    vxor.vi v2, v2, 3
+
+1:
+    mv t2, t3
+    bleu t2, t1, 3f
+    mv t2, t1
+3:
+    vsetvli x0, t2, e32, m2, ta, ma
+
+    # v12 <- previous ciphertext blocks, its first group already holding
+    # the block preceding this iteration.
+    vle32.v v6, (a1)
+    vslideup.vi v12, v6, 4
+
+    vrev8.v v8, v6
+    vsm4r.vs v8, v16    # with round key rk[31:28]
+    vsm4r.vs v8, v18    # with round key rk[27:24]
+    vsm4r.vs v8, v20    # with round key rk[23:20]
+    vsm4r.vs v8, v22    # with round key rk[19:16]
+    vsm4r.vs v8, v24    # with round key rk[15:12]
+    vsm4r.vs v8, v26    # with round key rk[11:8]
+    vsm4r.vs v8, v28    # with round key rk[7:4]
+    vsm4r.vs v8, v30    # with round key rk[3:0]
+
+    vrgather.vv v10, v8, v2
+    vrev8.v v10, v10
+    vxor.vv v10, v10, v12
+    vse32.v v10, (a0)
+
+    # Carry the last ciphertext block over, in the first group of v12.
+    addi t4, t2, -4
+    vslidedown.vx v12, v6, t4
+
+    sub t3, t3, t2
+    slli t2, t2, 2
+    add a1, a1, t2
+    add a0, a0, t2
+    bnez t3, 1b
+
+    vsetivli x0, 4, e32, m2, ta, ma
+    vse32.v v12, (a4)
+
+2:
+    ret
+
+# zvksed_sm4_cbc_decrypt_vs_lmul2
+
+# zvksed_sm4_cfb_encrypt_vs_lmul2
+#
+#   dest[i] = src[i] ^ SM4_Encrypt(dest[i - 1]), dest[-1] = iv
+#
+.balign 4
+.global zvksed_sm4_cfb_encrypt_vs_lmul2
+zvksed_sm4_cfb_encrypt_vs_lmul2:
+    beqz a2, 2f
+
+    vsetivli x0, 4, e32, m2, ta, ma
+    vle32.v v16, (a3)
+    addi a3, a3, 16
+    vle32.v v18, (a3)
+    addi a3, a3, 16
+    vle32.v v20, (a3)
+    addi a3, a3, 16
+    vle32.v v22, (a3)
+    addi a3, a3, 16
+    vle32.v v24, (a3)
+    addi a3, a3, 16
+    vle32.v v26, (a3)
+    addi a3, a3, 16
+    vle32.v v28, (a3)
+    addi a3, a3, 16
+    vle32.v v30, (a3)
+
+    vid.v v2
+    vxor.vi v2, v2, 3
+
+    # v4 <- chaining value, as SM4 words.
+    vle32.v v4, (a4)
+    vrev8.v v4, v4
+
+1:
+    vmv.v.v v8, v4
+    vsm4r.vs v8, v16    # with round key rk[0:3]
+    vsm4r.vs v8, v18    # with round key rk[4:7]
+    vsm4r.vs v8, v20    # with round key rk[8:11]
+    vsm4r.vs v8, v22    # with round key rk[12:15]
+    vsm4r.vs v8, v24    # with round key rk[16:19]
+    vsm4r.vs v8, v26    # with round key rk[20:23]
+    vsm4r.vs v8, v28    # with round key rk[24:27]
+    vsm4r.vs v8, v30    # with round key rk[28:31]
+    vrgather.vv v10, v8, v2
+
+    vle32.v v6, (a1)
+    vrev8.v v6, v6
+    vxor.vv v4, v10, v6
+    vrev8.v v6, v4
+    vse32.v v6, (a0)
+
+    addi a2, a2, -16
+    addi a1, a1, 16
+    addi a0, a0, 16
+    bnez a2, 1b
+
+    vse32.v v6, (a4)
+
+2:
+    ret
+
+# zvksed_sm4_cfb_encrypt_vs_lmul2
+
+# zvksed_sm4_cfb_decrypt_vs_lmul2
+#
+#   dest[i] = src[i] ^ SM4_Encrypt(src[i - 1]), src[-1] = iv
+#
+.balign 4
+.global zvksed_sm4_cfb_decrypt_vs_lmul2
+zvksed_sm4_cfb_decrypt_vs_lmul2:
+    srli t3, a2, 2
+    beqz t3, 2f
+
+    vsetivli x0, 4, e32, m2, ta, ma
+    vle32.v v16, (a3)
+    addi a3, a3, 16
+    vle32.v v18, (a3)
+    addi a3, a3, 16
+    vle32.v v20, (a3)
+    addi a3, a3, 16
+    vle32.v v22, (a3)
+    addi a3, a3, 16
+    vle32.v v24, (a3)
+    addi a3, a3, 16
+    vle32.v v26, (a3)
+    addi a3, a3, 16
+    vle32.v v28, (a3)
+    addi a3, a3, 16
+    vle32.v v30, (a3)
+    vle32.v v12, (a4)
+
+    vsetvli t1, x0, e32, m2, ta, ma
+    vid.v v2
+    vxor.vi v2, v2, 3
+
+1:
+    mv t2, t3
+    bleu t2, t1, 3f
+    mv t2, t1
+3:
+    vsetvli x0, t2, e32, m2, ta, ma
+
+    # v12 <- previous ciphertext blocks, as for the CBC decryption.
+    vle32.v v6, (a1)
+    vslideup.vi v12, v6, 4
+
+    vrev8.v v8, v12
+    vsm4r.vs v8, v16    # with round key rk[0:3]
+    vsm4r.vs v8, v18    # with round key rk[4:7]
+    vsm4r.vs v8, v20    # with round key rk[8:11]
+    vsm4r.vs v8, v22    # with round key rk[12:15]
+    vsm4r.vs v8, v24    # with round key rk[16:19]
+    vsm4r.vs v8, v26    # with round key rk[20:23]
+    vsm4r.vs v8, v28    # with round key rk[24:27]
+    vsm4r.vs v8, v30    # with round key rk[28:31]
+
+    vrgather.vv v10, v8, v2
+    vrev8.v v10, v10
+    vxor.vv v10, v10, v6
+    vse32.v v10, (a0)
+
+    addi t4, t2, -4
+    vslidedown.vx v12, v6, t4
+
+    sub t3, t3, t2
+    slli t2, t2, 2
+    add a1, a1, t2
+    add a0, a0, t2
+    bnez t3, 1b
+
+    vsetivli x0, 4, e32, m2, ta, ma
+    vse32.v v12, (a4)
+
+2:
+    ret
+
+# zvksed_sm4_cfb_decrypt_vs_lmul2
+
+#
+# Multi-key SM4 Routines
+#
+
+# zvksed_sm4_encrypt_jobs_vv_lmul2, zvksed_sm4_decrypt_jobs_vv_lmul2
+#
+# Encrypts (resp. decrypts) 'njobs' independent blocks, each under its
+# own key. A job is 32 bytes: a 16 bytes master key followed by a 16 bytes
+# block, which is replaced by the result. As for the counter mode, the
+# keys and blocks are byte strings.
+#
+# Each element group holds a different job. The keys are expanded in
+# registers with vsm4k.vi, one round key group per register group in
+# v16-v30, and used right away with vsm4r.vv, which takes the round keys
+# of each element group from the matching group of its key operand. No
+# round key is stored to memory. Decryption uses the same round keys in
+# reverse order, the words of each group being reversed with vrgather.
+#
+# The keys and blocks are gathered and the results scattered with indexed
+# accesses: element 'i' belongs to job i/4, word i%4, at offset
+# 32*(i/4) + 4*(i%4) for the key and 16 more for the block.
+#
+# This variant uses LMUL=2. Minimum VLEN: 64 bits.
+#
+# C/C++ Signature
+#   extern "C" void
+#   zvksed_sm4_encrypt_jobs_vv_lmul2(
+#       struct zvksed_sm4_job* jobs,  // a0
+#       uint64_t njobs                // a1
+#   );
+#
+.balign 4
+.global zvksed_sm4_encrypt_jobs_vv_lmul2
+zvksed_sm4_encrypt_jobs_vv_lmul2:
+    li a7, 0
+    j zvksed_sm4_jobs_vv_lmul2
+
+.balign 4
+.global zvksed_sm4_decrypt_jobs_vv_lmul2
+zvksed_sm4_decrypt_jobs_vv_lmul2:
+    li a7, 1
+
+# a7: decryption.
+zvksed_sm4_jobs_vv_lmul2:
+    beqz a1, 2f
+
+    # t3 = number of words left.
+    slli t3, a1, 2
+    vsetvli t1, x0, e32, m2, ta, ma
+
+    # v2 = 4*(i%4) + 32*(i/4), v6 = [3, 2, 1, 0] indices in every element
+    # group.
+    vid.v v0
+    vxor.vi v6, v0, 3
+    vand.vi v4, v0, 3
+    vsll.vi v4, v4, 2
+    vsrl.vi v2, v0, 2
+    vsll.vi v2, v2, 5
+    vadd.vv v2, v2, v4
+
+    # FK, replicated in every element group.
+    la t0, FK
+    vluxei32.v v12, (t0), v4
+
+    addi a2, a0, 16
+
+1:
+    # t2 <- min(t3, VLMAX), a whole number of jobs.
+    mv t2, t3
+    bleu t2, t1, 3f
+    mv t2, t1
+3:
+    vsetvli x0, t2, e32, m2, ta, ma
+
+    vluxei32.v v10, (a0), v2
+    vrev8.v v10, v10
+    vxor.vv v10, v10, v12
+    vluxei32.v v8, (a2), v2
+    vrev8.v v8, v8
+
+    vsm4k.vi v16, v10, 0
+    vsm4k.vi v18, v16, 1
+    vsm4k.vi v20, v18, 2
+    vsm4k.vi v22, v20, 3
+    vsm4k.vi v24, v22, 4
+    vsm4k.vi v26, v24, 5
+    vsm4k.vi v28, v26, 6
+    vsm4k.vi v30, v28, 7
+
+    bnez a7, 4f
+    vsm4r.vv v8, v16    # with round keys rk[0:3]
+    vsm4r.vv v8, v18    # with round keys rk[4:7]
+    vsm4r.vv v8, v20    # with round keys rk[8:11]
+    vsm4r.vv v8, v22    # with round keys rk[12:15]
+    vsm4r.vv v8, v24    # with round keys rk[16:19]
+    vsm4r.vv v8, v26    # with round keys rk[20:23]
+    vsm4r.vv v8, v28    # with round keys rk[24:27]
+    vsm4r.vv v8, v30    # with round keys rk[28:31]
+    j 5f
+4:
+    vrgather.vv v10, v30, v6
+    vsm4r.vv v8, v10    # with round keys rk[31:28]
+    vrgather.vv v10, v28, v6
+    vsm4r.vv v8, v10    # with round keys rk[27:24]
+    vrgather.vv v10, v26, v6
+    vsm4r.vv v8, v10    # with round keys rk[23:20]
+    vrgather.vv v10, v24, v6
+    vsm4r.vv v8, v10    # with round keys rk[19:16]
+    vrgather.vv v10, v22, v6
+    vsm4r.vv v8, v10    # with round keys rk[15:12]
+    vrgather.vv v10, v20, v6
+    vsm4r.vv v8, v10    # with round keys rk[11:8]
+    vrgather.vv v10, v18, v6
+    vsm4r.vv v8, v10    # with round keys rk[7:4]
+    vrgather.vv v10, v16, v6
+    vsm4r.vv v8, v10    # with round keys rk[3:0]
+5:
+    vrgather.vv v10, v8, v6
+    vrev8.v v10, v10
+    vsuxei32.v v10, (a2), v2
+
+    # 8 bytes of job per word.
+    sub t3, t3, t2
+    slli t2, t2, 3
+    add a0, a0, t2
+    add a2, a2, t2
+    bnez t3, 1b
+
+2:
+    ret
+
+# zvksed_sm4_encrypt_jobs_vv_lmul2
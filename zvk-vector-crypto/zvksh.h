@@ -17,6 +17,9 @@
 
 #include <stdint.h>
 
+#define SM3_DIGEST_SIZE 32
+#define SM3_BLOCK_SIZE 64
+
 extern void
 zvksh_sm3_encode_lmul1(
     void* dest,
@@ -38,4 +41,44 @@ zvksh_sm3_encode_lmul4(
     uint64_t length
 );
 
+// Variants taking the chaining value from 'state' and writing it back,
+// for messages hashed in chunks. 'state' holds the intermediate hash value
+// in the byte order of the digest (big-endian A to H). 'length' is a
+// multiple of SM3_BLOCK_SIZE, no padding is added. The minimum VLEN is 256
+// bits for LMUL=1, 128 bits for LMUL=2 and 64 bits for LMUL=4.
+
+extern void
+zvksh_sm3_blocks_lmul1(
+    void* state,
+    const void* src,
+    uint64_t length
+);
+
+extern void
+zvksh_sm3_blocks_lmul2(
+    void* state,
+    const void* src,
+    uint64_t length
+);
+
+extern void
+zvksh_sm3_blocks_lmul4(
+    void* state,
+    const void* src,
+    uint64_t length
+);
+
+// Multi-buffer variant, hashing independent messages in lockstep, one
+// message per 256b element group. 'states' holds 'nlanes' hash values in
+// the representation above, message 'i' has counts[i] blocks at ptrs[i].
+// Minimum VLEN: 256 bits.
+
+extern void
+zvksh_sm3_multi_blocks_lmul1(
+    void* states,
+    const void* const* ptrs,
+    const uint32_t* counts,
+    uint64_t nlanes
+);
+
 #endif  // ZVKNS_H_
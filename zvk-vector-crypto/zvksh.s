@@ -77,7 +77,33 @@ zvksh_sm3_encode_lmul1:
 
     la t6, IV
     vle32.v v4, (t6)
+    j 0f
 
+# zvksh_sm3_blocks_lmul1
+#
+# Same as zvksh_sm3_encode_lmul1, with the chaining value taken from and
+# written back to 'state', so that long messages can be hashed in chunks.
+# 'state' holds the 8 words of the intermediate hash value in the byte
+# order of the digest, i.e., big-endian A to H, which is the digest itself
+# once the padded message has been processed. Nothing is padded, 'n' may
+# be 0.
+#
+# C/C++ Signature
+#   extern "C" void
+#   zvksh_sm3_blocks_lmul1(
+#       void* state,       // a0, uint8_t[32]
+#       const void* src,   // a1
+#       uint64_t n,        // a2
+#   );
+#
+.balign 4
+.global zvksh_sm3_blocks_lmul1
+zvksh_sm3_blocks_lmul1:
+    beqz a2, 2f
+    vsetivli x0, 8, e32, m1, ta, ma
+    vle32.v v4, (a0)
+
+0:
     # Set v0 to select the four least significant words (indices 0,1,2, and 3).
     # v0[i] <- i
     vid.v v0
@@ -246,6 +272,7 @@ zvksh_sm3_encode_lmul1:
     bnez a2, 1b     # Loop if there are more blocks.
 
     vse32.v v4, (a0)
+2:
     ret
 
 
@@ -262,7 +289,20 @@ zvksh_sm3_encode_lmul2:
 
     la t6, IV
     vle32.v v4, (t6)
+    j 0f
+
+# zvksh_sm3_blocks_lmul2
+#
+# Same as zvksh_sm3_blocks_lmul1, with LMUL=2.
+#
+.balign 4
+.global zvksh_sm3_blocks_lmul2
+zvksh_sm3_blocks_lmul2:
+    beqz a2, 2f
+    vsetivli x0, 8, e32, m2, ta, ma
+    vle32.v v4, (a0)
 
+0:
     vid.v v0
     vmsleu.vi v0, v0, 0x3
 
@@ -390,6 +430,7 @@ zvksh_sm3_encode_lmul2:
     bnez a2, 1b
 
     vse32.v v4, (a0)
+2:
     ret
 
 
@@ -406,7 +447,20 @@ zvksh_sm3_encode_lmul4:
 
     la t6, IV
     vle32.v v4, (t6)
+    j 0f
 
+# zvksh_sm3_blocks_lmul4
+#
+# Same as zvksh_sm3_blocks_lmul1, with LMUL=4.
+#
+.balign 4
+.global zvksh_sm3_blocks_lmul4
+zvksh_sm3_blocks_lmul4:
+    beqz a2, 2f
+    vsetivli x0, 8, e32, m4, ta, ma
+    vle32.v v4, (a0)
+
+0:
     vid.v v0
     vmsleu.vi v0, v0, 0x3
 
@@ -534,6 +588,7 @@ zvksh_sm3_encode_lmul4:
     bnez a2, 1b
 
     vse32.v v4, (a0)
+2:
     ret
 
 
@@ -542,3 +597,250 @@ zvksh_sm3_encode_lmul4:
 # and reloading for the final XOR. This still leaves us two groups short
 # to simply use LMUL=8 without significant logic changes.
 
+# zvksh_sm3_multi_blocks_lmul1
+#
+# Hashes 'nlanes' independent messages in lockstep, one message per 256b
+# element group: group 'i' of the state and message registers holds the
+# values of message 'i'. A single vsm3c/vsm3me instruction thus advances
+# VLEN/256 messages at once. Messages beyond VLEN/256 are processed in
+# successive batches.
+#
+# states: nlanes hash values, 32 bytes each, in the representation of
+#         zvksh_sm3_blocks_lmul1 (the byte order of the digest).
+# ptrs: nlanes pointers to the blocks of each message.
+# counts: nlanes uint32_t, number of 64 bytes blocks to hash for each
+#         message.
+#
+# Messages may have different numbers of blocks. A message for which all
+# blocks have been hashed is masked out: its blocks are not loaded, and its
+# hash value is left unchanged by the following blocks of the other
+# messages. The batch ends when all its messages are done.
+#
+# The message blocks are loaded with indexed loads (vluxei64), using
+# per-element addresses. The states being contiguous, they are loaded and
+# stored with unit-stride accesses. The slides of the single message
+# routines stay within element groups for the elements consumed by vsm3c,
+# the vmerge mask selects the first 4 words of every group.
+#
+# Minimum VLEN: 256 bits.
+#
+# C/C++ Signature
+#  extern "C" void
+#  zvksh_sm3_multi_blocks_lmul1(
+#      void* states,               // a0
+#      const void* const* ptrs,    // a1
+#      const uint32_t* counts,     // a2
+#      uint64_t nlanes             // a3
+#  );
+#
+.balign 4
+.global zvksh_sm3_multi_blocks_lmul1
+zvksh_sm3_multi_blocks_lmul1:
+
+    # Register use in this function:
+    #  v4: evolving hash states, one message per group
+    #  v8: the hash values at the start of the current block
+    #  v12, v16, v20, v24: (expanded) message words, as in the single
+    #    message routines
+    #  v15: vmerge mask, copied in v0 during the rounds
+    #  v9: number of remaining blocks of each message
+    #  v28 - v29: address of the next block of each message, per element
+    #  v0: mask of the messages still having blocks, or vmerge mask
+    #  t1: number of elements processed by the current batch
+
+    # t3 <- number of remaining 4B elements, 8 per message
+    slli t3, a3, 3
+    beqz t3, 2f
+
+    li t5, 32
+    li a5, 64
+    vsetvli t0, x0, e32, m1, ta, mu
+
+1:
+    # Batch loop, processing t1/8 messages. t1 <- min(t3, VLMAX), a
+    # whole number of messages.
+    mv t1, t3
+    bleu t1, t0, 5f
+    mv t1, t0
+5:
+    vsetvli x0, t1, e32, m1, ta, mu
+
+    # v15 <- vmerge mask, first 4 words of each group, i.e., (i & 7) <= 3
+    vid.v v14
+    vand.vi v14, v14, 7
+    vmsleu.vi v15, v14, 3
+
+    vle32.v v4, (a0)
+
+    # v9 <- counts[i >> 3], using v14 = 4 * (i >> 3) as offsets.
+    vid.v v14
+    vsrl.vi v14, v14, 3
+    vsll.vi v14, v14, 2
+    vluxei32.v v9, (a2), v14
+
+    # v28 <- ptrs[i >> 3] + 4 * (i & 7), computed with 64b elements.
+    vsetvli x0, x0, e64, m2, ta, mu
+    vid.v v10
+    vsrl.vi v10, v10, 3
+    vsll.vi v10, v10, 3
+    vluxei64.v v28, (a1), v10
+    vid.v v10
+    vand.vi v10, v10, 7
+    vsll.vi v10, v10, 2
+    vadd.vv v28, v28, v10
+    vsetvli x0, x0, e32, m1, ta, mu
+
+3:
+    # Block loop. v0 <- messages still having blocks.
+    vmsne.vi v0, v9, 0
+    vcpop.m t2, v0
+    beqz t2, 4f
+
+    # Load the next 512-bits block of each active message, in 2x32B
+    # chunks.
+    vluxei64.v v12, (x0), v28, v0.t
+    vluxei64.v v16, (t5), v28, v0.t
+
+    vmv.v.v v8, v4
+    vmv1r.v v0, v15
+
+    vslidedown.vi v20, v12, 2
+
+    vsm3c.vi v4, v12, 0
+    vsm3c.vi v4, v20, 1
+
+    vslidedown.vi v20, v20, 2
+    vslideup.vi v24, v16, 4
+    vmerge.vvm v20, v24, v20, v0
+
+    vsm3c.vi v4, v20, 2
+    vslidedown.vi v20, v20, 2
+    vsm3c.vi v4, v20, 3
+
+    vsm3c.vi v4, v16, 4
+    vslidedown.vi v20, v16, 2
+    vsm3c.vi v4, v20, 5
+
+    vsm3me.vv v12, v16, v12
+
+    vslidedown.vi v20, v20, 2
+    vslideup.vi v24, v12, 4
+    vmerge.vvm v20, v24, v20, v0
+
+    vsm3c.vi v4, v20, 6
+    vslidedown.vi v20, v20, 2
+    vsm3c.vi v4, v20, 7
+
+    vsm3c.vi v4, v12, 8
+    vslidedown.vi v20, v12, 2
+    vsm3c.vi v4, v20, 9
+
+    vsm3me.vv v16, v12, v16
+
+    vslidedown.vi v20, v20, 2
+    vslideup.vi v24, v16, 4
+    vmerge.vvm v20, v24, v20, v0
+
+    vsm3c.vi v4, v20, 10
+    vslidedown.vi v20, v20, 2
+    vsm3c.vi v4, v20, 11
+
+    vsm3c.vi v4, v16, 12
+    vslidedown.vi v20, v16, 2
+    vsm3c.vi v4, v20, 13
+
+    vsm3me.vv v12, v16, v12
+
+    vslidedown.vi v20, v20, 2
+    vslideup.vi v24, v12, 4
+    vmerge.vvm v20, v24, v20, v0
+
+    vsm3c.vi v4, v20, 14
+    vslidedown.vi v20, v20, 2
+    vsm3c.vi v4, v20, 15
+
+    vsm3c.vi v4, v12, 16
+    vslidedown.vi v20, v12, 2
+    vsm3c.vi v4, v20, 17
+
+    vsm3me.vv v16, v12, v16
+
+    vslidedown.vi v20, v20, 2
+    vslideup.vi v24, v16, 4
+    vmerge.vvm v20, v24, v20, v0
+
+    vsm3c.vi v4, v20, 18
+    vslidedown.vi v20, v20, 2
+    vsm3c.vi v4, v20, 19
+
+    vsm3c.vi v4, v16, 20
+    vslidedown.vi v20, v16, 2
+    vsm3c.vi v4, v20, 21
+
+    vsm3me.vv v12, v16, v12
+
+    vslidedown.vi v20, v20, 2
+    vslideup.vi v24, v12, 4
+    vmerge.vvm v20, v24, v20, v0
+
+    vsm3c.vi v4, v20, 22
+    vslidedown.vi v20, v20, 2
+    vsm3c.vi v4, v20, 23
+
+    vsm3c.vi v4, v12, 24
+    vslidedown.vi v20, v12, 2
+    vsm3c.vi v4, v20, 25
+
+    vsm3me.vv v16, v12, v16
+
+    vslidedown.vi v20, v20, 2
+    vslideup.vi v24, v16, 4
+    vmerge.vvm v20, v24, v20, v0
+
+    vsm3c.vi v4, v20, 26
+    vslidedown.vi v20, v20, 2
+    vsm3c.vi v4, v20, 27
+
+    vsm3c.vi v4, v16, 28
+    vslidedown.vi v20, v16, 2
+    vsm3c.vi v4, v20, 29
+
+    vsm3me.vv v12, v16, v12
+
+    vslidedown.vi v20, v20, 2
+    vslideup.vi v24, v12, 4
+    vmerge.vvm v20, v24, v20, v0
+
+    vsm3c.vi v4, v20, 30
+    vslidedown.vi v20, v20, 2
+    vsm3c.vi v4, v20, 31
+
+    # H' = H xor {h,g,f,e,d,c,b,a} for the active messages, H is unchanged
+    # for the others.
+    vmsne.vi v0, v9, 0
+    vxor.vv v8, v8, v4, v0.t
+    vmv.v.v v4, v8
+    vadd.vi v9, v9, -1, v0.t
+
+    # Next block.
+    vsetvli x0, x0, e64, m2, ta, mu
+    vadd.vx v28, v28, a5
+    vsetvli x0, x0, e32, m1, ta, mu
+    j 3b
+
+4:
+    vse32.v v4, (a0)
+
+    # t1 contains the number of 4B elements processed, 8 per message.
+    sub t3, t3, t1
+    slli t2, t1, 2              # 32 bytes of state per message
+    add a0, a0, t2
+    add a1, a1, t1              # 8 bytes of pointer per message
+    srli t2, t1, 1              # 4 bytes of count per message
+    add a2, a2, t2
+    bnez t3, 1b
+
+2:
+    ret
+
+# zvksh_sm3_multi_blocks_lmul1